@@ -42,4 +42,12 @@ struct FlyingPhysics {
     bool enabled = false;
 };
 
+// Opt-in resting state (dropped items, debris). PhysicsSystem puts the body to sleep after it sat
+// still on the ground for a while and skips it until it is moved, pushed or a nearby block changes.
+struct PhysicsSleep {
+    bool asleep = false;
+    uint16_t stillSteps = 0;
+    glm::vec3 restPosition{0.0f};   // where it fell asleep; a Transform elsewhere means it was moved
+};
+
 } // namespace ecs::components
\ No newline at end of file
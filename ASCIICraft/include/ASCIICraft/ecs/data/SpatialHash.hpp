@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+
+namespace ecs::data {
+
+/// Uniform-grid broadphase over entity positions (dropped items, later any small entity).
+///
+/// Entities live in cubic cells keyed by their packed cell coordinate; each cell is a flat vector
+/// of (entity, position) so a query touches only the handful of cells overlapping its box.
+/// Update is incremental: an entity that stays in its cell only has its stored position refreshed,
+/// a cell change is one swap-and-pop plus one push.
+///
+/// Sync patterns for an owning system: either Update only what moved and Remove on destroy (driven
+/// by registry signals, see DroppedItemSystem), or BeginSync, Update every tracked entity, EndSync
+/// drops the entries that were not updated (destroyed or no longer matching the owner's view).
+/// Query callbacks must not Update or Remove; collect and apply afterwards.
+class SpatialHash {
+public:
+    struct Stats {
+        uint32_t entries = 0;
+        uint32_t cells = 0;
+        uint32_t moves = 0;     // cell changes since the last BeginSync
+        uint32_t removed = 0;   // stale entries dropped by the last EndSync
+    };
+
+    explicit SpatialHash(float cellSize = 2.0f);
+
+    /// Inserts \p entity or refreshes its position (moving it between cells when needed).
+    void Update(entt::entity entity, const glm::vec3& position);
+    void Remove(entt::entity entity);
+    void Clear();
+
+    void BeginSync();
+    void EndSync();
+
+    /// Calls fn(entity, position) for every entry whose stored position lies in [min, max].
+    template <typename Fn>
+    void QueryAabb(const glm::vec3& min, const glm::vec3& max, Fn&& fn) const {
+        const int x0 = CellOf(min.x), y0 = CellOf(min.y), z0 = CellOf(min.z);
+        const int x1 = CellOf(max.x), y1 = CellOf(max.y), z1 = CellOf(max.z);
+        const auto inBox = [&](const glm::vec3& p) {
+            return p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y && p.z >= min.z && p.z <= max.z;
+        };
+
+        // A box spanning more cells than are occupied is cheaper to answer by walking the map.
+        const double span = double(x1 - x0 + 1) * double(y1 - y0 + 1) * double(z1 - z0 + 1);
+        if (span > static_cast<double>(m_cells.size())) {
+            for (const auto& [key, entries] : m_cells) {
+                for (const Entry& e : entries) {
+                    if (inBox(e.position)) fn(e.entity, e.position);
+                }
+            }
+            return;
+        }
+
+        for (int z = z0; z <= z1; ++z) {
+            for (int y = y0; y <= y1; ++y) {
+                for (int x = x0; x <= x1; ++x) {
+                    const auto it = m_cells.find(PackCell(x, y, z));
+                    if (it == m_cells.end()) continue;
+                    for (const Entry& e : it->second) {
+                        if (inBox(e.position)) fn(e.entity, e.position);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Calls fn(entity, position) for every entry within \p radius of \p center.
+    template <typename Fn>
+    void QueryRadius(const glm::vec3& center, float radius, Fn&& fn) const {
+        const float radiusSq = radius * radius;
+        QueryAabb(center - glm::vec3(radius), center + glm::vec3(radius),
+                  [&](entt::entity entity, const glm::vec3& position) {
+                      const glm::vec3 d = position - center;
+                      if (glm::dot(d, d) <= radiusSq) fn(entity, position);
+                  });
+    }
+
+    bool Contains(entt::entity entity) const { return m_locations.count(entity) != 0; }
+    size_t Size() const { return m_locations.size(); }
+    float GetCellSize() const { return m_cellSize; }
+    Stats GetStats() const;
+
+private:
+    struct Entry {
+        entt::entity entity;
+        glm::vec3 position;
+    };
+
+    struct Location {
+        uint64_t cell = 0;
+        uint32_t index = 0;     // slot in m_cells[cell]
+        uint32_t stamp = 0;     // sync epoch of the last Update
+    };
+
+    int CellOf(float v) const { return static_cast<int>(std::floor(v * m_invCellSize)); }
+
+    /// 21 bits per axis (two's complement), enough for +-1M cells.
+    static uint64_t PackCell(int x, int y, int z) {
+        constexpr uint64_t kMask = (uint64_t(1) << 21) - 1;
+        return (uint64_t(uint32_t(x)) & kMask) | ((uint64_t(uint32_t(y)) & kMask) << 21)
+             | ((uint64_t(uint32_t(z)) & kMask) << 42);
+    }
+
+    void EraseFromCell(uint64_t cell, uint32_t index);
+
+    float m_cellSize;
+    float m_invCellSize;
+    std::unordered_map<uint64_t, std::vector<Entry>> m_cells;
+    std::unordered_map<entt::entity, Location> m_locations;
+    uint32_t m_stamp = 0;
+    uint32_t m_moves = 0;
+    uint32_t m_removed = 0;
+};
+
+} // namespace ecs::data
@@ -1,23 +1,65 @@
 #pragma once
 
+#include <vector>
+
 #include <entt/entt.hpp>
 
 #include <ASCIICraft/ecs/systems/ISystem.hpp>
+#include <ASCIICraft/ecs/data/SpatialHash.hpp>
 
 namespace ASCIIgL { class EventBus; }
 
 namespace ecs::systems {
 
+/// Spins, merges and collects dropped items. The spatial hash is kept current from registry signals
+/// instead of a walk over every item: new items and Transform patches (PhysicsSystem's write-back,
+/// the magnet pull) queue the entity, DroppedItemTag removal drops it. Sleeping bodies are never
+/// written back, so they cost nothing here. Lifetime expiry and pickup delays are queued the same way.
 class DroppedItemSystem : public ISystem {
 public:
     DroppedItemSystem(entt::registry& registry, ASCIIgL::EventBus &eventBus);
+    ~DroppedItemSystem() override;
+
+    DroppedItemSystem(const DroppedItemSystem&) = delete;
+    DroppedItemSystem& operator=(const DroppedItemSystem&) = delete;
+
     void Update() override;
+    /// Update with an explicit frame time (microbenchmarks).
+    void Update(float dt);
+
+    /// Full walk over every item each frame instead of the signal queues; the reference path for
+    /// comparisons (microbenchmarks). Set before the first Update.
+    void SetFullSyncEnabled(bool enabled) { fullSync = enabled; }
+
+    /// Dropped item positions as of the last Update (pickup, merging and proximity queries).
+    const data::SpatialHash& GetSpatialHash() const { return itemHash; }
 
 private:
     entt::registry& registry;
     ASCIIgL::EventBus &eventBus;
 
+    data::SpatialHash itemHash;
+    std::vector<entt::entity> movedItems;      // hash entries to refresh (may repeat)
+    std::vector<entt::entity> despawnQueue;    // Lifetime::shouldDespawn was set (may repeat)
+    std::vector<entt::entity> delayedItems;    // pickupDelay still counting down
+    std::vector<entt::entity> expiredItems;
+    std::vector<entt::entity> nearbyItems;
+    float maxMagnetRadius = 0.0f;
+    float mergeTimer = 0.0f;
+    bool fullSync = false;
+
+    void OnItemAdded(entt::registry& reg, entt::entity entity);
+    void OnItemRemoved(entt::registry& reg, entt::entity entity);
+    void OnTransformPatched(entt::registry& reg, entt::entity entity);
+    void OnLifetimePatched(entt::registry& reg, entt::entity entity);
+    void OnPickupAdded(entt::registry& reg, entt::entity entity);
+
     void SpinItems(const float dt);
+    void DespawnExpiredItems();
+    void TickPickupDelays(const float dt);
+    void SyncItems();
+    void FullSyncItems(const float dt);
+    void MergeItems(const float dt);
     void PickupItems(const float dt);
 };
 
@@ -1,9 +1,19 @@
 #pragma once
 
+#include <array>
+#include <memory>
+#include <vector>
+
 #include <entt/entt.hpp>
 
+#include <ASCIIgL/renderer/Renderer.hpp>
+#include <ASCIIgL/renderer/UniformLayout.hpp>
+#include <ASCIIgL/renderer/VertFormat.hpp>
+
 #include <ASCIICraft/ecs/components/PlayerCamera.hpp>
 
+namespace ASCIIgL { class Material; class Mesh; }
+
 namespace ecs::systems {
 
 class EntityRenderSystem {
@@ -14,8 +24,56 @@ public:
     void SetActive3DCamera(components::PlayerCamera* camera3D);
 
 private:
+    /// Fog uniforms of a shared entity material, resolved once by name.
+    struct FogMaterial {
+        std::shared_ptr<ASCIIgL::Material> material;
+        ASCIIgL::UniformHandle cameraPos;
+        ASCIIgL::UniformHandle fogParams;
+        ASCIIgL::UniformHandle fogColor;
+    };
+
+    /// A base entity material and its instanced twin (same shaders, model matrix per instance).
+    struct InstancedVariant {
+        std::shared_ptr<ASCIIgL::Material> base;
+        std::shared_ptr<ASCIIgL::Material> instanced;
+        ASCIIgL::UniformHandle viewProj;
+    };
+
+    /// An entity eligible for instancing, grouped with others sharing its mesh and draw state.
+    struct InstanceCandidate {
+        const ASCIIgL::Mesh* mesh;
+        ASCIIgL::Material* material;        // base material (used when the entity ends up alone)
+        ASCIIgL::Material* instanced;
+        int layer;
+        bool transparent;
+        bool backfaceCulling;
+        glm::mat4 model;
+        glm::vec3 worldPos;
+    };
+
+    void SyncEntityFogParams();
+    void ResolveInstancedVariants(const glm::mat4& viewProj);
+    ASCIIgL::Material* FindInstancedVariant(const ASCIIgL::Material* base) const;
+    void SubmitEntityDraw(const ASCIIgL::Mesh* mesh, ASCIIgL::Material* material, int layer,
+                          bool transparent, bool backfaceCulling, const glm::mat4& model,
+                          const glm::vec3& worldPos,
+                          const std::vector<ASCIIgL::Renderer::UniformOverride>& extraOverrides);
+    void SubmitInstanceBatches();
+
     entt::registry& m_registry;
     components::PlayerCamera* m_active3DCamera = nullptr;
+    std::array<FogMaterial, 6> m_fogMaterials;
+    std::array<InstancedVariant, 2> m_instancedVariants;
+
+    // Frame scratch, kept for its capacity.
+    std::vector<InstanceCandidate> m_instanceCandidates;
+    std::vector<ASCIIgL::VertStructs::InstanceTransformTintLayer> m_instanceData;
+    std::vector<ASCIIgL::Renderer::UniformOverride> m_overrides;
+
+    // Per-draw override descriptors for the last material seen (entities mostly share materials).
+    const ASCIIgL::Material* m_overrideMaterial = nullptr;
+    const ASCIIgL::UniformDescriptor* m_mvpDesc = nullptr;
+    const ASCIIgL::UniformDescriptor* m_worldPosDesc = nullptr;
 };
 
 }
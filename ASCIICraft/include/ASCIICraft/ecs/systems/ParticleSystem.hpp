@@ -8,9 +8,12 @@
 #include <ASCIICraft/events/ParticleSpawnEvent.hpp>
 #include <ASCIICraft/events/BlockHitEvent.hpp>
 
+#include <ASCIICraft/ecs/components/PlayerCamera.hpp>
 #include <ASCIICraft/ecs/components/Transform.hpp>
 #include <ASCIICraft/ecs/systems/ISystem.hpp>
 
+#include <ASCIICraft/particles/ParticlePool.hpp>
+
 #include <ASCIICraft/util/RNG.hpp>
 
 namespace ASCIIgL { class EventBus; }
@@ -25,6 +28,12 @@ public:
     void Update();
     bool Init();
 
+    /// Submits every pooled particle as one instanced draw of a shared quad (block material).
+    void Render();
+    void SetActive3DCamera(components::PlayerCamera* camera3D);
+
+    const particles::ParticlePool& GetBlockParticlePool() const { return m_blockParticles; }
+
 private:
     // ALL of these constants are for the random ambient particles, this shouldn't be in ParticleSystem
     // but will be for now until I get more particles and need to modularize this.
@@ -52,10 +61,10 @@ private:
     static constexpr float PARTICLE_SCALE   = 0.125f;
 
     // -------------------------------------------------------------------------
-    // Block break / hit particles
+    // Block break / hit particles (pooled, see ParticlePool)
     // -------------------------------------------------------------------------
+    static constexpr int   MAX_POOLED_PARTICLES = 32768;
     static constexpr int   BREAK_BURST_COUNT   = 18;
-    static constexpr int   BREAK_MESH_VARIANTS = 4;    // sub-UV variants shared per burst
     static constexpr float BREAK_LIFETIME      = 0.6f;
     static constexpr float BREAK_SCALE         = 0.06f; // unit quad spans 2 units
     static constexpr int   HIT_PUFF_COUNT      = 2;
@@ -67,14 +76,14 @@ private:
     void ProcessBlockBreakEvents();
     void ProcessBlockHitEvents();
     void DespawnDeadParticles();
+    void SimulatePooledParticles(float dt, const glm::vec3& playerPos);
     bool InitLeafMaterial();
+    bool InitBlockParticleMaterial();
 
     /// Texture-array layer of the given blockstate's model (first face), or -1.
     float ResolveBlockTextureLayer(uint32_t stateId) const;
-    /// Billboard quad sampling a random 4x4 sub-region of the given terrain layer.
-    std::shared_ptr<ASCIIgL::Mesh> BuildBlockParticleMesh(float textureLayer);
-    /// Terrain-array material used for block particles (lazily fetched).
-    std::shared_ptr<ASCIIgL::Material> GetBlockParticleMaterial();
+    /// Random 4x4 sub-region of a 16x16 block texture (like vanilla), as u0, v0, u1, v1.
+    glm::vec4 RandomBlockSubUV();
 
     entt::registry&    m_registry;
     ASCIIgL::EventBus& eventBus;
@@ -83,6 +92,14 @@ private:
     std::shared_ptr<ASCIIgL::Material> m_leafMaterial;
     std::shared_ptr<ASCIIgL::Material> m_blockParticleMaterial;
 
+    particles::ParticlePool m_blockParticles{MAX_POOLED_PARTICLES};
+    std::shared_ptr<ASCIIgL::Mesh> m_blockParticleQuad;
+    std::vector<particles::BillboardInstance> m_blockParticleInstances;   // reused each frame
+    const ASCIIgL::UniformDescriptor* m_blockParticleMvpDesc = nullptr;
+    const ASCIIgL::UniformDescriptor* m_blockParticleRightDesc = nullptr;
+    const ASCIIgL::UniformDescriptor* m_blockParticleUpDesc = nullptr;
+    components::PlayerCamera* m_active3DCamera = nullptr;
+
     int   m_particleCount = 0;
     util::RNG m_rng;
 };
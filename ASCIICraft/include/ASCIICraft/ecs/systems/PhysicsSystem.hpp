@@ -1,6 +1,10 @@
 // ecs/systems/PhysicsSystem.hpp
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 #include <entt/entt.hpp>
 #include <glm/glm.hpp>
 
@@ -9,6 +13,7 @@
 #include <ASCIICraft/ecs/components/Velocity.hpp>
 #include <ASCIICraft/ecs/components/PlayerMode.hpp>
 #include <ASCIICraft/ecs/systems/ISystem.hpp>
+#include <ASCIICraft/world/Coords.hpp>
 
 class World;
 
@@ -16,6 +21,10 @@ namespace blockstate {
 class BlockStateRegistry;
 } // namespace blockstate
 
+namespace worldquery {
+class VoxelAccessor;
+} // namespace worldquery
+
 namespace ecs::systems {
 
 class PhysicsSystem : public ISystem {
@@ -25,9 +34,52 @@ public:
     /// Call every frame with frame dt; system accumulates and steps at fixed tick
     void Update() override;
 
+    /// Non-player bodies integrate on TBB workers once there are at least this many.
+    static constexpr size_t PARALLEL_MIN_BODIES = 256;
+
+    /// A PhysicsSleep body falls asleep after this many consecutive grounded steps below SLEEP_SPEED.
+    static constexpr uint16_t SLEEP_STEPS = 15;
+    static constexpr float SLEEP_SPEED = 0.05f;
+
+    struct Stats {
+        uint32_t bodies = 0;            // gathered in the last Update
+        uint32_t parallelBodies = 0;    // of those, integrated on workers (0 = serial step)
+        uint32_t sleeping = 0;          // skipped in the last gather
+        uint32_t woken = 0;             // woken in the last gather (moved, pushed or block change)
+        uint32_t substeps = 0;
+    };
+
+    const Stats &GetStats() const { return m_stats; }
+
+    /// Serial reference path for comparisons (microbenchmarks); on by default.
+    void SetParallelEnabled(bool enabled) { m_parallelEnabled = enabled; }
+
+    /// Runs \p steps fixed ticks immediately, leaving the accumulator and render interpolation alone.
+    void RunFixedSteps(int steps);
+
 private:
+    /// Dense copy of one entity's physics components, integrated without touching the registry so
+    /// worker threads never race on entt storage.
+    struct BodyState {
+        entt::entity entity = entt::null;
+        glm::vec3 position{0.0f};
+        components::Velocity velocity;
+        components::Collider collider;
+        components::StepPhysics step;
+        components::GroundPhysics ground;
+        glm::vec3 gravity{0.0f};
+        bool hasGravity = false;
+        bool hasCollider = false;       // present and enabled
+        bool hasStep = false;
+        bool hasGround = false;
+        bool canFly = false;
+        bool sneaking = false;
+        bool canSleep = false;
+        components::PhysicsSleep sleep;
+    };
+
     struct VoxelOverlapProbe {
-        const World *world = nullptr;
+        const worldquery::VoxelAccessor *voxels = nullptr;
         const blockstate::BlockStateRegistry *bsr = nullptr;
         glm::vec3 halfExtents{};
         bool colliderDisabled = false;
@@ -35,20 +87,31 @@ private:
         bool operator()(const glm::vec3 &center) const;
     };
 
+    void WakeBodiesNearBlockChanges(World &world);
+    void GatherBodies();
+    void ScatterBodies();
     void Step(float fixedDt);
-    void IntegrateEntities(float dt, const World &world);
+    void IntegrateBodies(float dt, const World &world);
+    void IntegrateBody(
+        float dt,
+        BodyState &body,
+        const worldquery::VoxelAccessor &voxels,
+        const blockstate::BlockStateRegistry *bsr
+    ) const;
+
+    void UpdateSleep(BodyState &body) const;
 
     void ResolveAABBAgainstWorld(
-        components::Transform &t,
-        components::Collider &col,
+        glm::vec3 &position,
+        const components::Collider &col,
         components::Velocity &vel,
         float dt,
-        const World &world,
+        const worldquery::VoxelAccessor &voxels,
         const blockstate::BlockStateRegistry *bsr,
         const components::StepPhysics *stepPhysics,
         components::GroundPhysics *groundPhysics,
         bool isSneaking
-    );
+    ) const;
 
     void UpdateGroundState(
         const glm::vec3 &pos,
@@ -56,7 +119,7 @@ private:
         components::Velocity &vel,
         const VoxelOverlapProbe &overlaps,
         components::GroundPhysics *groundPhysics
-    );
+    ) const;
 
     bool HasGroundSupport(
         const glm::vec3 &pos,
@@ -83,14 +146,14 @@ private:
         float dt,
         glm::vec3 &currentPos,
         const VoxelOverlapProbe &overlaps
-    );
+    ) const;
 
     void SlideHorizontal(
         glm::vec3 &pos,
         components::Velocity &vel,
         float dt,
         const VoxelOverlapProbe &overlaps
-    );
+    ) const;
 
     float BinarySearchCollision(
         const glm::vec3 &startPos,
@@ -102,10 +165,17 @@ private:
     entt::registry &m_registry;
     float m_accumulator{0.0f};
 
+    std::vector<BodyState> m_mainBodies;    // players: integrated on the calling thread
+    std::vector<BodyState> m_workerBodies;
+    bool m_parallelEnabled = true;
+    Stats m_stats;
+    std::vector<WorldCoord> m_blockChanges;
+
     static constexpr float FixedDt = 1.0f / 30.0f;
     static constexpr float AIR_FRICTION = 1.0f;
     static constexpr float GROUND_PROBE_DISTANCE = 0.05f;
     static constexpr float MOVE_EPSILON = 0.0001f;
+    static constexpr size_t BODY_GRAIN = 64;       // bodies per TBB range (one VoxelAccessor each)
 };
 
 } // namespace ecs::systems
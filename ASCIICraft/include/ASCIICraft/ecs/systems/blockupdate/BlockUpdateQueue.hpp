@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <ASCIICraft/world/Coords.hpp>
+
+namespace ecs::systems {
+
+/// Block positions waiting for an update on a given tick (a neighbour changed, a timed mechanic is
+/// due). A position is queued at most once: scheduling it again only moves it earlier. Due entries
+/// come out in tick order, then in the order they were scheduled.
+class BlockUpdateQueue {
+public:
+    /// Queues \p pos for \p dueTick. False when it was already queued for that tick or earlier.
+    bool Schedule(const WorldCoord& pos, uint64_t dueTick);
+
+    /// Appends up to \p budget positions due at or before \p tick to \p out and returns how many
+    /// due positions are left queued for lack of budget.
+    size_t PopDue(uint64_t tick, size_t budget, std::vector<WorldCoord>& out);
+
+    size_t Size() const { return m_pending.size(); }
+    bool Empty() const { return m_pending.empty(); }
+    void Clear();
+
+private:
+    struct Entry {
+        uint64_t dueTick;
+        uint64_t seq;
+        WorldCoord pos;
+    };
+
+    // Min-heap order for std::push_heap / pop_heap (the comparator says "runs later").
+    struct RunsLater {
+        bool operator()(const Entry& a, const Entry& b) const {
+            return a.dueTick != b.dueTick ? a.dueTick > b.dueTick : a.seq > b.seq;
+        }
+    };
+
+    struct Pending {
+        uint64_t dueTick;
+        uint64_t seq;       // the live heap entry; older entries for the position are skipped
+    };
+
+    static uint64_t PackPos(const WorldCoord& pos);
+
+    std::vector<Entry> m_heap;
+    std::unordered_map<uint64_t, Pending> m_pending;
+    uint64_t m_nextSeq = 0;
+};
+
+} // namespace ecs::systems
@@ -1,23 +1,65 @@
 #include <ASCIIgL/util/EventBus.hpp>
 #include <ASCIICraft/ecs/systems/ISystem.hpp>
+#include <ASCIICraft/ecs/systems/blockupdate/BlockUpdateQueue.hpp>
+#include <ASCIICraft/world/terrain/TerrainResult.hpp>
 
 #include <entt/entt.hpp>
 
+#include <cstdint>
+#include <vector>
+
+class ChunkManager;
+
 namespace ecs::systems {
 
+/// Applies block break/place events and runs scheduled block updates.
+///
+/// Updates are tick based (TICKS_PER_SECOND). A changed block schedules its six neighbours. Each
+/// due position is handled once per tick, at most MAX_UPDATES_PER_TICK of them; the rest wait
+/// for the next pass. Handlers read the world as it was when the tick started and queue their
+/// writes. Each pass then flushes the writes with ChunkManager::SetBlockStates, so a chunk is
+/// looked up and marked for remesh once per pass rather than once per edit.
 class BlockUpdateSystem : public ISystem {
 public:
+    static constexpr int TICKS_PER_SECOND = 20;
+    static constexpr size_t MAX_UPDATES_PER_TICK = 256;
+
+    struct Stats {
+        uint32_t ticks = 0;             // ticks elapsed in the last Update
+        uint32_t processed = 0;         // block updates handled in the last Update
+        uint32_t deferred = 0;          // due updates left for the next pass (budget exhausted)
+        uint32_t pending = 0;           // queued after the last Update, due or not
+        uint32_t writes = 0;            // block writes flushed in the last Update
+        uint32_t chunksWritten = 0;     // chunks those writes dirtied
+    };
+
     explicit BlockUpdateSystem(entt::registry &registry, ASCIIgL::EventBus& eventBus);
     
     void Update() override;
 
+    /// Queues an update of \p pos \p delayTicks ticks from now (0 = this Update).
+    void ScheduleUpdate(const WorldCoord& pos, uint32_t delayTicks = 0);
+    /// Queues the six face neighbours of \p pos.
+    void ScheduleNeighborUpdates(const WorldCoord& pos, uint32_t delayTicks = 0);
+
+    const Stats& GetStats() const { return m_stats; }
+    uint64_t GetTick() const { return m_tick; }
+
 private:
     entt::registry &m_registry;
     ASCIIgL::EventBus &eventBus;
 
+    BlockUpdateQueue m_queue;
+    std::vector<WorldCoord> m_due;
+    std::vector<WorldBlockPlacement> m_writes;
+    uint64_t m_tick = 0;
+    float m_tickAccumulator = 0.0f;
+    Stats m_stats;
+
     void BreakBlockEvents();
     void PlaceBlockEvents();
+    void RunScheduledUpdates(ChunkManager& chunkManager);
+    void FlushWrites(ChunkManager& chunkManager);
 };
 
 }
-
@@ -1,18 +1,27 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <list>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include <AL/al.h>
 #include <AL/alc.h>
+#include <AL/alext.h>
 
 #include <entt/entt.hpp>
+#include <oneapi/tbb/concurrent_queue.h>
+#include <oneapi/tbb/task_group.h>
 
 #include <ASCIICraft/ecs/systems/ISystem.hpp>
 #include <ASCIIgL/util/EventBus.hpp>
 
 #include <ASCIICraft/events/SoundEvents.hpp>
+#include <ASCIICraft/sound/StreamingSource.hpp>
 
 namespace ecs::systems {
 
@@ -25,28 +34,94 @@ public:
 
     bool IsMusicPlaying() const;
 
+    /// True when running on an ALC_SOFT_loopback device (set ASCIICRAFT_AUDIO_DEVICE=loopback, or no
+    /// output device could be opened). Mixing is then pulled by \ref RenderLoopbackFrames.
+    bool IsLoopback() const { return m_renderLoopbackSamples != nullptr; }
+    /// Advances a loopback device by \p frames (rendered into a scratch buffer and discarded).
+    /// Update() calls this with the frame delta; headless tools may drive it directly.
+    void RenderLoopbackFrames(int frames);
+
+    /// Decodes every resident (non-streamed) path in the SoundRegistry on TBB workers; buffers are
+    /// uploaded from Update() as they finish, so the first play of a sound no longer decodes inline.
+    void PreloadRegisteredSounds();
+
+    struct CacheStats {
+        size_t residentBytes   = 0;     // PCM held in AL buffers
+        size_t residentBuffers = 0;
+        uint64_t hits          = 0;     // play found its buffer resident
+        uint64_t misses        = 0;     // play had to decode synchronously
+        uint64_t evictions     = 0;
+        uint64_t decodes       = 0;     // sync + async
+        double totalDecodeMs   = 0.0;
+        double maxDecodeMs     = 0.0;
+        size_t preloadPending  = 0;
+        uint64_t preloadsDropped = 0;   // decoded preloads that did not fit the budget
+
+        double HitRate() const {
+            const uint64_t lookups = hits + misses;
+            return lookups ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+        }
+    };
+    const CacheStats& GetCacheStats() const { return m_cacheStats; }
+
 private:
     struct SoundBuffer {
         ALuint alBuffer   = 0;
         int    channels   = 0;
         int    sampleRate = 0;
+        size_t bytes      = 0;
+        std::list<std::string>::iterator lruIt;     // position in m_lru (front = most recent)
+    };
+
+    /// PCM decoded off the AL thread; uploaded (and freed) by UploadPcm on the main thread.
+    struct DecodedPcm {
+        std::string path;
+        std::unique_ptr<short, decltype(&std::free)> samples{nullptr, &std::free};
+        int sampleCount = 0;        // per channel
+        int channels    = 0;
+        int sampleRate  = 0;
+        double decodeMs = 0.0;
     };
 
     void InitOpenAL();
+    bool OpenLoopbackDevice();
     void ShutdownOpenAL();
 
     void OnPlaySound(const events::PlaySoundEvent& event);
     void OnPlayMusic(const events::PlayMusicEvent& event);
 
-    SoundBuffer& LoadSoundId(const std::string& soundId);
+    /// Picks a variant path for \p soundId; empty (and logged) if the id cannot be resolved.
+    std::string  ResolveSoundPath(const std::string& soundId);
     SoundBuffer& LoadOggByPath(const std::string& path);
-    SoundBuffer  DecodeOgg(const std::string& path);
+    /// Thread-safe (no AL calls).
+    static DecodedPcm DecodeOggPcm(const std::string& path);
+    SoundBuffer  UploadPcm(DecodedPcm& pcm);
+
+    /// Inserts \p buf as most recently used and evicts cold buffers over PCM_BUDGET_BYTES.
+    /// Preloaded buffers go in as least recently used and evict nothing: the caller only inserts
+    /// them when they fit, so a speculative decode never displaces a buffer that was played.
+    SoundBuffer& InsertBuffer(const std::string& path, SoundBuffer buf, bool mostRecent);
+    void         TouchBuffer(SoundBuffer& buf);
+    void         EvictOverBudget(const std::string& keepPath);
+    /// False if a playing/paused voice holds \p alBuffer; otherwise detaches it from idle voices.
+    bool         DetachIfIdle(ALuint alBuffer);
+    void         RecordDecode(double decodeMs);
+    void         DrainPreloadedBuffers();
+
+    /// Long SFX (file larger than STREAM_MIN_FILE_BYTES) stream instead of decoding to a resident buffer.
+    bool ShouldStream(const std::string& path);
+    void PlayStreamedSfx(const std::string& path, const events::PlaySoundEvent& event);
+    void ApplyEmitter(ALuint source, const events::PlaySoundEvent& event);
 
     /// Returns 0 if no SFX voice could be acquired (at cap and none to steal).
     ALuint AcquireSource();
     void   RecycleFinishedSources();
 
     static constexpr int MAX_SFX_VOICES = 32;
+    static constexpr int MAX_SFX_STREAMS = 4;
+    static constexpr std::uintmax_t STREAM_MIN_FILE_BYTES = 256 * 1024;
+    static constexpr int LOOPBACK_SAMPLE_RATE = 44100;
+    static constexpr size_t PCM_BUDGET_BYTES = 24u * 1024u * 1024u;
 
     entt::registry&    m_registry;
     ASCIIgL::EventBus& m_eventBus;
@@ -55,9 +130,20 @@ private:
     ALCcontext* m_context = nullptr;
 
     std::unordered_map<std::string, SoundBuffer> m_buffers;
+    std::list<std::string>                       m_lru;
     std::vector<ALuint>                          m_sources;
+    CacheStats                                   m_cacheStats;
+
+    oneapi::tbb::task_group                      m_preloadTasks;
+    oneapi::tbb::concurrent_queue<DecodedPcm>    m_preloaded;
+    std::chrono::steady_clock::time_point        m_preloadStart{};
+    std::unordered_map<std::string, bool>        m_streamedPaths;
+
+    std::unique_ptr<sound::StreamingSource>              m_musicStream;
+    std::vector<std::unique_ptr<sound::StreamingSource>> m_sfxStreams;
 
-    ALuint m_musicSource = 0;
+    LPALCRENDERSAMPLESSOFT m_renderLoopbackSamples = nullptr;
+    std::vector<short>     m_loopbackScratch;
 };
 
 } // namespace ecs::systems
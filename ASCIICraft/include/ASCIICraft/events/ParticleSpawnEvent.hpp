@@ -21,6 +21,13 @@ struct ParticleSpawnEvent {
     bool gravity = false;
     bool collideWorld = false;
 
+    // Terrain-textured particles (textureLayer >= 0) go to ParticleSystem's pooled engine: a
+    // uvRect sub-region of the layer, drawn together in one call. mesh/material are then ignored
+    // and collideWorld only rests them on the voxel floor.
+    float     textureLayer = -1.0f;
+    glm::vec4 uvRect       = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+
+    // Otherwise each particle becomes an entity rendering this mesh.
     std::shared_ptr<ASCIIgL::Mesh>     mesh;
     std::shared_ptr<ASCIIgL::Material> material;
 };
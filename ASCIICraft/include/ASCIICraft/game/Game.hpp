@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <functional>
+#include <string>
+#include <vector>
 
 #include <entt/entt.hpp>
 
@@ -9,8 +12,11 @@
 #include <ASCIIgL/engine/TextureArray.hpp>
 #include <ASCIIgL/engine/InputManager.hpp>
 #include <ASCIIgL/engine/FPSClock.hpp>
+#include <ASCIIgL/engine/FrameBudgetController.hpp>
 #include <ASCIIgL/engine/Camera3D.hpp>
 #include <ASCIIgL/renderer/Shader.hpp>
+#include <ASCIIgL/util/FrameCapture.hpp>
+#include <ASCIIgL/util/FramePipeline.hpp>
 
 #include <ASCIICraft/world/World.hpp>
 
@@ -59,6 +65,15 @@ enum class GameState {
     Exiting
 };
 
+/// How a recorded capture is played back (see \ref Game::SetReplay).
+enum class ReplayMode {
+    None,
+    /// Camera path playback: pin dt and the player/camera to the capture after Update, then Render.
+    FullPipeline,
+    /// Push the captured ScreenPixel grids straight through Screen output (no simulation or GPU work).
+    OutputOnly
+};
+
 namespace gui { class PlayHUDScreen; }
 namespace gui { class InventoryScreen; }
 
@@ -79,6 +94,23 @@ public:
     // Game loop components
     void Update();
     void Render();
+
+    // Benchmark capture / replay (set before Run)
+    /// Record every presented frame (player/camera state + ScreenPixel grid) to \a path.
+    void SetFrameCapturePath(const std::string& path) { frameCapturePath_ = path; }
+    /// Play back a capture instead of live input; writes per-stage timings to "<path>.timings.txt" and exits at the end.
+    void SetReplay(const std::string& path, ReplayMode mode) { replayPath_ = path; replayMode_ = mode; }
+
+    /// Scale the 3D render resolution down/up to hold TARGET_FPS (ignored during replay, so render cost stays comparable).
+    void SetDynamicResolution(bool enabled) { dynamicResolution_ = enabled; }
+    /// Overlap simulation + draw recording of frame N+1 with GPU execution and presentation of frame N
+    /// on a render thread (adds up to one frame of input latency). Ignored with capture/replay.
+    void SetPipelined(bool enabled) { pipelined_ = enabled; }
+
+    /// Run the named microbenchmark right after Initialize, log its report and exit (see Game_Microbench.cpp).
+    void SetMicrobench(const std::string& name) { microbench_ = name; }
+    /// True if the microbenchmark was unknown, could not run, or a result diverged from its reference.
+    bool MicrobenchFailed() const { return microbenchFailed_; }
     
 private:
     // Resources
@@ -127,6 +159,57 @@ private:
     bool shouldInternalExit;
     /// Prevents duplicate teardown if \ref Shutdown is invoked from multiple paths (e.g. destructor + explicit call).
     bool shutdownInvoked_ = false;
+
+    // Capture / replay (Game_Replay.cpp)
+    std::string frameCapturePath_;
+    std::string replayPath_;
+    ReplayMode replayMode_ = ReplayMode::None;
+    ASCIIgL::FrameCaptureWriter frameCaptureWriter_;
+    ASCIIgL::FrameCaptureReader frameReplayReader_;
+    ASCIIgL::CapturedFrame replayFrame_;
+    size_t replayFramesPlayed_ = 0;
+
+    // Microbenchmarks (Game_Microbench.cpp)
+    std::string microbench_;
+    bool microbenchFailed_ = false;
+    void RunMicrobench();
+    // Each returns false if it could not run or its result diverged from the reference path.
+    bool BenchUniformUpdates();
+    bool BenchTextureKernels();
+    bool BenchCollision();
+    bool BenchPhysicsScaling();
+    bool BenchSpatialHash();
+    bool BenchDroppedItems();
+    bool BenchEventBus();
+    bool BenchFeatureApply();
+    bool BenchLight();
+    bool BenchTextureResidency();
+
+    // Dynamic resolution
+    bool dynamicResolution_ = false;
+    ASCIIgL::FrameBudgetController frameBudget_;
+    void UpdateFrameBudget();
+
+    // Pipelined frame loop (Game_Pipeline.cpp)
+    bool pipelined_ = false;
+    ASCIIgL::FramePipeline framePipeline_;
+    void RunPipelined();
+    /// Render-thread half of a pipelined frame: everything in Render() after RenderPlaying().
+    void ExecuteRenderFrame();
+
+    // Startup: the asset-tree hash for the baked block-model cache is computed on a worker while
+    // textures decode, then consumed by InstallJsonBackedBlockModels.
+    uint64_t blockAssetHash_ = 0;
+    bool blockAssetHashReady_ = false;
+
+    bool BeginCaptureAndReplay();
+    void CaptureFrame();
+    /// Reads the next replay frame and pins the frame delta time; false once the capture is exhausted.
+    bool BeginReplayFrame();
+    /// Overrides player transform and camera with the current replay frame (after Update, before Render).
+    void ApplyReplayFrameState();
+    void RunOutputReplay();
+    void FinishReplay();
     
     // Loading
     bool LoadResources();
@@ -149,6 +232,8 @@ private:
     void RenderPlaying();
     void InitializeItemDefinitions();
     void InitializeBlockStates();
+    // Installs JSON-backed block models from the baked cache, or bakes from JSON and refreshes it.
+    void InstallJsonBackedBlockModels(const std::vector<std::string>& typeNames);
     
     // Constants
     static inline int SCREEN_WIDTH = 550;
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+class World;
+
+namespace blockstate {
+class BlockStateRegistry;
+} // namespace blockstate
+
+namespace particles {
+
+/// One particle handed to ParticlePool::Spawn.
+struct ParticleDesc {
+    glm::vec3 position{0.0f};
+    glm::vec3 velocity{0.0f};
+    float damping = 0.0f;           // same meaning as components::Velocity::damping
+    float lifetime = 1.0f;          // seconds
+    float halfSize = 0.05f;         // billboard half-extent in world units
+    float gravity = 0.0f;           // vertical acceleration (negative = down)
+    bool collideFloor = false;      // come to rest on the voxel below instead of falling through
+    float textureLayer = 0.0f;
+    glm::vec4 uvRect{0.0f, 0.0f, 1.0f, 1.0f};   // u0, v0, u1, v1 within the layer
+};
+
+/// Per-instance stream of a pooled particle draw (see BlockParticleShaders::GetVertFormat): the
+/// vertex shader spans a persistent unit quad around \p center along the camera axes.
+struct BillboardInstance {
+    glm::vec3 center{0.0f};
+    float halfSize = 0.0f;
+    glm::vec4 uvRect{0.0f};         // u0, v0, u1, v1 within the layer
+    float layer = 0.0f;
+};
+static_assert(sizeof(BillboardInstance) == 36, "instance struct must match the vertex format");
+
+/// Fixed-capacity structure-of-arrays particle storage for one material. Particles are plain
+/// floats in parallel arrays (no entities, no per-particle components), integrated four at a time
+/// with SSE2 (scalar tail and fallback; the game target is not built with AVX2) and drawn as one
+/// instanced camera-facing quad per particle.
+///
+/// Collision is the cheap "voxel floor" mode: a colliding particle probes the block column under it
+/// (one block lookup, skipped while it rests in the same cell) and is clamped onto the top of the
+/// first solid cell. There is no side or ceiling collision; debris lives well under a second.
+class ParticlePool {
+public:
+    struct Stats {
+        uint32_t alive = 0;
+        uint32_t spawned = 0;       // since construction / Clear
+        uint32_t dropped = 0;       // spawns refused because the pool was full
+        uint32_t floorProbes = 0;   // block lookups in the last Simulate
+    };
+
+    explicit ParticlePool(size_t capacity);
+
+    /// False (and counted in Stats::dropped) once the pool is full.
+    bool Spawn(const ParticleDesc& desc);
+
+    /// Advances every particle by \p dt, resolves floor contacts against \p world (skipped when null)
+    /// and removes particles whose lifetime ran out or that left the sphere around \p keepCenter.
+    void Simulate(float dt, const World* world, const blockstate::BlockStateRegistry* bsr,
+                  const glm::vec3& keepCenter, float keepRadius);
+
+    /// Overwrites \p instances with one BillboardInstance per live particle (reusing its capacity).
+    void WriteInstances(std::vector<BillboardInstance>& instances) const;
+
+    void Clear();
+
+    size_t Size() const { return m_count; }
+    size_t Capacity() const { return m_capacity; }
+    bool Empty() const { return m_count == 0; }
+    const Stats& GetStats() const { return m_stats; }
+
+private:
+    void ProbeFloors(float dt, const World& world, const blockstate::BlockStateRegistry* bsr);
+    void Integrate(float dt);
+    void Compact(const glm::vec3& keepCenter, float keepRadius);
+    void MoveParticle(size_t dst, size_t src);
+
+    size_t m_capacity = 0;
+    size_t m_count = 0;
+
+    // Hot: touched by the integration kernel every frame.
+    std::vector<float> m_posX, m_posY, m_posZ;
+    std::vector<float> m_velX, m_velY, m_velZ;
+    std::vector<float> m_life;
+    std::vector<float> m_damping;
+    std::vector<float> m_gravity;
+    std::vector<float> m_halfSize;
+    std::vector<float> m_floorY;            // top of the supporting voxel; kNoFloor when none
+
+    // Cold: floor probing and billboard expansion only.
+    std::vector<uint8_t> m_collide;
+    std::vector<int32_t> m_floorCellX, m_floorCellZ;   // column the cached floor belongs to
+    std::vector<float> m_layer;
+    std::vector<glm::vec4> m_uvRect;
+
+    Stats m_stats;
+};
+
+} // namespace particles
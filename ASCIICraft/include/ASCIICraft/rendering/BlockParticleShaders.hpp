@@ -0,0 +1,19 @@
+#pragma once
+
+#include <ASCIIgL/renderer/Shader.hpp>
+#include <ASCIIgL/renderer/VertFormat.hpp>
+
+namespace BlockParticleShaders {
+
+/// Pooled block particles, drawn instanced: one persistent unit quad, spanned per instance
+/// (particles::BillboardInstance) along cameraRight / cameraUp. mvp is the camera
+/// view-projection and fog distance is taken from the particle centre.
+const char* GetVSSource();
+const char* GetPSSource();
+ASCIIgL::UniformBufferLayout GetUniformLayout();
+
+/// PosUVLayer per vertex + BillboardInstance per instance:
+/// centre + half size -> TEXCOORD4, uvRect -> TEXCOORD5, layer -> TEXCOORD6
+const ASCIIgL::VertFormat& GetVertFormat();
+
+} // namespace BlockParticleShaders
@@ -8,4 +8,10 @@ const char* GetVSSource();
 const char* GetPSSource();
 ASCIIgL::UniformBufferLayout GetUniformLayout();
 
+// Instanced variant (VertFormats::PosUVLayerInstanced): the model matrix comes from the
+// per-instance stream, so one draw covers every entity sharing a mesh and material.
+const char* GetInstancedVSSource();
+const char* GetInstancedPSSource();
+ASCIIgL::UniformBufferLayout GetInstancedUniformLayout();
+
 } // namespace DroppedItemShaders
@@ -19,6 +19,9 @@ public:
 
     const std::vector<std::string>* TryGetPaths(const std::string& soundId) const;
 
+    /// Every registered variant path, sorted and deduplicated (used for preloading).
+    std::vector<std::string> GetAllPaths() const;
+
 private:
     std::unordered_map<std::string, std::vector<std::string>> m_entries;
 };
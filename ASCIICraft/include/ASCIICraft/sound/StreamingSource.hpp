@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AL/al.h>
+
+namespace sound {
+
+/// One OpenAL source fed from a small ring of buffers while a background thread decodes the Ogg
+/// file chunk by chunk (stb_vorbis_open_filename / get_samples). Used for music and long SFX so
+/// neither the first play nor the resident PCM scales with track length.
+///
+/// Threading: the decoder thread only touches stb_vorbis and the chunk queue; every AL call happens
+/// on the owning (main) thread in \ref Update, so it works against any device the context was made
+/// current on, including OpenAL Soft's null and loopback devices.
+class StreamingSource {
+public:
+    static constexpr int kBufferCount = 4;          // AL buffers in flight per source
+    static constexpr int kBufferFrames = 8192;      // frames per buffer (~186 ms at 44.1 kHz)
+    static constexpr int kDecodeAheadChunks = kBufferCount;
+
+    struct Stats {
+        uint64_t framesQueued = 0;
+        uint32_t buffersQueued = 0;
+        uint32_t underruns = 0;     // source ran dry before the stream ended and was restarted
+    };
+
+    StreamingSource();
+    ~StreamingSource();
+
+    StreamingSource(const StreamingSource&) = delete;
+    StreamingSource& operator=(const StreamingSource&) = delete;
+
+    /// Opens \p path (header only) and starts the decoder thread. False if the file is not valid Ogg Vorbis.
+    bool Open(const std::string& path);
+
+    /// Starts playback once the first decoded buffer is queued (non-blocking).
+    void Play();
+    void Stop();
+
+    /// Main thread, once per frame: unqueues processed buffers, refills them from decoded chunks and
+    /// restarts the source after an underrun.
+    void Update();
+
+    /// True once the whole file has been decoded, queued and played out (or after Stop / a failed Open).
+    bool IsFinished() const;
+
+    ALuint GetSource() const { return m_source; }
+    const std::string& GetPath() const { return m_path; }
+    const Stats& GetStats() const { return m_stats; }
+
+private:
+    struct Chunk {
+        std::vector<short> samples;     // interleaved
+        int frames = 0;
+    };
+
+    void DecodeLoop(void* vorbis);
+    void StopDecoder();
+    bool TryPopChunk(Chunk& out);
+
+    std::string m_path;
+    ALuint m_source = 0;
+    ALuint m_buffers[kBufferCount] = {};
+    std::vector<ALuint> m_freeBuffers;
+    ALenum m_format = 0;
+    int m_channels = 0;
+    int m_sampleRate = 0;
+    bool m_wantPlaying = false;
+    bool m_opened = false;
+    Stats m_stats;
+
+    std::thread m_decoder;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<Chunk> m_ready;          // decoded, waiting for a free AL buffer
+    std::vector<Chunk> m_spare;         // recycled chunk storage
+    bool m_stopRequested = false;       // guarded by m_mutex
+    std::atomic<bool> m_decodeDone{false};
+};
+
+} // namespace sound
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace blockstate {
+class BlockStateRegistry;
+}
+
+namespace blockmodels {
+
+class BlockModelLibrary;
+
+// Binary cache of the JSON-backed block models (blockstate variant -> resolve -> bake output).
+//
+// The blob stores each JSON-backed type's per-state model sets plus a deduplicated table of baked
+// models (render layers, face ranges, collision boxes). It is keyed by:
+// - a content hash of <assetRoot>/blockstates and <assetRoot>/models (paths + bytes),
+// - a signature of the registry layout for the cached types (names, state ranges, properties)
+//   and of the block texture catalog (layer indices are baked into vertices),
+// - kFormatVersion, which must be bumped whenever BakeResolvedModel or the layout changes.
+//
+// Type registration and SetDerivedData stay in code; only model installation is cached.
+class BakedModelCache {
+public:
+    static constexpr uint32_t kFormatVersion = 1;
+
+    struct Key {
+        uint64_t assetHash = 0;
+        uint64_t registrySignature = 0;
+    };
+
+    struct InstallStats {
+        size_t modelCount = 0;        // unique baked models in the blob
+        size_t stateCount = 0;        // stateIds installed
+        size_t blobBytes = 0;
+        double coldBuildMs = 0.0;     // JSON path time recorded when the blob was written
+    };
+
+    /// FNV-1a over the sorted relative paths and contents of the blockstate and model trees.
+    static uint64_t HashAssetTree(const std::string& assetRoot);
+
+    static uint64_t ComputeRegistrySignature(
+        const blockstate::BlockStateRegistry& bsr,
+        const std::vector<std::string>& typeNames
+    );
+
+    /// Maps \p path and installs its model sets for \p typeNames. Returns false (library untouched)
+    /// when the file is missing, was written for another key, or fails validation.
+    static bool TryInstall(
+        const std::string& path,
+        const Key& key,
+        const std::vector<std::string>& typeNames,
+        blockstate::BlockStateRegistry& bsr,
+        BlockModelLibrary& modelLibrary,
+        InstallStats* stats = nullptr
+    );
+
+    /// Serializes the model sets currently registered for \p typeNames. Returns bytes written (0 on failure).
+    static size_t Write(
+        const std::string& path,
+        const Key& key,
+        const std::vector<std::string>& typeNames,
+        const blockstate::BlockStateRegistry& bsr,
+        const BlockModelLibrary& modelLibrary,
+        double coldBuildMs
+    );
+};
+
+} // namespace blockmodels
@@ -27,6 +27,8 @@ namespace blockmodels {
         const blockstate::BlockModel* GetModel(uint32_t stateId) const;
         // Deterministic equal-probability selection by world-space block coordinate.
         const blockstate::BlockModel* GetModelForBlock(uint32_t stateId, int worldX, int worldY, int worldZ) const;
+        // Full (canonicalized) model set for a stateId; nullptr if none registered.
+        const std::vector<ModelPtr>* GetModelSet(uint32_t stateId) const;
 
         // Explicitly register a model for a specific stateId.
         void RegisterModel(uint32_t stateId, ModelPtr model, blockstate::BlockStateRegistry& bsr);
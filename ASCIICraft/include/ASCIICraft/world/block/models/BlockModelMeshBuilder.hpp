@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <vector>
@@ -27,6 +28,18 @@ void AppendRenderLayer(
     const std::vector<bool>& visibleFaces = {}
 );
 
+/// Like AppendRenderLayer, but writes lit terrain vertices (VertStructs::PosUVLayerLight).
+/// \p faceLight holds the packed light per cardinal face (FaceDir order), then one for faces
+/// without a cardinal direction (cross plants, inner model faces).
+void AppendRenderLayerLit(
+    std::vector<std::byte>& dstVerts,
+    std::vector<int>& dstIndices,
+    const blockstate::RenderLayer& layer,
+    glm::vec3 positionOffset,
+    const std::vector<bool>& visibleFaces,
+    const std::array<float, 7>& faceLight
+);
+
 struct BlockModelMeshBuffers {
     std::vector<std::byte> vertices;
     std::vector<int> indices;
@@ -53,6 +53,12 @@ namespace blockmodels {
         jsonutil::LoadResult<BlockModelDefinition> GetOrLoadBlockModel(const std::string& resourceId);
         void ClearCaches();
 
+        /// Reads and parses \p resourceIds and their parent chains in parallel (one wave per parent
+        /// depth) and fills the cache; only the cache inserts are serial. Failures are skipped here and
+        /// reported by the later GetOrLoadBlockModel. Not safe to call concurrently with other members.
+        /// Returns the number of models added to the cache.
+        size_t PrefetchBlockModels(const std::vector<std::string>& resourceIds);
+
     private:
         std::string assetsRootPath_;
 
@@ -11,6 +11,10 @@ namespace blockstate {
 class BlockStateRegistry;
 }
 
+namespace worldquery {
+class VoxelAccessor;
+}
+
 namespace blockplacement::detail {
 
 uint32_t FinalizeFencePlacedState(
@@ -20,6 +24,14 @@ uint32_t FinalizeFencePlacedState(
     const WorldCoord& position
 );
 
+/// Same, reading the four neighbours through \p voxels (batch refreshes share its chunk cache).
+uint32_t FinalizeFencePlacedState(
+    const blockstate::BlockStateRegistry& bsr,
+    const worldquery::VoxelAccessor& voxels,
+    uint32_t stateId,
+    const WorldCoord& position
+);
+
 bool IsFenceTypeName(const std::string& typeName);
 
 } // namespace blockplacement::detail
@@ -24,8 +24,8 @@ struct BlockState {
     // Pre-computed derived data
     bool isRenderable = true;
     bool isTransparent = false;
-    uint8_t lightEmission = 0;
-    uint8_t lightFilter = 15;                // how much light this block absorbs
+    uint8_t lightEmission = 0;               // block light level (0-15) this block emits
+    uint8_t lightFilter = 15;                // how much light this block absorbs (0 clear, 15 opaque)
     RenderMode renderMode = RenderMode::Opaque;
     bool isFullBlock = true;
     /// If true, don't draw a face when the neighbor block is the same type (e.g. dirt, glass).
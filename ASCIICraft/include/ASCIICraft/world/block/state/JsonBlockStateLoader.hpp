@@ -31,6 +31,10 @@ namespace blockstate {
         jsonutil::LoadResult<BlockstateDefinition> GetOrLoadBlockstate(const std::string& resourceId);
         void ClearCaches();
 
+        /// Reads and parses \p resourceIds in parallel and fills the cache (serial inserts). Failures are
+        /// left for GetOrLoadBlockstate to report. Returns the number of blockstates added.
+        size_t PrefetchBlockstates(const std::vector<std::string>& resourceIds);
+
     private:
         std::string assetsRootPath_;
 
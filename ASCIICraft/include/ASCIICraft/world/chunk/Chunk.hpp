@@ -13,6 +13,7 @@
 #include <ASCIICraft/world/Coords.hpp>
 #include <ASCIICraft/world/Sizes.hpp>
 #include <ASCIICraft/world/chunk/ChunkMeshGen.hpp>
+#include <ASCIICraft/world/light/ChunkLight.hpp>
 
 namespace ASCIIgL { class TextureArray; }
 
@@ -41,6 +42,12 @@ public:
     bool IsDirty() const { return dirty; }
     void SetDirty(bool d) { dirty = d; }
     void SetGenerated(bool g) { generated = g; }
+
+    // Light (written by ChunkManager from light job results; meshing waits until the chunk is lit)
+    const worldlight::ChunkLight& GetLight() const { return light; }
+    void SetLight(const worldlight::ChunkLight& l) { light = l; }
+    bool IsLit() const { return lit; }
+    void SetLit(bool l) { lit = l; }
     
     // Mesh generation for rendering (needs registry for texture/solidity lookups)
     void GenerateMesh(const blockstate::BlockStateRegistry& bsr);
@@ -80,8 +87,11 @@ private:
     ChunkCoord coord;
     uint32_t blocks[VOLUME];  // blockstate IDs, 16x16x16 = 4096 entries
     
+    worldlight::ChunkLight light;
+    
     bool generated;
     bool dirty;
+    bool lit;
 
     // Mesh data for rendering (split into opaque and transparent)
     bool hasOpaqueMesh;
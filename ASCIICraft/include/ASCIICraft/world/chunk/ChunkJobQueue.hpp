@@ -7,6 +7,7 @@
 #include <ASCIICraft/world/terrain/TerrainResult.hpp>
 #include <ASCIICraft/world/chunk/CrossChunkEdit.hpp>
 #include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
+#include <ASCIICraft/world/light/LightEngine.hpp>
 
 #include <array>
 #include <vector>
@@ -34,6 +35,11 @@ struct CompletedTerrainResult {
     TerrainResult result;
 };
 
+/// Result pushed when a light job finishes (the job's sections now hold the new light).
+struct CompletedLightResult {
+    std::shared_ptr<worldlight::LightJob> job;
+};
+
 /// Callback run on unload task: save chunk and optional metadata. region is kept alive for the duration of the task.
 /// closeRegionAfterSave: if true, close region file after save (last chunk in region).
 using UnloadSaveCallback = std::function<void(Chunk* chunk, ChunkCoord coord, const MetaBucket* meta, bool closeRegionAfterSave, std::shared_ptr<RegionFile> region)>;
@@ -41,7 +47,8 @@ using UnloadSaveCallback = std::function<void(Chunk* chunk, ChunkCoord coord, co
 /// Job queue for chunk terrain generation, mesh generation, and chunk unloading using oneTBB.
 /// - Takes registry to get BlockStateRegistry from context when enqueueing.
 /// - EnqueueTerrainGen(Chunk*): worker writes terrain directly into the chunk.
-/// - EnqueueMeshGen(Chunk*): copies chunk + neighbor blocks for the worker; workers do not touch Chunk* after enqueue.
+/// - EnqueueMeshGen(Chunk*): copies chunk + neighbor blocks (and light) for the worker; workers do not touch Chunk* after enqueue.
+/// - EnqueueLight(job): runs worldlight::RunLightJob on chunk copies the caller already made.
 /// - Drain completed results on the main thread and apply (apply block data to chunk, or create Mesh and assign).
 class ChunkJobQueue {
 public:
@@ -57,6 +64,7 @@ public:
 
     void EnqueueTerrainGen(Chunk* chunk);
     void EnqueueMeshGen(Chunk* chunk);
+    void EnqueueLight(std::shared_ptr<worldlight::LightJob> job);
     void EnqueueUnload(ChunkCoord coord, std::shared_ptr<Chunk> chunk, std::optional<MetaBucket> meta, bool closeRegionAfterSave, std::shared_ptr<RegionFile> region);
 
     /// Set callback invoked on the unload task to perform region SaveChunk/SaveMetaData. Required for EnqueueUnload.
@@ -66,6 +74,8 @@ public:
     void DrainCompletedTerrainResultsInto(std::vector<CompletedTerrainResult>& out);
     /// Drain completed mesh results into \p out (cleared first). Reuse \p out each frame to avoid allocs.
     void DrainCompletedMeshResultsInto(std::vector<CompletedMeshResult>& out);
+    /// Drain completed light results into \p out (cleared first).
+    void DrainCompletedLightResultsInto(std::vector<CompletedLightResult>& out);
 
     /// Optional: limit how many terrain results are drained per call. 0 = no limit (default).
     void SetMaxDrainPerFrame(size_t maxCount) { maxDrainPerFrame_ = maxCount; }
@@ -74,7 +84,7 @@ public:
     void SetMaxDrainMeshPerFrame(size_t maxCount) { maxDrainMeshPerFrame_ = maxCount; }
     size_t GetMaxDrainMeshPerFrame() const { return maxDrainMeshPerFrame_; }
 
-    /// Wait for all currently enqueued jobs (terrain, mesh, unload) to complete. Use before shutdown or when pausing.
+    /// Wait for all currently enqueued jobs (terrain, mesh, light, unload) to complete. Use before shutdown or when pausing.
     void WaitForPending();
 
 private:
@@ -85,6 +95,7 @@ private:
     oneapi::tbb::task_group taskGroup_;
     oneapi::tbb::concurrent_queue<CompletedTerrainResult> completedTerrainQueue_;
     oneapi::tbb::concurrent_queue<CompletedMeshResult> completedMeshQueue_;
+    oneapi::tbb::concurrent_queue<CompletedLightResult> completedLightQueue_;
 
     size_t maxDrainPerFrame_ = 0;
     size_t maxDrainMeshPerFrame_ = 0;
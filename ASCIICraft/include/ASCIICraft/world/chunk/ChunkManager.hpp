@@ -5,6 +5,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <unordered_set>
 
 #include <ASCIICraft/world/chunk/ChunkRegion.hpp>
 #include <ASCIICraft/world/chunk/ChunkJobQueue.hpp>
@@ -18,6 +19,8 @@
 
 #include <glm/glm.hpp>
 
+#include <ASCIIgL/renderer/UniformLayout.hpp>
+
 #include <cstdint>
 
 /// Fog parameters used when rendering chunks. fogStart/fogEnd are derived from render distance.
@@ -28,6 +31,8 @@ struct ChunkManagerFogParams {
     glm::vec3 fogColor = glm::vec3(0.f);  // sRGB 0-1, matches palette/gradient convention
 };
 
+namespace ASCIIgL { class Material; }
+
 /// Water animation parameters used when rendering chunks.
 /// animSpeed is in cycles per second; animPhase is a continuous phase value consumed by the terrain shader.
 struct ChunkManagerWaterParams {
@@ -52,6 +57,23 @@ public:
     uint32_t GetBlockState(int x, int y, int z) const;
     void SetBlockState(const WorldCoord& pos, uint32_t stateId);
     void SetBlockState(int x, int y, int z, uint32_t stateId);
+    /// Applies many writes grouped by chunk: one lookup and one dirty mark per chunk (plus each
+    /// touched boundary neighbour once) instead of per block. Sorts \p writes in place; for the
+    /// same position the later write wins, as with sequential SetBlockState calls.
+    /// Returns the number of generated chunks written.
+    size_t SetBlockStates(std::vector<WorldBlockPlacement>& writes);
+    /// Applies pre-grouped edits (see GroupPlacementsByChunk): a generated chunk gets one bulk write
+    /// and one dirty mark, any other target has the edits merged into its MetaBucket.
+    /// Returns the number of generated chunks written.
+    size_t ApplyChunkEditGroups(const std::vector<ChunkEditGroup>& groups);
+
+    /// Loaded chunk at \p coord, or null. Main thread (or while no chunk loads/unloads run).
+    const Chunk* FindChunk(const ChunkCoord& coord) const;
+
+    /// Moves the positions written into generated chunks since the last call into \p out (main
+    /// thread; PhysicsSystem uses them to wake resting bodies). Past MAX_TRACKED_BLOCK_CHANGES the
+    /// list is dropped and \p overflowed is set: treat it as "anything may have changed".
+    void TakeBlockChanges(std::vector<WorldCoord>& out, bool& overflowed);
 
     // Save handling
     void SaveAll();
@@ -112,6 +134,19 @@ private:
     // Reused each frame to avoid allocs when draining job results
     std::vector<CompletedTerrainResult> drainTerrainBuffer_;
     std::vector<CompletedMeshResult> drainMeshBuffer_;
+    std::vector<CompletedLightResult> drainLightBuffer_;
+
+    // Block writes since the last TakeBlockChanges (see there).
+    std::vector<WorldCoord> blockChanges_;
+    bool blockChangesOverflowed_ = false;
+
+    // Light (ChunkManager_Light.cpp). One light job runs at a time on copies of the chunks it
+    // touches; work that arrives meanwhile waits here for the next one.
+    std::vector<ChunkCoord> lightRelightQueue_;             // generated chunks waiting for their first light
+    std::vector<WorldCoord> lightEdits_;                    // block writes in generated chunks
+    std::vector<worldlight::LightSpill> lightSpills_;       // light that left the last job's chunks
+    std::unordered_set<ChunkCoord> lightInvalidated_;       // unloaded while the job ran: drop its result
+    bool lightJobInFlight_ = false;
 
     // Internal methods
     /// Wire neighbor pointers for chunk at coord; mark each neighbor dirty when both have terrain (so edge chunks re-mesh).
@@ -139,8 +174,17 @@ private:
     void ApplyDrainedTerrainResults();
     void ApplyDrainedMeshResults();
     void EnqueueMeshForDirtyChunks();
+    /// Chunk at \p coord needs its light computed from scratch (just generated or loaded).
+    void QueueChunkRelight(const ChunkCoord& coord);
+    /// Starts the next light job (relights, then edits and spills in lit chunks) if none is running.
+    void EnqueueLightJob();
+    /// Copies finished light into the chunks and marks the meshes that sample it dirty.
+    void ApplyDrainedLightResults();
     /// Rebuild mesh on main thread and apply immediately (for same-frame block-edit feedback).
     void RebuildChunkMeshImmediate(Chunk* c);
+    void RecordBlockChange(int x, int y, int z);
+    /// One group of ApplyChunkEditGroups; true if it was written into a generated chunk.
+    bool ApplyChunkEditGroup(const ChunkEditGroup& group);
     /// Apply a list of cross-chunk edits to a chunk (local coords). Used when applying terrain meta and when loading from file.
     void ApplyEditsToChunk(Chunk* c, const std::vector<CrossChunkEdit>& edits);
 
@@ -150,6 +194,8 @@ private:
     static constexpr int MAX_MESH_APPLIES_PER_FRAME = 128;  // GPU uploads per frame; small meshes = cheaper
     static constexpr int MAX_SYNC_MESH_REBUILDS_PER_FRAME = 4;  // main-thread mesh build (small chunk = fast)
     static constexpr unsigned int UNLOAD_RADIUS_PADDING = 0; // extra chunks beyond load radius before unloading
+    static constexpr size_t MAX_TRACKED_BLOCK_CHANGES = 1024;  // bounds the log when nobody drains it
+    static constexpr size_t MAX_LIGHT_RELIGHTS_PER_JOB = 64;   // chunks lit from scratch per light job
 
     // World settings
     const sizes::WorldDimensions& _worldDimensions;
@@ -158,4 +204,15 @@ private:
 
     ChunkManagerFogParams   fogParams_;
     ChunkManagerWaterParams waterParams_;
+
+    /// blockMaterial uniforms, resolved once and re-resolved only if the library hands back another material.
+    struct BlockUniformHandles {
+        const ASCIIgL::Material* material = nullptr;
+        ASCIIgL::UniformHandle mvp;
+        ASCIIgL::UniformHandle cameraPos;
+        ASCIIgL::UniformHandle fogParams;
+        ASCIIgL::UniformHandle fogColor;
+        ASCIIgL::UniformHandle waterAnimPhase;
+    };
+    BlockUniformHandles blockUniforms_;
 };
@@ -3,6 +3,7 @@
 #include <ASCIICraft/world/Coords.hpp>
 #include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
 #include <ASCIICraft/world/block/models/BlockModelLibrary.hpp>
+#include <ASCIICraft/world/light/ChunkLight.hpp>
 
 #include <array>
 #include <vector>
@@ -32,10 +33,14 @@ struct ChunkMeshData {
 
 /// Build mesh data from chunk and neighbor block arrays (read-only).
 /// Used by Chunk::GenerateMesh (synchronous) and ChunkJobQueue (worker tasks).
+/// Each face carries the light of the cell it faces (FaceDir order for neighbors); a null light
+/// array reads as full sky light.
 ChunkMeshData BuildChunkMeshData(
     ChunkCoord coord,
     const uint32_t* chunkBlocks,
     const std::array<const uint32_t*, 6>& neighborBlocks,
     const blockstate::BlockStateRegistry* bsr,
-    const blockmodels::BlockModelLibrary* modelLibrary
+    const blockmodels::BlockModelLibrary* modelLibrary,
+    const worldlight::ChunkLight* chunkLight,
+    const std::array<const worldlight::ChunkLight*, 6>& neighborLight
 );
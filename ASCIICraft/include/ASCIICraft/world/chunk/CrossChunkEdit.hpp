@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 
@@ -22,6 +23,55 @@ struct CrossChunkEdit {
   }
 };
 
+// MetaBucket edits are kept sorted by packedPos with one edit per position, so merging a batch
+// is a linear pass and applying them walks the chunk in order.
+
+/// Sorts \p edits by position, keeping the last edit made to each position.
+inline void NormalizeEdits(std::vector<CrossChunkEdit>& edits) {
+  std::stable_sort(edits.begin(), edits.end(), [](const CrossChunkEdit& a, const CrossChunkEdit& b) {
+    return a.packedPos < b.packedPos;
+  });
+  size_t out = 0;
+  for (size_t i = 0; i < edits.size(); ++i) {
+    if (i + 1 < edits.size() && edits[i + 1].packedPos == edits[i].packedPos) continue;
+    edits[out++] = edits[i];
+  }
+  edits.resize(out);
+}
+
+/// Merges normalized \p newer into normalized \p edits; on the same position \p newer wins.
+inline void MergeEdits(std::vector<CrossChunkEdit>& edits, const std::vector<CrossChunkEdit>& newer) {
+  if (newer.empty()) return;
+  if (edits.empty()) {
+    edits = newer;
+    return;
+  }
+  std::vector<CrossChunkEdit> merged;
+  merged.reserve(edits.size() + newer.size());
+  size_t i = 0, j = 0;
+  while (i < edits.size() || j < newer.size()) {
+    if (j == newer.size() || (i < edits.size() && edits[i].packedPos < newer[j].packedPos)) {
+      merged.push_back(edits[i++]);
+    } else {
+      if (i < edits.size() && edits[i].packedPos == newer[j].packedPos) ++i;
+      merged.push_back(newer[j++]);
+    }
+  }
+  edits.swap(merged);
+}
+
+/// Inserts or replaces one edit in normalized \p edits.
+inline void UpsertEdit(std::vector<CrossChunkEdit>& edits, const CrossChunkEdit& edit) {
+  auto it = std::lower_bound(edits.begin(), edits.end(), edit, [](const CrossChunkEdit& a, const CrossChunkEdit& b) {
+    return a.packedPos < b.packedPos;
+  });
+  if (it != edits.end() && it->packedPos == edit.packedPos) {
+    it->stateId = edit.stateId;
+  } else {
+    edits.insert(it, edit);
+  }
+}
+
 struct MetaBucket {
   MetaBucket() {
     edits = {};
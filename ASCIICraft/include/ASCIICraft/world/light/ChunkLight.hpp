@@ -0,0 +1,56 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include <ASCIICraft/world/Sizes.hpp>
+
+namespace worldlight {
+
+enum class LightChannel : uint8_t {
+    Sky = 0,    // from the open sky; 15 travels straight down through clear cells without dimming
+    Block = 1,  // from emitters (BlockState::lightEmission)
+};
+
+inline constexpr uint8_t MAX_LIGHT = 15;
+
+/// Sky and block light of one chunk, 0-15 per cell, packed two cells per byte.
+/// Indexed like Chunk's block array (chunkutil::GetBlockIndex).
+class ChunkLight {
+public:
+    static constexpr int VOLUME = sizes::CHUNK_SIZE * sizes::CHUNK_SIZE * sizes::CHUNK_SIZE;
+    static constexpr int BYTES = VOLUME / 2;
+
+    ChunkLight() { Clear(); }
+
+    uint8_t Get(LightChannel channel, int index) const {
+        const uint8_t* data = Data(channel);
+        return (data[index >> 1] >> ((index & 1) << 2)) & 0xF;
+    }
+
+    void Set(LightChannel channel, int index, uint8_t level) {
+        uint8_t* data = Data(channel);
+        const int shift = (index & 1) << 2;
+        data[index >> 1] = static_cast<uint8_t>((data[index >> 1] & ~(0xF << shift)) | ((level & 0xF) << shift));
+    }
+
+    uint8_t GetSky(int index) const { return Get(LightChannel::Sky, index); }
+    uint8_t GetBlock(int index) const { return Get(LightChannel::Block, index); }
+
+    /// Sky * 16 + block, the value the terrain vertices carry.
+    uint8_t GetPacked(int index) const { return static_cast<uint8_t>((GetSky(index) << 4) | GetBlock(index)); }
+
+    void Clear() {
+        std::fill(sky, sky + BYTES, uint8_t(0));
+        std::fill(block, block + BYTES, uint8_t(0));
+    }
+
+private:
+    const uint8_t* Data(LightChannel channel) const { return channel == LightChannel::Sky ? sky : block; }
+    uint8_t* Data(LightChannel channel) { return channel == LightChannel::Sky ? sky : block; }
+
+    uint8_t sky[BYTES];
+    uint8_t block[BYTES];
+};
+
+} // namespace worldlight
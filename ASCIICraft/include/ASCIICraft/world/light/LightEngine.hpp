@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <ASCIICraft/world/Coords.hpp>
+#include <ASCIICraft/world/light/ChunkLight.hpp>
+
+namespace blockstate { class BlockStateRegistry; }
+
+namespace worldlight {
+
+/// A light step that left the job's window (its chunk was not copied). ChunkManager hands it to
+/// the next job, which copies that chunk.
+struct LightSpill {
+    WorldCoord pos;
+    uint8_t level = 0;          // add: level of the cell next to pos; remove: level that cell had
+    LightChannel channel = LightChannel::Sky;
+    bool remove = false;
+    bool fromAbove = false;     // the cell next to pos is directly above it
+};
+
+/// One chunk copied into a light job (blocks and light as they were at enqueue time).
+struct LightSection {
+    ChunkCoord coord;
+    std::vector<uint32_t> blocks;   // ChunkLight::VOLUME block states
+    ChunkLight light;
+    bool lit = false;           // holds valid light (chunks without it are never copied as neighbours)
+    bool relight = false;       // compute this chunk's light from scratch
+    bool skyAbove = false;      // no lit chunk above: its top face sees open sky
+    bool changed = false;       // out: light differs from the copy
+    uint8_t borderFaces = 0;    // out: FaceDir bits whose border cells changed (neighbour meshes sample them)
+};
+
+/// Input and output of one light job: the chunks to relight, block edits in lit chunks, and spills
+/// from earlier jobs, plus the lit neighbours that light can step into. Steps past the copied
+/// chunks come back as spills.
+struct LightJob {
+    std::vector<LightSection> sections;
+    std::vector<WorldCoord> edits;          // cells whose block changed in lit sections
+    std::vector<LightSpill> spillsIn;
+    std::vector<LightSpill> spillsOut;
+
+    uint32_t cellsVisited = 0;              // out: queue pops, the job's cost
+};
+
+/// Runs \p job in place. Worker thread; only reads \p bsr.
+///
+/// Breadth-first flood fill per channel: removals first (a cleared cell clears the neighbours it
+/// lit and re-queues brighter ones as sources), then additions. Relit chunks seed sky light from a
+/// per-column heightmap and block light from emitters, then pull light in from lit neighbours.
+/// An edit restarts both channels at its cell only, so it costs the cells whose light changes.
+void RunLightJob(LightJob& job, const blockstate::BlockStateRegistry& bsr);
+
+} // namespace worldlight
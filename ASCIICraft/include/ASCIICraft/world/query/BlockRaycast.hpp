@@ -39,11 +39,16 @@ std::optional<RayAabbHit> RayAabb(
 
 using BlockStateGetter = std::function<uint32_t(int x, int y, int z)>;
 
+class VoxelAccessor;
+
 /// Nearest block selection hit along a normalized ray within \p reach.
 /// Selection boxes: BlockState::collisionBoxes when non-empty; otherwise a full 1³ cell
 /// for any non-air block (plants remain targetable while physics-non-solid).
+/// \p getState is a VoxelAccessor (hot paths) or a BlockStateGetter; both are instantiated in
+/// BlockRaycast.cpp so the per-cell read inlines instead of going through std::function.
+template <typename StateGetter>
 std::optional<BlockRayHit> RaycastBlocks(
-    const BlockStateGetter& getState,
+    const StateGetter& getState,
     const blockstate::BlockStateRegistry* bsr,
     const glm::vec3& origin,
     const glm::vec3& dir,
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <ASCIICraft/world/Coords.hpp>
+#include <ASCIICraft/world/Sizes.hpp>
+#include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
+#include <ASCIICraft/world/chunk/ChunkUtil.hpp>
+
+class ChunkManager;
+class World;
+
+namespace worldquery {
+
+/// Block reads for hot loops (physics probes, raycasts, neighbour scans) without a
+/// ChunkManager::loadedChunks hash lookup per voxel.
+///
+/// Keeps a 2x2x2 direct-mapped cache of chunk block arrays, slot chosen by the low bit of each chunk
+/// coordinate: any box narrower than a chunk (every entity collider) maps its up to eight chunks to
+/// distinct slots, so after the first touch every read is an index into Chunk's flat block array.
+/// Unloaded chunks are cached as "air", matching ChunkManager::GetBlockState.
+///
+/// Cheap to construct; make one per query batch (a physics step, a raycast) and per thread. The
+/// cache is not synchronised and goes stale once chunks load or unload, so do not keep one across
+/// ChunkManager::Update.
+class VoxelAccessor {
+public:
+    explicit VoxelAccessor(const ChunkManager* chunkManager);
+    explicit VoxelAccessor(const World* world);
+
+    uint32_t GetBlockState(int x, int y, int z) const {
+        const int cx = x >> kChunkShift;
+        const int cy = y >> kChunkShift;
+        const int cz = z >> kChunkShift;
+        Slot& slot = m_slots[(cx & 1) | ((cy & 1) << 1) | ((cz & 1) << 2)];
+        if (slot.cx != cx || slot.cy != cy || slot.cz != cz) {
+            Bind(slot, cx, cy, cz);
+        }
+        if (!slot.blocks) {
+            return blockstate::BlockStateRegistry::AIR_STATE_ID;
+        }
+        return slot.blocks[chunkutil::GetBlockIndex(x & kChunkMask, y & kChunkMask, z & kChunkMask)];
+    }
+
+    uint32_t GetBlockState(const WorldCoord& pos) const { return GetBlockState(pos.x, pos.y, pos.z); }
+
+    /// Lets the accessor stand in wherever a BlockStateGetter-shaped callable is expected.
+    uint32_t operator()(int x, int y, int z) const { return GetBlockState(x, y, z); }
+
+    /// Chunk map lookups performed so far (cache misses).
+    uint32_t GetChunkLookups() const { return m_chunkLookups; }
+
+private:
+    // Floor division by the chunk size via arithmetic shift (two's complement on every target).
+    static constexpr int kChunkShift = 4;
+    static constexpr int kChunkMask = sizes::CHUNK_SIZE - 1;
+    static_assert(sizes::CHUNK_SIZE == (1 << kChunkShift), "VoxelAccessor assumes 16-block chunks");
+
+    struct Slot {
+        int32_t cx = std::numeric_limits<int32_t>::min();   // never a real chunk coordinate
+        int32_t cy = 0;
+        int32_t cz = 0;
+        const uint32_t* blocks = nullptr;
+    };
+
+    void Bind(Slot& slot, int cx, int cy, int cz) const;
+
+    const ChunkManager* m_chunkManager = nullptr;
+    mutable Slot m_slots[8];
+    mutable uint32_t m_chunkLookups = 0;
+};
+
+} // namespace worldquery
@@ -6,6 +6,7 @@
 #include <glm/glm.hpp>
 
 #include <ASCIICraft/world/query/BlockQueries.hpp>
+#include <ASCIICraft/world/query/BlockRaycast.hpp>
 
 class World;
 
@@ -53,4 +54,21 @@ bool OverlapsSolidForPhysics(
     bool colliderDisabled
 );
 
+/// Same test through a caller-owned accessor, so repeated probes (a physics step sweeps and
+/// binary-searches the same few cells) keep hitting its chunk cache.
+bool OverlapsSolidForPhysics(
+    const VoxelAccessor &voxels,
+    const blockstate::BlockStateRegistry *bsr,
+    const glm::vec3 &center,
+    const glm::vec3 &halfExtents
+);
+
+/// Reference path: one \p getState call per cell (e.g. World::GetBlockState). Microbenchmarks only.
+bool OverlapsSolidForPhysics(
+    const BlockStateGetter &getState,
+    const blockstate::BlockStateRegistry *bsr,
+    const glm::vec3 &center,
+    const glm::vec3 &halfExtents
+);
+
 } // namespace worldquery
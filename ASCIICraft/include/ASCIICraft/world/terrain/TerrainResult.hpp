@@ -4,6 +4,7 @@
 #include <cstdint>
 
 #include <ASCIICraft/world/Coords.hpp>
+#include <ASCIICraft/world/chunk/CrossChunkEdit.hpp>
 
 /// Single block placement in world space (for trees and other cross-chunk features).
 struct WorldBlockPlacement {
@@ -11,13 +12,27 @@ struct WorldBlockPlacement {
     uint32_t stateId;
 };
 
+/// Placements that land in one chunk, as chunk-local edits (sorted, one per position).
+struct ChunkEditGroup {
+    ChunkCoord chunk;
+    std::vector<CrossChunkEdit> edits;
+};
+
+/// Groups \p placements by target chunk into \p out (cleared first). Later placements to the same
+/// block win, as if applied one by one.
+void GroupPlacementsByChunk(const std::vector<WorldBlockPlacement>& placements, std::vector<ChunkEditGroup>& out);
+
 /// Result of generating terrain for one chunk. Terrain block data is written
 /// directly into the chunk by the worker; only cross-chunk data (e.g. trees) is
-/// returned for main-thread application via ChunkManager::SetBlockState.
+/// returned for main-thread application.
 struct TerrainResult {
-    /// Blocks placed in world space (e.g. trees). Apply via ChunkManager::SetBlockState on the main thread.
+    /// Blocks placed in world space (e.g. trees), as the generator emits them. The terrain job
+    /// groups them into crossChunkGroups and clears this list before handing the result over.
     std::vector<WorldBlockPlacement> crossChunkBlocks;
 
+    /// crossChunkBlocks per target chunk; ChunkManager applies each group as one bulk write.
+    std::vector<ChunkEditGroup> crossChunkGroups;
+
     // Future: block entities (chests, furnaces, etc.)
     // std::vector<BlockEntityPlacement> block_entities;
 
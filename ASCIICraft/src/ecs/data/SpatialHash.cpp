@@ -0,0 +1,93 @@
+#include <ASCIICraft/ecs/data/SpatialHash.hpp>
+
+namespace ecs::data {
+
+SpatialHash::SpatialHash(float cellSize)
+    : m_cellSize(cellSize > 0.0f ? cellSize : 1.0f)
+    , m_invCellSize(1.0f / m_cellSize) {}
+
+void SpatialHash::Update(entt::entity entity, const glm::vec3& position) {
+    const uint64_t cell = PackCell(CellOf(position.x), CellOf(position.y), CellOf(position.z));
+
+    auto [it, inserted] = m_locations.try_emplace(entity);
+    Location& loc = it->second;
+    loc.stamp = m_stamp;
+
+    if (!inserted) {
+        if (loc.cell == cell) {
+            m_cells[cell][loc.index].position = position;
+            return;
+        }
+        EraseFromCell(loc.cell, loc.index);
+        ++m_moves;
+    }
+
+    std::vector<Entry>& entries = m_cells[cell];
+    loc.cell = cell;
+    loc.index = static_cast<uint32_t>(entries.size());
+    entries.push_back({entity, position});
+}
+
+void SpatialHash::Remove(entt::entity entity) {
+    const auto it = m_locations.find(entity);
+    if (it == m_locations.end()) {
+        return;
+    }
+    EraseFromCell(it->second.cell, it->second.index);
+    m_locations.erase(it);
+}
+
+void SpatialHash::Clear() {
+    m_cells.clear();
+    m_locations.clear();
+    m_moves = 0;
+    m_removed = 0;
+}
+
+void SpatialHash::BeginSync() {
+    ++m_stamp;
+    m_moves = 0;
+}
+
+void SpatialHash::EndSync() {
+    m_removed = 0;
+    for (auto it = m_locations.begin(); it != m_locations.end();) {
+        if (it->second.stamp != m_stamp) {
+            EraseFromCell(it->second.cell, it->second.index);
+            it = m_locations.erase(it);
+            ++m_removed;
+        } else {
+            ++it;
+        }
+    }
+}
+
+SpatialHash::Stats SpatialHash::GetStats() const {
+    Stats stats;
+    stats.entries = static_cast<uint32_t>(m_locations.size());
+    stats.cells = static_cast<uint32_t>(m_cells.size());
+    stats.moves = m_moves;
+    stats.removed = m_removed;
+    return stats;
+}
+
+void SpatialHash::EraseFromCell(uint64_t cell, uint32_t index) {
+    const auto cellIt = m_cells.find(cell);
+    if (cellIt == m_cells.end()) {
+        return;
+    }
+    std::vector<Entry>& entries = cellIt->second;
+
+    // Swap-and-pop; the entry moved into the hole gets its index patched.
+    if (index + 1 != entries.size()) {
+        entries[index] = entries.back();
+        m_locations[entries[index].entity].index = index;
+    }
+    entries.pop_back();
+
+    if (entries.empty()) {
+        m_cells.erase(cellIt);
+    }
+}
+
+} // namespace ecs::data
@@ -79,6 +79,7 @@ entt::entity ItemFactory::createDroppedItem(
 
     registry.emplace<Gravity>(entity);
     registry.emplace<GroundPhysics>(entity);
+    registry.emplace<PhysicsSleep>(entity);
 
     // Rendering
     if (resolvedMesh) {
@@ -12,25 +12,88 @@
 #include <ASCIICraft/ecs/components/Pickup.hpp>
 #include <ASCIICraft/ecs/components/Inventory.hpp>
 #include <ASCIICraft/ecs/components/PlayerTag.hpp>
+#include <ASCIICraft/ecs/components/Lifetime.hpp>
 
 #include <glm/gtc/constants.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 namespace ecs::systems {
 
 static constexpr float kMagnetSpeed = 10.0f; // blocks per second toward player center
+static constexpr float kMergeInterval = 0.5f; // seconds between stack merge passes
+static const glm::vec3 kMergeReach{0.5f, 0.25f, 0.5f}; // half extents of the merge box
 
 DroppedItemSystem::DroppedItemSystem(entt::registry& registry, ASCIIgL::EventBus& eventBus)
-    : registry(registry), eventBus(eventBus) {}
+    : registry(registry), eventBus(eventBus) {
+    using namespace ecs::components;
+
+    registry.on_construct<DroppedItemTag>().connect<&DroppedItemSystem::OnItemAdded>(*this);
+    registry.on_destroy<DroppedItemTag>().connect<&DroppedItemSystem::OnItemRemoved>(*this);
+    registry.on_update<Transform>().connect<&DroppedItemSystem::OnTransformPatched>(*this);
+    registry.on_update<Lifetime>().connect<&DroppedItemSystem::OnLifetimePatched>(*this);
+    registry.on_construct<Pickup>().connect<&DroppedItemSystem::OnPickupAdded>(*this);
+}
+
+DroppedItemSystem::~DroppedItemSystem() {
+    using namespace ecs::components;
+
+    registry.on_construct<DroppedItemTag>().disconnect<&DroppedItemSystem::OnItemAdded>(*this);
+    registry.on_destroy<DroppedItemTag>().disconnect<&DroppedItemSystem::OnItemRemoved>(*this);
+    registry.on_update<Transform>().disconnect<&DroppedItemSystem::OnTransformPatched>(*this);
+    registry.on_update<Lifetime>().disconnect<&DroppedItemSystem::OnLifetimePatched>(*this);
+    registry.on_construct<Pickup>().disconnect<&DroppedItemSystem::OnPickupAdded>(*this);
+}
 
 void DroppedItemSystem::Update() {
-    const float dt = ASCIIgL::FPSClock::GetInst().GetDeltaTime();
+    Update(ASCIIgL::FPSClock::GetInst().GetDeltaTime());
+}
 
+void DroppedItemSystem::Update(const float dt) {
     SpinItems(dt);
+    if (fullSync) {
+        FullSyncItems(dt);
+    } else {
+        DespawnExpiredItems();
+        TickPickupDelays(dt);
+        SyncItems();
+    }
+    MergeItems(dt);
     PickupItems(dt);
 }
 
+// Signal handlers only queue work: they run inside other systems' loops (and ItemFactory), where
+// the registry must not be restructured.
+
+void DroppedItemSystem::OnItemAdded(entt::registry&, entt::entity entity) {
+    movedItems.push_back(entity);
+}
+
+void DroppedItemSystem::OnItemRemoved(entt::registry&, entt::entity entity) {
+    itemHash.Remove(entity);
+}
+
+void DroppedItemSystem::OnTransformPatched(entt::registry& reg, entt::entity entity) {
+    if (reg.all_of<components::DroppedItemTag>(entity)) {
+        movedItems.push_back(entity);
+    }
+}
+
+void DroppedItemSystem::OnLifetimePatched(entt::registry& reg, entt::entity entity) {
+    if (reg.get<components::Lifetime>(entity).shouldDespawn && reg.all_of<components::DroppedItemTag>(entity)) {
+        despawnQueue.push_back(entity);
+    }
+}
+
+void DroppedItemSystem::OnPickupAdded(entt::registry& reg, entt::entity entity) {
+    const auto& pickup = reg.get<Pickup>(entity);
+    maxMagnetRadius = std::max(maxMagnetRadius, pickup.magnetRadius);
+    if (pickup.pickupDelay > 0.0f) {
+        delayedItems.push_back(entity);
+    }
+}
+
 void DroppedItemSystem::SpinItems(const float dt) {
     using namespace ecs::components;
 
@@ -46,6 +109,147 @@ void DroppedItemSystem::SpinItems(const float dt) {
     }
 }
 
+void DroppedItemSystem::DespawnExpiredItems() {
+    for (auto entity : despawnQueue) {
+        if (registry.valid(entity)) {
+            registry.destroy(entity);   // OnItemRemoved drops it from the hash
+        }
+    }
+    despawnQueue.clear();
+}
+
+void DroppedItemSystem::TickPickupDelays(const float dt) {
+    size_t kept = 0;
+    for (auto entity : delayedItems) {
+        auto* pickup = registry.valid(entity) ? registry.try_get<Pickup>(entity) : nullptr;
+        if (!pickup) {
+            continue;
+        }
+        pickup->pickupDelay -= dt;
+        if (pickup->pickupDelay > 0.0f) {
+            delayedItems[kept++] = entity;
+        }
+    }
+    delayedItems.resize(kept);
+}
+
+// Refreshes the hash entries of the items that were added or moved since the last frame.
+void DroppedItemSystem::SyncItems() {
+    using namespace ecs::components;
+
+    for (auto entity : movedItems) {
+        if (!registry.valid(entity) || !registry.all_of<DroppedItemTag>(entity)) {
+            continue;
+        }
+        if (const auto* transform = registry.try_get<Transform>(entity)) {
+            itemHash.Update(entity, transform->position);
+        }
+    }
+    movedItems.clear();
+}
+
+// The single pass over every dropped item the queues replaced: despawn expired ones, tick pickup
+// delays and refresh the whole spatial hash.
+void DroppedItemSystem::FullSyncItems(const float dt) {
+    using namespace ecs::components;
+
+    movedItems.clear();
+    despawnQueue.clear();
+    delayedItems.clear();
+    expiredItems.clear();
+    maxMagnetRadius = 0.0f;
+    itemHash.BeginSync();
+
+    auto view = registry.view<DroppedItemTag, Transform>();
+    for (auto entity : view) {
+        if (const auto* lifetime = registry.try_get<Lifetime>(entity); lifetime && lifetime->shouldDespawn) {
+            expiredItems.push_back(entity);
+            continue;
+        }
+
+        if (auto* pickup = registry.try_get<Pickup>(entity)) {
+            if (pickup->pickupDelay > 0.0f) {
+                pickup->pickupDelay -= dt;
+            }
+            maxMagnetRadius = std::max(maxMagnetRadius, pickup->magnetRadius);
+        }
+
+        itemHash.Update(entity, view.get<Transform>(entity).position);
+    }
+
+    // Expired items were not updated, so EndSync drops them from the hash.
+    itemHash.EndSync();
+    for (auto entity : expiredItems) {
+        registry.destroy(entity);
+    }
+}
+
+// Combines touching dropped stacks of the same item: the larger stack absorbs as much of the
+// smaller one as fits, emptied entities are destroyed. Throttled; item clusters settle in a pass or two.
+void DroppedItemSystem::MergeItems(const float dt) {
+    using namespace ecs::components;
+
+    mergeTimer += dt;
+    if (mergeTimer < kMergeInterval) {
+        return;
+    }
+    mergeTimer = 0.0f;
+
+    expiredItems.clear();
+
+    auto view = registry.view<DroppedItemTag, Transform, ItemStack>();
+    for (auto entity : view) {
+        auto& stack = view.get<ItemStack>(entity);
+        if (stack.isEmpty() || stack.count >= stack.maxStackSize) {
+            continue;
+        }
+
+        const glm::vec3 position = view.get<Transform>(entity).position;
+        itemHash.QueryAabb(position - kMergeReach, position + kMergeReach, [&](entt::entity other, const glm::vec3&) {
+            if (other == entity || stack.count >= stack.maxStackSize) {
+                return;
+            }
+            auto* otherStack = registry.try_get<ItemStack>(other);
+            if (!otherStack || otherStack->isEmpty()
+                || otherStack->itemId != stack.itemId
+                || otherStack->metadata != stack.metadata) {
+                return;
+            }
+            // Larger stack absorbs; ties go to the lower entity id so a pair never swaps roles.
+            if (otherStack->count > stack.count || (otherStack->count == stack.count && other < entity)) {
+                return;
+            }
+
+            const int moved = std::min(otherStack->count, stack.maxStackSize - stack.count);
+            stack.count += moved;
+            otherStack->count -= moved;
+
+            if (auto* pickup = registry.try_get<Pickup>(entity)) {
+                if (const auto* otherPickup = registry.try_get<Pickup>(other)) {
+                    // Only items at or below zero have left delayedItems; re-queue when the delay comes back.
+                    if (pickup->pickupDelay <= 0.0f && otherPickup->pickupDelay > 0.0f) {
+                        delayedItems.push_back(entity);
+                    }
+                    pickup->pickupDelay = std::max(pickup->pickupDelay, otherPickup->pickupDelay);
+                }
+            }
+            if (auto* lifetime = registry.try_get<Lifetime>(entity)) {
+                if (const auto* otherLifetime = registry.try_get<Lifetime>(other)) {
+                    lifetime->ageSeconds = std::min(lifetime->ageSeconds, otherLifetime->ageSeconds);
+                }
+            }
+
+            if (otherStack->count == 0) {
+                expiredItems.push_back(other);
+            }
+        });
+    }
+
+    for (auto entity : expiredItems) {
+        registry.destroy(entity);   // OnItemRemoved drops it from the hash
+    }
+}
+
 void DroppedItemSystem::PickupItems(const float dt) {
     using namespace ecs::components;
 
@@ -59,19 +263,30 @@ void DroppedItemSystem::PickupItems(const float dt) {
     const auto& playerCollider = playerView.get<Collider>(playerEntity);
     const glm::vec3 playerCenter = playerTransform.position + playerCollider.localOffset;
 
-    auto itemView = registry.view<DroppedItemTag, Transform, Pickup, ItemStack>();
-    for (auto entity : itemView) {
-        auto& pickup = itemView.get<Pickup>(entity);
+    if (maxMagnetRadius <= 0.0f) {
+        return;
+    }
+
+    // Only items inside the widest magnet radius can react; the hash narrows the scan to them.
+    nearbyItems.clear();
+    itemHash.QueryRadius(playerCenter, maxMagnetRadius, [&](entt::entity entity, const glm::vec3&) {
+        nearbyItems.push_back(entity);
+    });
 
+    for (auto entity : nearbyItems) {
+        if (!registry.valid(entity) || !registry.all_of<Transform, Pickup, ItemStack>(entity)) {
+            continue;
+        }
+
+        const auto& pickup = registry.get<Pickup>(entity);
         if (pickup.pickupDelay > 0.0f) {
-            pickup.pickupDelay -= dt;
             continue;
         }
 
-        auto& itemTransform = itemView.get<Transform>(entity);
-        const auto& itemStack = itemView.get<ItemStack>(entity);
+        const glm::vec3 itemPosition = registry.get<Transform>(entity).position;
+        const auto& itemStack = registry.get<ItemStack>(entity);
 
-        const glm::vec3 toPlayer = playerCenter - itemTransform.position;
+        const glm::vec3 toPlayer = playerCenter - itemPosition;
         const float distSq = glm::dot(toPlayer, toPlayer);
         const float magnetRadiusSq = pickup.magnetRadius * pickup.magnetRadius;
         const float collectRadiusSq = pickup.collectRadius * pickup.collectRadius;
@@ -93,11 +308,14 @@ void DroppedItemSystem::PickupItems(const float dt) {
         const glm::vec3 dir = toPlayer / dist;
         const float step = kMagnetSpeed * dt;
 
-        if (dist <= step) {
-            itemTransform.setPosition(playerCenter);
-        } else {
-            itemTransform.translate(dir * step);
-        }
+        // patch, not a plain write: OnTransformPatched queues the hash refresh.
+        registry.patch<Transform>(entity, [&](Transform& itemTransform) {
+            if (dist <= step) {
+                itemTransform.setPosition(playerCenter);
+            } else {
+                itemTransform.translate(dir * step);
+            }
+        });
 
         if (auto* vel = registry.try_get<Velocity>(entity)) {
             vel->linear = glm::vec3(0.0f);
@@ -1,5 +1,10 @@
 #include <ASCIICraft/ecs/systems/EntityRenderSystem.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <tuple>
+
 #include <ASCIIgL/renderer/Material.hpp>
 #include <ASCIIgL/renderer/Renderer.hpp>
 
@@ -11,8 +16,31 @@
 namespace ecs::systems {
 namespace {
 
-void SyncEntityFogParams(entt::registry& registry) {
-    World* world = GetWorldPtr(registry);
+constexpr const char* kFogMaterialNames[] = {
+    "droppedItemMaterial",
+    "droppedItemBlockMaterial",
+    "leafParticleMaterial",
+    "blockParticleMaterial",
+    "droppedItemMaterialInstanced",
+    "droppedItemBlockMaterialInstanced",
+};
+
+/// Base material -> instanced twin registered next to it (see Game::LoadDroppedItemMaterial).
+constexpr const char* kInstancedVariantNames[][2] = {
+    {"droppedItemMaterial", "droppedItemMaterialInstanced"},
+    {"droppedItemBlockMaterial", "droppedItemBlockMaterialInstanced"},
+};
+
+/// Below this many entities per (mesh, material) group the plain per-entity draw is used.
+constexpr size_t kMinInstanceBatch = 2;
+
+} // namespace
+
+EntityRenderSystem::EntityRenderSystem(entt::registry& registry)
+    : m_registry(registry) {}
+
+void EntityRenderSystem::SyncEntityFogParams() {
+    World* world = GetWorldPtr(m_registry);
     if (!world || !world->GetChunkManager()) {
         return;
     }
@@ -21,39 +49,160 @@ void SyncEntityFogParams(entt::registry& registry) {
     const glm::vec4 fogParams(fog.fogStart, fog.fogEnd, 0.0f, 0.0f);
 
     glm::vec3 cameraPos{0.0f};
-    const entt::entity player = components::GetPlayerEntity(registry);
+    const entt::entity player = components::GetPlayerEntity(m_registry);
     if (player != entt::null) {
-        if (auto [pos, ok] = components::GetPos(player, registry); ok) {
+        if (auto [pos, ok] = components::GetPos(player, m_registry); ok) {
             cameraPos = pos;
         }
     }
 
-    for (const char* materialName : {
-             "droppedItemMaterial",
-             "droppedItemBlockMaterial",
-             "leafParticleMaterial",
-         }) {
-        auto material = ASCIIgL::MaterialLibrary::GetInst().Get(materialName);
-        if (!material) {
-            continue;
+    static_assert(std::size(kFogMaterialNames) == std::tuple_size_v<decltype(m_fogMaterials)>);
+    for (size_t i = 0; i < m_fogMaterials.size(); ++i) {
+        FogMaterial& fm = m_fogMaterials[i];
+        if (!fm.material) {
+            // Materials are registered during startup; keep looking until this one exists.
+            fm.material = ASCIIgL::MaterialLibrary::GetInst().Get(kFogMaterialNames[i]);
+            if (!fm.material) {
+                continue;
+            }
+            fm.cameraPos = fm.material->GetUniformHandle("cameraPos");
+            fm.fogParams = fm.material->GetUniformHandle("fogParams");
+            fm.fogColor = fm.material->GetUniformHandle("fogColor");
         }
-        material->SetFloat3("cameraPos", cameraPos);
-        material->SetFloat4("fogParams", fogParams);
-        material->SetFloat3("fogColor", fog.fogColor);
+        fm.material->Set(fm.cameraPos, cameraPos);
+        fm.material->Set(fm.fogParams, fogParams);
+        fm.material->Set(fm.fogColor, fog.fogColor);
     }
 }
 
-} // namespace
+void EntityRenderSystem::ResolveInstancedVariants(const glm::mat4& viewProj) {
+    static_assert(std::size(kInstancedVariantNames) == std::tuple_size_v<decltype(m_instancedVariants)>);
+    for (size_t i = 0; i < m_instancedVariants.size(); ++i) {
+        InstancedVariant& v = m_instancedVariants[i];
+        if (!v.base || !v.instanced) {
+            v.base = ASCIIgL::MaterialLibrary::GetInst().Get(kInstancedVariantNames[i][0]);
+            v.instanced = ASCIIgL::MaterialLibrary::GetInst().Get(kInstancedVariantNames[i][1]);
+            if (!v.base || !v.instanced) {
+                continue;
+            }
+            v.viewProj = v.instanced->GetUniformHandle("viewProj");
+        }
+        v.instanced->Set(v.viewProj, viewProj);
+    }
+}
 
-EntityRenderSystem::EntityRenderSystem(entt::registry& registry)
-    : m_registry(registry) {}
+ASCIIgL::Material* EntityRenderSystem::FindInstancedVariant(const ASCIIgL::Material* base) const {
+    for (const InstancedVariant& v : m_instancedVariants) {
+        if (v.base.get() == base && v.instanced) {
+            return v.instanced.get();
+        }
+    }
+    return nullptr;
+}
+
+void EntityRenderSystem::SubmitEntityDraw(const ASCIIgL::Mesh* mesh, ASCIIgL::Material* material, int layer,
+                                          bool transparent, bool backfaceCulling, const glm::mat4& model,
+                                          const glm::vec3& worldPos,
+                                          const std::vector<ASCIIgL::Renderer::UniformOverride>& extraOverrides) {
+    const glm::mat4 mvp = m_active3DCamera->camera.proj * m_active3DCamera->camera.view * model;
+
+    ASCIIgL::Renderer::DrawCall dc;
+    dc.mesh = mesh;
+    dc.material = material;
+    dc.layer = layer;
+    dc.sortKey = 0.0f;
+    dc.backfaceCulling = backfaceCulling;
+    dc.transparent = transparent;
+
+    if (material != m_overrideMaterial) {
+        m_overrideMaterial = material;
+        m_mvpDesc = material->GetUniformDescriptor("mvp");
+        m_worldPosDesc = material->GetUniformDescriptor("worldPos");
+    }
+
+    // Reused across entities: the renderer copies overrides into its frame arena on submit.
+    m_overrides.clear();
+    if (m_mvpDesc) {
+        m_overrides.push_back({m_mvpDesc, ASCIIgL::UniformValue(mvp)});
+    }
+
+    if (m_worldPosDesc) {
+        m_overrides.push_back({m_worldPosDesc, ASCIIgL::UniformValue(worldPos)});
+    }
+
+    m_overrides.insert(m_overrides.end(), extraOverrides.begin(), extraOverrides.end());
+
+    ASCIIgL::Renderer::GetInst().SubmitDraw(dc, m_overrides.data(), m_overrides.size());
+}
+
+void EntityRenderSystem::SubmitInstanceBatches() {
+    auto sameGroup = [](const InstanceCandidate& a, const InstanceCandidate& b) {
+        return a.instanced == b.instanced && a.mesh == b.mesh && a.layer == b.layer &&
+               a.transparent == b.transparent && a.backfaceCulling == b.backfaceCulling;
+    };
+    // Built-in < on unrelated pointers is unspecified; std::less gives them a total order.
+    std::sort(m_instanceCandidates.begin(), m_instanceCandidates.end(),
+        [](const InstanceCandidate& a, const InstanceCandidate& b) {
+            if (a.instanced != b.instanced) return std::less<const ASCIIgL::Material*>{}(a.instanced, b.instanced);
+            if (a.mesh != b.mesh) return std::less<const ASCIIgL::Mesh*>{}(a.mesh, b.mesh);
+            return std::tie(a.layer, a.transparent, a.backfaceCulling) <
+                   std::tie(b.layer, b.transparent, b.backfaceCulling);
+        });
+
+    static const std::vector<ASCIIgL::Renderer::UniformOverride> kNoOverrides;
+
+    size_t begin = 0;
+    while (begin < m_instanceCandidates.size()) {
+        size_t end = begin + 1;
+        while (end < m_instanceCandidates.size() &&
+               sameGroup(m_instanceCandidates[end], m_instanceCandidates[begin])) {
+            ++end;
+        }
+
+        const InstanceCandidate& first = m_instanceCandidates[begin];
+        if (end - begin < kMinInstanceBatch) {
+            for (size_t i = begin; i < end; ++i) {
+                const InstanceCandidate& c = m_instanceCandidates[i];
+                SubmitEntityDraw(c.mesh, c.material, c.layer, c.transparent, c.backfaceCulling,
+                                 c.model, c.worldPos, kNoOverrides);
+            }
+            begin = end;
+            continue;
+        }
+
+        m_instanceData.resize(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            ASCIIgL::VertStructs::InstanceTransformTintLayer& inst = m_instanceData[i - begin];
+            inst.SetModel(m_instanceCandidates[i].model);
+            inst.SetTint(glm::vec4(1.0f));
+            inst.SetLayer(-1.0f);
+        }
+
+        ASCIIgL::Renderer::DrawCall dc;
+        dc.mesh = first.mesh;
+        dc.material = first.instanced;
+        dc.layer = first.layer;
+        dc.sortKey = 0.0f;
+        dc.backfaceCulling = first.backfaceCulling;
+        dc.transparent = first.transparent;
+        dc.instanceData = m_instanceData.data();
+        dc.instanceCount = static_cast<uint32_t>(m_instanceData.size());
+        dc.instanceStride = sizeof(ASCIIgL::VertStructs::InstanceTransformTintLayer);
+        ASCIIgL::Renderer::GetInst().SubmitDraw(dc);
+
+        begin = end;
+    }
+}
 
 void EntityRenderSystem::Render() {
     if (!m_active3DCamera) {
         return;
     }
 
-    SyncEntityFogParams(m_registry);
+    SyncEntityFogParams();
+    ResolveInstancedVariants(m_active3DCamera->camera.proj * m_active3DCamera->camera.view);
+    m_overrideMaterial = nullptr;   // re-resolve per frame: never trust a pointer from an earlier frame
+    m_instanceCandidates.clear();
 
     auto view = m_registry.view<components::Transform, components::Renderable>();
 
@@ -68,28 +217,21 @@ void EntityRenderSystem::Render() {
         const glm::mat4 model = r.billboard
             ? m_active3DCamera->camera.GetBillboardMatrix(t.renderPosition, t.scale)
             : t.getRenderModel() * r.localModel;
-        const glm::mat4 mvp = m_active3DCamera->camera.proj * m_active3DCamera->camera.view * model;
-
-        ASCIIgL::Renderer::DrawCall dc;
-        dc.mesh = r.mesh.get();
-        dc.material = r.material.get();
-        dc.layer = r.layer;
-        dc.sortKey = 0.0f;
-        dc.backfaceCulling = r.backfaceCulling;
-        dc.transparent = r.transparent;
 
-        if (const ASCIIgL::UniformDescriptor* desc = r.material->GetUniformDescriptor("mvp")) {
-            dc.overrides.push_back({desc, ASCIIgL::UniformValue(mvp)});
-        }
-
-        if (const ASCIIgL::UniformDescriptor* worldPosDesc = r.material->GetUniformDescriptor("worldPos")) {
-            dc.overrides.push_back({worldPosDesc, ASCIIgL::UniformValue(t.renderPosition)});
+        // Entities with their own uniform overrides can't share one draw; everything else on a
+        // material with an instanced twin is deferred and grouped by mesh.
+        ASCIIgL::Material* instanced = r.overrides.empty() ? FindInstancedVariant(r.material.get()) : nullptr;
+        if (instanced) {
+            m_instanceCandidates.push_back({r.mesh.get(), r.material.get(), instanced, r.layer,
+                                            r.transparent, r.backfaceCulling, model, t.renderPosition});
+            continue;
         }
 
-        dc.overrides.insert(dc.overrides.end(), r.overrides.begin(), r.overrides.end());
-
-        ASCIIgL::Renderer::GetInst().SubmitDraw(dc);
+        SubmitEntityDraw(r.mesh.get(), r.material.get(), r.layer, r.transparent, r.backfaceCulling,
+                         model, t.renderPosition, r.overrides);
     }
+
+    SubmitInstanceBatches();
 }
 
 void EntityRenderSystem::SetActive3DCamera(components::PlayerCamera* camera3D) {
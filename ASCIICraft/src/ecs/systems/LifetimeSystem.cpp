@@ -16,8 +16,9 @@ void LifetimeSystem::Update() {
     for (auto [ent, lifetime] : view.each()) {
         lifetime.ageSeconds += dt;
 
-        if (lifetime.maxLifetimeSeconds > 0.0f && lifetime.ageSeconds >= lifetime.maxLifetimeSeconds)
-            lifetime.shouldDespawn = true;
+        // Flagged once, through patch: owners (DroppedItemSystem) queue the despawn from on_update.
+        if (!lifetime.shouldDespawn && lifetime.maxLifetimeSeconds > 0.0f && lifetime.ageSeconds >= lifetime.maxLifetimeSeconds)
+            m_registry.patch<components::Lifetime>(ent, [](components::Lifetime &l) { l.shouldDespawn = true; });
     }
 }
 
@@ -11,22 +11,26 @@
 
 #include <ASCIICraft/events/BreakBlockEvent.hpp>
 
+#include <ASCIICraft/world/World.hpp>
+
 #include <ASCIICraft/world/block/models/BlockModelLibrary.hpp>
 #include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
 
-#include <ASCIICraft/util/MeshBuilderUtil.hpp>
 #include <ASCIICraft/util/QuadMeshBuilder.hpp>
 
 #include <ASCIIgL/engine/TextureLibrary.hpp>
 #include <ASCIIgL/renderer/Material.hpp>
 #include <ASCIIgL/renderer/HLSLIncludes.hpp>
+#include <ASCIIgL/renderer/MaterialBuilder.hpp>
+#include <ASCIIgL/renderer/Renderer.hpp>
 #include <ASCIIgL/renderer/Shader.hpp>
 #include <ASCIIgL/renderer/VertFormat.hpp>
 
+#include <ASCIICraft/rendering/BlockParticleShaders.hpp>
 #include <ASCIICraft/rendering/LeafParticleShaders.hpp>
 
-#include <array>
 #include <cstring>
+#include <iterator>
 
 namespace ecs::systems {
     ParticleSystem::ParticleSystem(entt::registry &registry, ASCIIgL::EventBus& eventBus) 
@@ -46,6 +50,47 @@ namespace ecs::systems {
         ProcessBlockHitEvents();
         ProcessSpawnEvents();
         DespawnDeadParticles();
+        SimulatePooledParticles(dt, t.position);
+    }
+
+    void ParticleSystem::SimulatePooledParticles(float dt, const glm::vec3& playerPos) {
+        const World* world = GetWorldPtr(m_registry);
+        const auto* bsr = m_registry.ctx().find<blockstate::BlockStateRegistry>();
+        m_blockParticles.Simulate(dt, world, bsr, playerPos, SPAWN_RADIUS);
+    }
+
+    void ParticleSystem::SetActive3DCamera(components::PlayerCamera* camera3D) {
+        m_active3DCamera = camera3D;
+    }
+
+    void ParticleSystem::Render() {
+        if (!m_active3DCamera || !m_blockParticleMaterial || !m_blockParticleQuad || m_blockParticles.Empty()) {
+            return;
+        }
+
+        const ASCIIgL::Camera3D& camera = m_active3DCamera->camera;
+        // Camera axes in world space (rows of the view matrix), as in Camera3D::GetBillboardMatrix.
+        const glm::vec3 right(camera.view[0][0], camera.view[1][0], camera.view[2][0]);
+        const glm::vec3 up(camera.view[0][1], camera.view[1][1], camera.view[2][1]);
+
+        m_blockParticles.WriteInstances(m_blockParticleInstances);
+
+        ASCIIgL::Renderer::DrawCall dc;
+        dc.mesh = m_blockParticleQuad.get();
+        dc.material = m_blockParticleMaterial.get();
+        dc.backfaceCulling = false;
+        dc.transparent = true;
+        dc.instanceData = m_blockParticleInstances.data();
+        dc.instanceCount = static_cast<uint32_t>(m_blockParticleInstances.size());
+        dc.instanceStride = sizeof(particles::BillboardInstance);
+
+        const glm::mat4 viewProj = camera.proj * camera.view;
+        const ASCIIgL::Renderer::UniformOverride overrides[] = {
+            {m_blockParticleMvpDesc, ASCIIgL::UniformValue(viewProj)},
+            {m_blockParticleRightDesc, ASCIIgL::UniformValue(right)},
+            {m_blockParticleUpDesc, ASCIIgL::UniformValue(up)},
+        };
+        ASCIIgL::Renderer::GetInst().SubmitDraw(dc, overrides, std::size(overrides));
     }
 
     void ParticleSystem::DespawnDeadParticles() {
@@ -120,6 +165,22 @@ namespace ecs::systems {
         auto& events = eventBus.view<events::ParticleSpawnEvent>();
 
         for (const auto& e : events) {
+            if (e.textureLayer >= 0.0f) {
+                particles::ParticleDesc desc;
+                desc.position = e.origin;
+                desc.velocity = e.velocity;
+                desc.damping = e.damping;
+                desc.lifetime = e.lifetime;
+                desc.halfSize = e.scale.x;      // the entity billboard quad spans +-1 in local space
+                desc.gravity = e.gravity ? components::Gravity{}.acceleration.y : 0.0f;
+                desc.collideFloor = e.collideWorld;
+                desc.textureLayer = e.textureLayer;
+                desc.uvRect = e.uvRect;
+                for (int i = 0; i < e.count; ++i) {
+                    m_blockParticles.Spawn(desc);
+                }
+                continue;
+            }
             if (!e.mesh) continue;
 
             for (int i = 0; i < e.count; ++i) {
@@ -141,6 +202,7 @@ namespace ecs::systems {
                     auto& col = m_registry.emplace<components::Collider>(entity);
                     col.halfExtents = glm::vec3(0.05f);
                     m_registry.emplace<components::GroundPhysics>(entity);
+                    m_registry.emplace<components::PhysicsSleep>(entity);
                 }
 
                 auto& lifetime = m_registry.emplace<components::Lifetime>(entity);
@@ -181,69 +243,20 @@ namespace ecs::systems {
         return firstVert.Layer();
     }
 
-    std::shared_ptr<ASCIIgL::Mesh> ParticleSystem::BuildBlockParticleMesh(float textureLayer) {
-        using V = ASCIIgL::VertStructs::PosUVLayer;
-
-        // Random 4x4 sub-region of the 16x16 block texture (like vanilla).
+    glm::vec4 ParticleSystem::RandomBlockSubUV() {
         const float u0 = m_rng.NextFloat() * 0.75f;
         const float v0 = m_rng.NextFloat() * 0.75f;
-        const float u1 = u0 + 0.25f;
-        const float v1 = v0 + 0.25f;
-
-        const std::array<glm::vec3, 4> positions = {{
-            {-1.0f, -1.0f, 0.0f},
-            {-1.0f,  1.0f, 0.0f},
-            { 1.0f,  1.0f, 0.0f},
-            { 1.0f, -1.0f, 0.0f},
-        }};
-        const std::array<glm::vec2, 4> uvs = {{
-            {u0, v1},
-            {u0, v0},
-            {u1, v0},
-            {u1, v1},
-        }};
-
-        std::vector<V> vertices;
-        std::vector<int> indices;
-        util::AppendQuadPosUVLayer(vertices, indices, positions, uvs, textureLayer);
-
-        auto terrainTextureArray =
-            ASCIIgL::TextureLibrary::GetInst().GetTextureArray("terrainTextureArray");
-
-        return std::make_shared<ASCIIgL::Mesh>(
-            util::PackVerts(vertices),
-            ASCIIgL::VertFormats::PosUVLayer(),
-            std::move(indices),
-            terrainTextureArray ? terrainTextureArray.get() : nullptr
-        );
-    }
-
-    std::shared_ptr<ASCIIgL::Material> ParticleSystem::GetBlockParticleMaterial() {
-        if (!m_blockParticleMaterial) {
-            // PosUVLayer + terrain array + fog, with per-draw mvp/worldPos overrides
-            // (fog params are synced each frame by EntityRenderSystem).
-            m_blockParticleMaterial =
-                ASCIIgL::MaterialLibrary::GetInst().Get("droppedItemBlockMaterial");
-        }
-        return m_blockParticleMaterial;
+        return glm::vec4(u0, v0, u0 + 0.25f, v0 + 0.25f);
     }
 
     void ParticleSystem::ProcessBlockBreakEvents() {
         const auto& breakEvents = eventBus.view<events::BreakBlockEvent>();
         if (breakEvents.empty()) return;
 
-        auto material = GetBlockParticleMaterial();
-        if (!material) return;
-
         for (const auto& e : breakEvents) {
             const float textureLayer = ResolveBlockTextureLayer(e.stateId);
             if (textureLayer < 0.0f) continue;
 
-            std::array<std::shared_ptr<ASCIIgL::Mesh>, BREAK_MESH_VARIANTS> meshes;
-            for (auto& mesh : meshes) {
-                mesh = BuildBlockParticleMesh(textureLayer);
-            }
-
             const glm::vec3 blockMin(
                 static_cast<float>(e.position.x),
                 static_cast<float>(e.position.y),
@@ -273,8 +286,8 @@ namespace ecs::systems {
                 spawn.scale = glm::vec3(BREAK_SCALE * (0.8f + 0.4f * m_rng.NextFloat()));
                 spawn.gravity = true;
                 spawn.collideWorld = true;
-                spawn.mesh = meshes[i % BREAK_MESH_VARIANTS];
-                spawn.material = material;
+                spawn.textureLayer = textureLayer;
+                spawn.uvRect = RandomBlockSubUV();
                 eventBus.emit(spawn);
             }
         }
@@ -284,9 +297,6 @@ namespace ecs::systems {
         const auto& hitEvents = eventBus.view<events::BlockHitEvent>();
         if (hitEvents.empty()) return;
 
-        auto material = GetBlockParticleMaterial();
-        if (!material) return;
-
         for (const auto& e : hitEvents) {
             const float textureLayer = ResolveBlockTextureLayer(e.stateId);
             if (textureLayer < 0.0f) continue;
@@ -318,8 +328,8 @@ namespace ecs::systems {
                 spawn.scale = glm::vec3(HIT_SCALE * (0.8f + 0.4f * m_rng.NextFloat()));
                 spawn.gravity = true;
                 spawn.collideWorld = true;
-                spawn.mesh = BuildBlockParticleMesh(textureLayer);
-                spawn.material = material;
+                spawn.textureLayer = textureLayer;
+                spawn.uvRect = RandomBlockSubUV();
                 eventBus.emit(spawn);
             }
         }
@@ -362,8 +372,43 @@ namespace ecs::systems {
         return true;
     }
 
+    bool ParticleSystem::InitBlockParticleMaterial() {
+        if (!ASCIIgL::BuildAndRegisterMaterial({
+            "blockParticleMaterial",
+            BlockParticleShaders::GetVSSource(),
+            BlockParticleShaders::GetPSSource(),
+            BlockParticleShaders::GetVertFormat(),
+            BlockParticleShaders::GetUniformLayout(),
+            true,
+            [](ASCIIgL::Material& material) {
+                auto terrainTextureArray = ASCIIgL::TextureLibrary::GetInst().GetTextureArray("terrainTextureArray");
+                if (!terrainTextureArray) {
+                    ASCIIgL::Logger::Error("terrainTextureArray missing for block particle material");
+                    return false;
+                }
+                material.SetTextureArray(0, terrainTextureArray.get());
+                return true;
+            }
+        })) {
+            return false;
+        }
+
+        // Fog params are synced each frame by EntityRenderSystem; mvp and the camera axes are set per draw.
+        m_blockParticleMaterial = ASCIIgL::MaterialLibrary::GetInst().Get("blockParticleMaterial");
+        if (!m_blockParticleMaterial) return false;
+        m_blockParticleMvpDesc = m_blockParticleMaterial->GetUniformDescriptor("mvp");
+        m_blockParticleRightDesc = m_blockParticleMaterial->GetUniformDescriptor("cameraRight");
+        m_blockParticleUpDesc = m_blockParticleMaterial->GetUniformDescriptor("cameraUp");
+
+        // Built once; every particle is an instance of it, so only the instance stream changes per frame.
+        m_blockParticleQuad = util::QuadMeshBuilder::BuildPosUVLayerQuad(
+            ASCIIgL::TextureLibrary::GetInst().GetTextureArray("terrainTextureArray"), 0.0f);
+        return m_blockParticleQuad != nullptr;
+    }
+
     bool ParticleSystem::Init() {
         if (!InitLeafMaterial()) return false;
+        if (!InitBlockParticleMaterial()) return false;
 
         m_leafMesh = util::QuadMeshBuilder::BuildPosColorQuad(
             ASCIIgL::PaletteUtil::sRGB255ToLinear1(glm::ivec4(34, 139, 34, 255))
@@ -5,9 +5,15 @@
 #include <algorithm>
 #include <cmath>
 
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+
 #include <ASCIIgL/engine/FPSClock.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
 
 #include <ASCIICraft/world/World.hpp>
+#include <ASCIICraft/world/chunk/ChunkManager.hpp>
+#include <ASCIICraft/world/query/VoxelAccessor.hpp>
 #include <ASCIICraft/world/query/VoxelOverlap.hpp>
 #include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
 #include <ASCIICraft/ecs/components/PlayerCamera.hpp>
@@ -18,7 +24,10 @@
 namespace ecs::systems {
 
 bool PhysicsSystem::VoxelOverlapProbe::operator()(const glm::vec3 &center) const {
-    return worldquery::OverlapsSolidForPhysics(world, bsr, center, halfExtents, colliderDisabled);
+    if (colliderDisabled || !voxels) {
+        return false;
+    }
+    return worldquery::OverlapsSolidForPhysics(*voxels, bsr, center, halfExtents);
 }
 
 PhysicsSystem::PhysicsSystem(entt::registry &registry)
@@ -37,9 +46,15 @@ void PhysicsSystem::Update() {
         t.previousPosition = t.position;
     }
 
-    while (m_accumulator >= FixedDt) {
-        Step(FixedDt);
-        m_accumulator -= FixedDt;
+    m_stats.substeps = 0;
+    if (m_accumulator >= FixedDt) {
+        // Nothing else touches the registry between substeps, so gather once and write back once.
+        GatherBodies();
+        while (m_accumulator >= FixedDt) {
+            Step(FixedDt);
+            m_accumulator -= FixedDt;
+        }
+        ScatterBodies();
     }
 
     const float alpha = m_accumulator / FixedDt;
@@ -55,61 +70,248 @@ void PhysicsSystem::Update() {
     }
 }
 
-void PhysicsSystem::Step(float fixedDt) {
-    const World *world = GetWorldPtr(m_registry);
-    if (!world) {
+void PhysicsSystem::RunFixedSteps(int steps) {
+    m_stats.substeps = 0;
+    GatherBodies();
+    for (int i = 0; i < steps; ++i) {
+        Step(FixedDt);
+    }
+    ScatterBodies();
+}
+
+// Wakes sleeping bodies whose box (grown by a block, so the floor under them counts) touches a
+// block written since the last gather.
+void PhysicsSystem::WakeBodiesNearBlockChanges(World &world) {
+    ChunkManager *chunkManager = world.GetChunkManager();
+    if (!chunkManager) {
+        return;
+    }
+    bool overflowed = false;
+    chunkManager->TakeBlockChanges(m_blockChanges, overflowed);
+    if (m_blockChanges.empty() && !overflowed) {
         return;
     }
-    IntegrateEntities(fixedDt, *world);
+
+    for (auto [ent, sleep, t] : m_registry.view<components::PhysicsSleep, components::Transform>().each()) {
+        if (!sleep.asleep) {
+            continue;
+        }
+        bool touched = overflowed;
+        if (!touched) {
+            const auto *col = m_registry.try_get<components::Collider>(ent);
+            const glm::vec3 center = t.position + (col ? col->localOffset : glm::vec3(0.0f));
+            const glm::vec3 half = (col ? col->halfExtents : glm::vec3(0.0f)) + glm::vec3(1.0f);
+            const glm::vec3 lo = center - half;
+            const glm::vec3 hi = center + half;
+            for (const WorldCoord &b : m_blockChanges) {
+                if (b.x + 1 > lo.x && b.x < hi.x && b.y + 1 > lo.y && b.y < hi.y && b.z + 1 > lo.z && b.z < hi.z) {
+                    touched = true;
+                    break;
+                }
+            }
+        }
+        if (touched) {
+            sleep.asleep = false;
+            sleep.stillSteps = 0;
+            ++m_stats.woken;
+        }
+    }
 }
 
-void PhysicsSystem::IntegrateEntities(float dt, const World &world) {
-    const auto *bsr = m_registry.ctx().find<blockstate::BlockStateRegistry>();
+void PhysicsSystem::GatherBodies() {
+    m_mainBodies.clear();
+    m_workerBodies.clear();
+    m_stats.sleeping = 0;
+    m_stats.woken = 0;
+
+    if (World *world = GetWorldPtr(m_registry)) {
+        WakeBodiesNearBlockChanges(*world);
+    }
 
     for (auto [ent, t, v] : m_registry.view<components::Transform, components::Velocity>().each()) {
+        auto *sleepComp = m_registry.try_get<components::PhysicsSleep>(ent);
+        if (sleepComp && sleepComp->asleep) {
+            // Anything that moved or pushed it since (magnet pull, knockback) wakes it up.
+            if (v.linear == glm::vec3(0.0f) && t.position == sleepComp->restPosition) {
+                ++m_stats.sleeping;
+                continue;
+            }
+            sleepComp->asleep = false;
+            sleepComp->stillSteps = 0;
+            ++m_stats.woken;
+        }
+
         const auto *gravityComp = m_registry.try_get<components::Gravity>(ent);
         const auto *stepComp = m_registry.try_get<components::StepPhysics>(ent);
-        auto *groundComp = m_registry.try_get<components::GroundPhysics>(ent);
+        const auto *groundComp = m_registry.try_get<components::GroundPhysics>(ent);
         const auto *flyingComp = m_registry.try_get<components::FlyingPhysics>(ent);
-        auto *col = m_registry.try_get<components::Collider>(ent);
+        const auto *col = m_registry.try_get<components::Collider>(ent);
         auto *ctrl = m_registry.try_get<components::PlayerController>(ent);
 
-        const bool canFly = flyingComp && flyingComp->enabled;
-        const bool isSneaking = ctrl && ctrl->isSneaking();
-
-        if (gravityComp && !canFly) {
-            v.linear += gravityComp->acceleration * dt;
+        BodyState &body = ctrl ? m_mainBodies.emplace_back() : m_workerBodies.emplace_back();
+        body.entity = ent;
+        body.position = t.position;
+        body.velocity = v;
+        body.hasGravity = gravityComp != nullptr;
+        body.gravity = gravityComp ? gravityComp->acceleration : glm::vec3(0.0f);
+        body.hasCollider = col && !col->disabled;
+        if (col) {
+            body.collider = *col;
+        }
+        body.hasStep = stepComp != nullptr;
+        if (stepComp) {
+            body.step = *stepComp;
+        }
+        body.hasGround = groundComp != nullptr;
+        if (groundComp) {
+            body.ground = *groundComp;
+        }
+        body.canFly = flyingComp && flyingComp->enabled;
+        body.sneaking = ctrl && ctrl->isSneaking();
+        body.canSleep = sleepComp != nullptr;
+        if (sleepComp) {
+            body.sleep = *sleepComp;
         }
+    }
+
+    m_stats.bodies = static_cast<uint32_t>(m_mainBodies.size() + m_workerBodies.size());
+}
 
-        if (!canFly) {
-            v.ApplyDamping(dt);
+void PhysicsSystem::ScatterBodies() {
+    const auto writeBack = [this](const BodyState &body) {
+        // patch so on_update listeners (DroppedItemSystem's hash) see the bodies that actually moved.
+        if (m_registry.get<components::Transform>(body.entity).position != body.position) {
+            m_registry.patch<components::Transform>(body.entity, [&](components::Transform &t) {
+                t.setPosition(body.position);
+            });
+        }
+        m_registry.get<components::Velocity>(body.entity) = body.velocity;
+        if (body.hasGround) {
+            m_registry.get<components::GroundPhysics>(body.entity) = body.ground;
+        }
+        if (body.canSleep) {
+            m_registry.get<components::PhysicsSleep>(body.entity) = body.sleep;
         }
+    };
 
-        v.ClampSpeed();
+    for (const BodyState &body : m_mainBodies) {
+        writeBack(body);
+    }
+    for (const BodyState &body : m_workerBodies) {
+        writeBack(body);
+    }
+}
 
-        if (col && !col->disabled) {
-            ResolveAABBAgainstWorld(t, *col, v, dt, world, bsr, stepComp, groundComp, isSneaking);
-        } else {
-            t.setPosition(t.position + v.linear * dt);
+void PhysicsSystem::Step(float fixedDt) {
+    const World *world = GetWorldPtr(m_registry);
+    if (!world) {
+        return;
+    }
+    PROFILE_SCOPE("Physics.Step");
+    ++m_stats.substeps;
+    IntegrateBodies(fixedDt, *world);
+}
+
+void PhysicsSystem::IntegrateBodies(float dt, const World &world) {
+    const auto *bsr = m_registry.ctx().find<blockstate::BlockStateRegistry>();
+
+    // Player bodies: always on the calling thread (input, camera and sneak edge depend on them).
+    {
+        const worldquery::VoxelAccessor voxels(&world);
+        for (BodyState &body : m_mainBodies) {
+            IntegrateBody(dt, body, voxels, bsr);
+        }
+    }
+
+    // Everything else only collides with the voxel world, which nobody writes during the step, so
+    // bodies are independent. Each range gets its own accessor: the chunk cache is not thread safe.
+    const size_t count = m_workerBodies.size();
+    if (m_parallelEnabled && count >= PARALLEL_MIN_BODIES) {
+        oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<size_t>(0, count, BODY_GRAIN),
+            [&](const oneapi::tbb::blocked_range<size_t> &r) {
+                const worldquery::VoxelAccessor voxels(&world);
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    IntegrateBody(dt, m_workerBodies[i], voxels, bsr);
+                }
+            });
+        m_stats.parallelBodies = static_cast<uint32_t>(count);
+    } else {
+        const worldquery::VoxelAccessor voxels(&world);
+        for (BodyState &body : m_workerBodies) {
+            IntegrateBody(dt, body, voxels, bsr);
         }
+        m_stats.parallelBodies = 0;
     }
 }
 
+void PhysicsSystem::IntegrateBody(
+    float dt,
+    BodyState &body,
+    const worldquery::VoxelAccessor &voxels,
+    const blockstate::BlockStateRegistry *bsr
+) const {
+    if (body.sleep.asleep) {
+        return;     // fell asleep in an earlier substep of this gather
+    }
+
+    components::Velocity &v = body.velocity;
+
+    if (body.hasGravity && !body.canFly) {
+        v.linear += body.gravity * dt;
+    }
+
+    if (!body.canFly) {
+        v.ApplyDamping(dt);
+    }
+
+    v.ClampSpeed();
+
+    if (body.hasCollider) {
+        ResolveAABBAgainstWorld(
+            body.position, body.collider, v, dt, voxels, bsr,
+            body.hasStep ? &body.step : nullptr,
+            body.hasGround ? &body.ground : nullptr,
+            body.sneaking
+        );
+    } else {
+        body.position += v.linear * dt;
+    }
+
+    if (body.canSleep) {
+        UpdateSleep(body);
+    }
+}
+
+void PhysicsSystem::UpdateSleep(BodyState &body) const {
+    const bool resting = body.hasGround && body.ground.onGround &&
+        glm::dot(body.velocity.linear, body.velocity.linear) < SLEEP_SPEED * SLEEP_SPEED;
+    if (!resting) {
+        body.sleep.stillSteps = 0;
+        return;
+    }
+    if (++body.sleep.stillSteps < SLEEP_STEPS) {
+        return;
+    }
+    body.sleep.asleep = true;
+    body.sleep.restPosition = body.position;
+    body.velocity.linear = glm::vec3(0.0f);
+}
+
 void PhysicsSystem::ResolveAABBAgainstWorld(
-    components::Transform &t,
-    components::Collider &col,
+    glm::vec3 &position,
+    const components::Collider &col,
     components::Velocity &vel,
     float dt,
-    const World &world,
+    const worldquery::VoxelAccessor &voxels,
     const blockstate::BlockStateRegistry *bsr,
     const components::StepPhysics *stepPhysics,
     components::GroundPhysics *groundPhysics,
     bool isSneaking
-) {
-    glm::vec3 pos = t.position + col.localOffset;
+) const {
+    glm::vec3 pos = position + col.localOffset;
     const glm::vec3 half = col.halfExtents;
 
-    const VoxelOverlapProbe overlaps{&world, bsr, half, col.disabled};
+    const VoxelOverlapProbe overlaps{&voxels, bsr, half, col.disabled};
 
     // ===== VERTICAL =====
     const float dy = vel.linear.y * dt;
@@ -158,7 +360,7 @@ void PhysicsSystem::ResolveAABBAgainstWorld(
         ClampSneakEdge(preHorizPos, pos, vel, overlaps);
     }
 
-    t.setPosition(pos - col.localOffset);
+    position = pos - col.localOffset;
 
     if (groundPhysics) {
         UpdateGroundState(pos, half, vel, overlaps, groundPhysics);
@@ -171,7 +373,7 @@ void PhysicsSystem::UpdateGroundState(
     components::Velocity &vel,
     const VoxelOverlapProbe &overlaps,
     components::GroundPhysics *groundPhysics
-) {
+) const {
     const float feetY = pos.y - halfExtents.y;
     const glm::vec3 groundCheckPos(pos.x, feetY + halfExtents.y - GROUND_PROBE_DISTANCE, pos.z);
 
@@ -281,7 +483,7 @@ bool PhysicsSystem::TryStepUp(
     float dt,
     glm::vec3 &currentPos,
     const VoxelOverlapProbe &overlaps
-) {
+) const {
     const glm::vec3 horizontalDisplacement(vel.linear.x * dt, 0.0f, vel.linear.z * dt);
 
     constexpr int steps = 4;
@@ -309,7 +511,7 @@ void PhysicsSystem::SlideHorizontal(
     components::Velocity &vel,
     float dt,
     const VoxelOverlapProbe &overlaps
-) {
+) const {
     glm::vec3 testPosX = pos;
     testPosX.x += vel.linear.x * dt;
 
@@ -0,0 +1,60 @@
+#include <ASCIICraft/ecs/systems/blockupdate/BlockUpdateQueue.hpp>
+
+#include <algorithm>
+
+namespace ecs::systems {
+
+bool BlockUpdateQueue::Schedule(const WorldCoord& pos, uint64_t dueTick) {
+    const uint64_t key = PackPos(pos);
+    auto [it, inserted] = m_pending.try_emplace(key, Pending{dueTick, m_nextSeq});
+    if (!inserted) {
+        if (it->second.dueTick <= dueTick) {
+            return false;
+        }
+        it->second = Pending{dueTick, m_nextSeq};
+    }
+
+    m_heap.push_back({dueTick, m_nextSeq++, pos});
+    std::push_heap(m_heap.begin(), m_heap.end(), RunsLater{});
+    return true;
+}
+
+size_t BlockUpdateQueue::PopDue(uint64_t tick, size_t budget, std::vector<WorldCoord>& out) {
+    size_t taken = 0;
+    while (!m_heap.empty() && m_heap.front().dueTick <= tick) {
+        const Entry& top = m_heap.front();
+        const auto it = m_pending.find(PackPos(top.pos));
+        const bool live = it != m_pending.end() && it->second.seq == top.seq;
+
+        if (live) {
+            if (taken == budget) {
+                break;
+            }
+            out.push_back(top.pos);
+            m_pending.erase(it);
+            ++taken;
+        }
+        std::pop_heap(m_heap.begin(), m_heap.end(), RunsLater{});
+        m_heap.pop_back();
+    }
+
+    if (m_heap.empty() || m_heap.front().dueTick > tick) {
+        return 0;
+    }
+    return static_cast<size_t>(std::count_if(m_pending.begin(), m_pending.end(),
+        [tick](const auto& entry) { return entry.second.dueTick <= tick; }));
+}
+
+void BlockUpdateQueue::Clear() {
+    m_heap.clear();
+    m_pending.clear();
+}
+
+uint64_t BlockUpdateQueue::PackPos(const WorldCoord& pos) {
+    // 21 bits per axis (two's complement); world coordinates stay far inside +-1M.
+    constexpr uint64_t kMask = (uint64_t(1) << 21) - 1;
+    return (uint64_t(uint32_t(pos.x)) & kMask) | ((uint64_t(uint32_t(pos.y)) & kMask) << 21)
+         | ((uint64_t(uint32_t(pos.z)) & kMask) << 42);
+}
+
+} // namespace ecs::systems
@@ -9,35 +9,19 @@
 #include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
 #include <ASCIICraft/world/block/placement/FencePlacement.hpp>
 #include <ASCIICraft/world/block/state/FaceDir.hpp>
+#include <ASCIICraft/world/query/VoxelAccessor.hpp>
 
 #include <ASCIICraft/ecs/data/ItemRegistry.hpp>
 #include <ASCIICraft/ecs/factories/ItemFactory.hpp>
 
+#include <ASCIIgL/engine/FPSClock.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
+
 #include <glm/vec3.hpp>
 
-namespace {
+#include <algorithm>
 
-void RefreshFenceNeighbors(
-    const blockstate::BlockStateRegistry& bsr,
-    ChunkManager& chunkManager,
-    const WorldCoord& changedPos
-) {
-    for (FaceDir dir : kHorizontalFaceDirs) {
-        const WorldCoord neighborPos = NeighborCoord(changedPos, dir);
-        const uint32_t neighborStateId = chunkManager.GetBlockState(neighborPos);
-        if (!bsr.IsValidState(neighborStateId)) continue;
-
-        const uint16_t neighborTypeId = bsr.GetTypeIdFromState(neighborStateId);
-        const auto& neighborType = bsr.GetType(neighborTypeId);
-        if (!blockplacement::detail::IsFenceTypeName(neighborType.name)) continue;
-
-        const uint32_t finalizedNeighborStateId =
-            blockplacement::detail::FinalizeFencePlacedState(bsr, chunkManager, neighborStateId, neighborPos);
-        if (finalizedNeighborStateId != neighborStateId) {
-            chunkManager.SetBlockState(neighborPos, finalizedNeighborStateId);
-        }
-    }
-}
+namespace {
 
 glm::vec3 BlockDropPosition(const WorldCoord& pos) {
     return glm::vec3(
@@ -56,18 +40,91 @@ namespace ecs::systems {
         , eventBus(eventBus) {}
 
     void BlockUpdateSystem::Update() {
+        const float dt = ASCIIgL::FPSClock::GetInst().GetDeltaTime();
+        constexpr float tickSeconds = 1.0f / static_cast<float>(TICKS_PER_SECOND);
+        constexpr int maxTicksPerUpdate = 5;
+
+        m_stats = Stats{};
+        m_tickAccumulator = std::min(m_tickAccumulator + dt, tickSeconds * maxTicksPerUpdate);
+        while (m_tickAccumulator >= tickSeconds) {
+            m_tickAccumulator -= tickSeconds;
+            ++m_tick;
+            ++m_stats.ticks;
+        }
+
+        World* world = GetWorldPtr(m_registry);
+        ChunkManager* chunkManager = world ? world->GetChunkManager() : nullptr;
+        if (!chunkManager) return;
+
+        // Player edits land this frame; the updates they trigger run right after against the edited world.
         BreakBlockEvents();
         PlaceBlockEvents();
+        FlushWrites(*chunkManager);
+
+        // One budgeted pass per elapsed tick, plus one for updates scheduled with no delay this frame.
+        const int passes = std::max<int>(1, static_cast<int>(m_stats.ticks));
+        for (int i = 0; i < passes && !m_queue.Empty(); ++i) {
+            RunScheduledUpdates(*chunkManager);
+            FlushWrites(*chunkManager);
+        }
+        m_stats.pending = static_cast<uint32_t>(m_queue.Size());
+
+        PROFILE_PLOT("Block updates processed", static_cast<int64_t>(m_stats.processed));
+        PROFILE_PLOT("Block updates deferred", static_cast<int64_t>(m_stats.deferred));
+    }
+
+    void BlockUpdateSystem::ScheduleUpdate(const WorldCoord& pos, uint32_t delayTicks) {
+        m_queue.Schedule(pos, m_tick + delayTicks);
+    }
+
+    void BlockUpdateSystem::ScheduleNeighborUpdates(const WorldCoord& pos, uint32_t delayTicks) {
+        for (FaceDir dir : kAllFaceDirs) {
+            ScheduleUpdate(NeighborCoord(pos, dir), delayTicks);
+        }
+    }
+
+    void BlockUpdateSystem::RunScheduledUpdates(ChunkManager& chunkManager) {
+        PROFILE_SCOPE("BlockUpdate.Scheduled");
+        auto* bsr = m_registry.ctx().find<blockstate::BlockStateRegistry>();
+        if (!bsr) return;
+
+        m_due.clear();
+        m_stats.deferred = static_cast<uint32_t>(m_queue.PopDue(m_tick, MAX_UPDATES_PER_TICK, m_due));
+        m_stats.processed += static_cast<uint32_t>(m_due.size());
+
+        // Reads only: writes wait in m_writes until FlushWrites, so every update in the pass sees
+        // the same world.
+        const worldquery::VoxelAccessor voxels(&chunkManager);
+        for (const WorldCoord& pos : m_due) {
+            const uint32_t stateId = voxels.GetBlockState(pos);
+            if (!bsr->IsValidState(stateId)) continue;
+
+            const auto& type = bsr->GetType(bsr->GetTypeIdFromState(stateId));
+            uint32_t updatedStateId = stateId;
+            if (blockplacement::detail::IsFenceTypeName(type.name)) {
+                updatedStateId = blockplacement::detail::FinalizeFencePlacedState(*bsr, voxels, stateId, pos);
+            }
+
+            if (updatedStateId != stateId) {
+                m_writes.push_back({pos, updatedStateId});
+                // Changes spread one ring per tick; unchanged blocks end the chain.
+                ScheduleNeighborUpdates(pos, 1);
+            }
+        }
+    }
+
+    void BlockUpdateSystem::FlushWrites(ChunkManager& chunkManager) {
+        if (m_writes.empty()) return;
+        m_stats.writes += static_cast<uint32_t>(m_writes.size());
+        m_stats.chunksWritten += static_cast<uint32_t>(chunkManager.SetBlockStates(m_writes));
+        m_writes.clear();
     }
 
     void BlockUpdateSystem::BreakBlockEvents() {
         auto& events = eventBus.view<events::BreakBlockEvent>();
-        World* world = GetWorldPtr(m_registry);
         auto* bsr = m_registry.ctx().find<blockstate::BlockStateRegistry>();
         auto* itemRegistry = m_registry.ctx().find<data::ItemRegistry>();
-        if (!world || !bsr || !itemRegistry) return;
-        ChunkManager* chunkManager = world->GetChunkManager();
-        if (!chunkManager) return;
+        if (!bsr || !itemRegistry) return;
 
         for (auto& e : events) {
             if (e.stateId == blockstate::BlockStateRegistry::AIR_STATE_ID) { continue; }
@@ -76,8 +133,8 @@ namespace ecs::systems {
             const uint16_t typeId = bsr->GetTypeIdFromState(e.stateId);
             const auto& type = bsr->GetType(typeId);
 
-            chunkManager->SetBlockState(e.position, blockstate::BlockStateRegistry::AIR_STATE_ID);
-            RefreshFenceNeighbors(*bsr, *chunkManager, e.position);
+            m_writes.push_back({e.position, blockstate::BlockStateRegistry::AIR_STATE_ID});
+            ScheduleNeighborUpdates(e.position);
 
             // Mining without a sufficient tool breaks the block but yields no drop.
             if (e.harvested && itemRegistry->Resolve(type.name) != entt::null) {
@@ -89,19 +146,15 @@ namespace ecs::systems {
     
     void BlockUpdateSystem::PlaceBlockEvents() {
         auto& events = eventBus.view<events::PlaceBlockEvent>();
-        World* world = GetWorldPtr(m_registry);
-
         auto* bsr = m_registry.ctx().find<blockstate::BlockStateRegistry>();
-        if (!world || !bsr) return;
-        ChunkManager* chunkManager = world->GetChunkManager();
-        if (!chunkManager) return;
+        if (!bsr) return;
 
         for (auto& e : events) {
             if (e.stateId == blockstate::BlockStateRegistry::AIR_STATE_ID) { continue; }
 
             // Event already contains finalized state (orientation applied in PlacingSystem)
-            chunkManager->SetBlockState(e.position, e.stateId);
-            RefreshFenceNeighbors(*bsr, *chunkManager, e.position);
+            m_writes.push_back({e.position, e.stateId});
+            ScheduleNeighborUpdates(e.position);
         }
     }
 }
\ No newline at end of file
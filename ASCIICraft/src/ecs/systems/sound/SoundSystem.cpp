@@ -9,8 +9,13 @@
 #define STB_VORBIS_IMPLEMENTATION
 #include "stb_vorbis.c"
 
+#include <ASCIIgL/engine/FPSClock.hpp>
 #include <ASCIIgL/util/Logger.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
 #include <stdexcept>
 #include <string>
 
@@ -56,19 +61,20 @@ SoundSystem::~SoundSystem()
 
 bool SoundSystem::IsMusicPlaying() const
 {
-    if (m_musicSource == 0) {
-        return false;
-    }
-
-    ALint state = AL_STOPPED;
-    alGetSourcei(m_musicSource, AL_SOURCE_STATE, &state);
-    return state == AL_PLAYING;
+    // A stream counts as playing from Open until its last buffer has played out, so the brief
+    // window before the decoder fills the first buffer does not look like a finished track.
+    return m_musicStream && !m_musicStream->IsFinished();
 }
 
 void SoundSystem::Update()
 {
+    DrainPreloadedBuffers();
     RecycleFinishedSources();
 
+    if (m_musicStream) {
+        m_musicStream->Update();
+    }
+
     const entt::entity player = components::GetPlayerEntity(m_registry);
     if (player != entt::null && m_registry.all_of<components::PlayerCamera>(player)) {
         const ASCIIgL::Camera3D& cam = m_registry.get<components::PlayerCamera>(player).camera;
@@ -86,11 +92,26 @@ void SoundSystem::Update()
     for (const auto& event : m_eventBus.view<events::PlaySoundEvent>()) {
         OnPlaySound(event);
     }
+
+    if (IsLoopback()) {
+        const float dt = ASCIIgL::FPSClock::GetInst().GetDeltaTime();
+        RenderLoopbackFrames(static_cast<int>(dt * static_cast<float>(LOOPBACK_SAMPLE_RATE)));
+    }
 }
 
 void SoundSystem::OnPlaySound(const events::PlaySoundEvent& event)
 {
-    SoundBuffer& buf = LoadSoundId(event.soundId);
+    const std::string path = ResolveSoundPath(event.soundId);
+    if (path.empty()) {
+        return;
+    }
+
+    if (ShouldStream(path)) {
+        PlayStreamedSfx(path, event);
+        return;
+    }
+
+    SoundBuffer& buf = LoadOggByPath(path);
     if (buf.alBuffer == 0) {
         return;
     }
@@ -103,7 +124,13 @@ void SoundSystem::OnPlaySound(const events::PlaySoundEvent& event)
     alSourcei(source, AL_BUFFER, static_cast<ALint>(buf.alBuffer));
     alSourcef(source, AL_GAIN, event.volume);
     alSourcef(source, AL_PITCH, event.pitch);
+    ApplyEmitter(source, event);
 
+    alSourcePlay(source);
+}
+
+void SoundSystem::ApplyEmitter(ALuint source, const events::PlaySoundEvent& event)
+{
     const bool localPlayerStep = event.entity != entt::null
         && m_registry.valid(event.entity)
         && IsStepSoundId(event.soundId)
@@ -124,126 +151,322 @@ void SoundSystem::OnPlaySound(const events::PlaySoundEvent& event)
         alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
         alSourcei(source, AL_SOURCE_RELATIVE, AL_TRUE);
     }
+}
 
-    alSourcePlay(source);
+void SoundSystem::PlayStreamedSfx(const std::string& path, const events::PlaySoundEvent& event)
+{
+    if (static_cast<int>(m_sfxStreams.size()) >= MAX_SFX_STREAMS) {
+        // At stream cap — drop the oldest, like the voice pool steals its oldest voice.
+        m_sfxStreams.erase(m_sfxStreams.begin());
+    }
+
+    auto stream = std::make_unique<sound::StreamingSource>();
+    if (!stream->Open(path)) {
+        return;
+    }
+
+    const ALuint source = stream->GetSource();
+    alSourcef(source, AL_GAIN, event.volume);
+    alSourcef(source, AL_PITCH, event.pitch);
+    ApplyEmitter(source, event);
+    stream->Play();
+    stream->Update();
+
+    m_sfxStreams.push_back(std::move(stream));
 }
 
 void SoundSystem::OnPlayMusic(const events::PlayMusicEvent& event)
 {
-    if (m_musicSource != 0) {
-        ALint state = AL_STOPPED;
-        alGetSourcei(m_musicSource, AL_SOURCE_STATE, &state);
-        if (state == AL_PLAYING) {
-            return;
-        }
+    if (IsMusicPlaying()) {
+        return;
+    }
+    m_musicStream.reset();
 
-        alDeleteSources(1, &m_musicSource);
-        m_musicSource = 0;
+    const std::string path = ResolveSoundPath(event.soundId);
+    if (path.empty()) {
+        ASCIIgL::Logger::Errorf("[SoundSystem] Skipping track, no path for: %s", event.soundId.c_str());
+        return;
     }
 
-    SoundBuffer& buf = LoadSoundId(event.soundId);
-    if (buf.alBuffer == 0) {
-        ASCIIgL::Logger::Errorf("[SoundSystem] Skipping track, buffer is invalid: %s", event.soundId.c_str());
+    // Music always streams: a track is several MB of PCM and would stall the frame that decodes it.
+    auto stream = std::make_unique<sound::StreamingSource>();
+    if (!stream->Open(path)) {
+        ASCIIgL::Logger::Errorf("[SoundSystem] Skipping track, stream failed to open: %s", event.soundId.c_str());
         return;
     }
 
-    alGenSources(1, &m_musicSource);
-    alSourcei(m_musicSource, AL_BUFFER, static_cast<ALint>(buf.alBuffer));
-    alSourcef(m_musicSource, AL_GAIN, event.volume);
-    alSourcei(m_musicSource, AL_SOURCE_RELATIVE, AL_TRUE);
-    alSource3f(m_musicSource, AL_POSITION, 0.0f, 0.0f, 0.0f);
-    alSourcePlay(m_musicSource);
+    const ALuint source = stream->GetSource();
+    alSourcef(source, AL_GAIN, event.volume);
+    alSourcei(source, AL_SOURCE_RELATIVE, AL_TRUE);
+    alSource3f(source, AL_POSITION, 0.0f, 0.0f, 0.0f);
+    stream->Play();
+    m_musicStream = std::move(stream);
 
     ASCIIgL::Logger::Infof("[SoundSystem] Playing music track: %s", event.soundId.c_str());
 }
 
-SoundSystem::SoundBuffer& SoundSystem::LoadSoundId(const std::string& soundId)
+std::string SoundSystem::ResolveSoundPath(const std::string& soundId)
 {
     const auto* soundRegistry = m_registry.ctx().find<sound::SoundRegistry>();
     if (!soundRegistry) {
         ASCIIgL::Logger::Error("[SoundSystem] SoundRegistry missing from registry context");
-        static SoundBuffer empty;
-        return empty;
+        return {};
     }
 
     if (!soundRegistry->Has(soundId)) {
         ASCIIgL::Logger::Errorf("[SoundSystem] Unknown sound id: %s", soundId.c_str());
-        static SoundBuffer empty;
-        return empty;
+        return {};
     }
 
     const std::string path = soundRegistry->PickRandomPath(soundId);
     if (path.empty()) {
         ASCIIgL::Logger::Errorf("[SoundSystem] No paths for sound id: %s", soundId.c_str());
-        static SoundBuffer empty;
-        return empty;
     }
+    return path;
+}
 
-    return LoadOggByPath(path);
+bool SoundSystem::ShouldStream(const std::string& path)
+{
+    auto it = m_streamedPaths.find(path);
+    if (it != m_streamedPaths.end()) {
+        return it->second;
+    }
+
+    std::error_code ec;
+    const std::uintmax_t bytes = std::filesystem::file_size(path, ec);
+    const bool stream = !ec && bytes >= STREAM_MIN_FILE_BYTES;
+    m_streamedPaths.emplace(path, stream);
+    return stream;
 }
 
 SoundSystem::SoundBuffer& SoundSystem::LoadOggByPath(const std::string& path)
 {
     auto it = m_buffers.find(path);
     if (it != m_buffers.end()) {
+        ++m_cacheStats.hits;
+        TouchBuffer(it->second);
         return it->second;
     }
 
+    ++m_cacheStats.misses;
     ASCIIgL::Logger::Infof("[SoundSystem] Loading ogg: %s", path.c_str());
 
-    SoundBuffer buf = DecodeOgg(path);
+    DecodedPcm pcm = DecodeOggPcm(path);
+    RecordDecode(pcm.decodeMs);
+    SoundBuffer buf = UploadPcm(pcm);
     if (buf.alBuffer == 0) {
         ASCIIgL::Logger::Errorf("[SoundSystem] Failed to load ogg from path: %s", path.c_str());
     }
 
-    auto [inserted, _] = m_buffers.emplace(path, buf);
-    return inserted->second;
+    // Failed loads stay cached (0 bytes) so a broken file is not re-decoded on every play.
+    return InsertBuffer(path, buf, true);
 }
 
-SoundSystem::SoundBuffer SoundSystem::DecodeOgg(const std::string& path)
+SoundSystem::DecodedPcm SoundSystem::DecodeOggPcm(const std::string& path)
 {
-    SoundBuffer result;
+    PROFILE_SCOPE("SoundSystem::DecodeOggPcm");
+    const auto start = std::chrono::steady_clock::now();
 
-    int channels = 0;
-    int sampleRate = 0;
-    short* pcmData = nullptr;
+    DecodedPcm result;
+    result.path = path;
 
-    const int sampleCount = stb_vorbis_decode_filename(path.c_str(), &channels, &sampleRate, &pcmData);
+    short* pcmData = nullptr;
+    result.sampleCount = stb_vorbis_decode_filename(path.c_str(), &result.channels, &result.sampleRate, &pcmData);
+    result.samples.reset(pcmData);
 
-    if (sampleCount < 0 || pcmData == nullptr) {
+    if (result.sampleCount < 0 || pcmData == nullptr) {
         ASCIIgL::Logger::Errorf(
             "[SoundSystem] stb_vorbis failed to decode: %s (error code: %d)",
             path.c_str(),
-            sampleCount
+            result.sampleCount
         );
+        result.samples.reset();
+        result.sampleCount = 0;
+    }
+
+    result.decodeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+SoundSystem::SoundBuffer SoundSystem::UploadPcm(DecodedPcm& pcm)
+{
+    SoundBuffer result;
+    if (!pcm.samples) {
         return result;
     }
 
-    const ALenum format = (channels == 1) ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16;
+    const ALenum format = (pcm.channels == 1) ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16;
+    const int byteCount = pcm.sampleCount * pcm.channels * static_cast<int>(sizeof(short));
 
     alGenBuffers(1, &result.alBuffer);
     alBufferData(
         result.alBuffer,
         format,
-        pcmData,
-        sampleCount * channels * static_cast<int>(sizeof(short)),
-        sampleRate
+        pcm.samples.get(),
+        byteCount,
+        pcm.sampleRate
     );
 
     const ALenum alErr = alGetError();
     if (alErr != AL_NO_ERROR) {
-        ASCIIgL::Logger::Errorf("[SoundSystem] alBufferData failed for %s (AL error: %d)", path.c_str(), alErr);
+        ASCIIgL::Logger::Errorf("[SoundSystem] alBufferData failed for %s (AL error: %d)", pcm.path.c_str(), alErr);
         alDeleteBuffers(1, &result.alBuffer);
         result.alBuffer = 0;
+    } else {
+        result.bytes = static_cast<size_t>(byteCount);
     }
 
-    result.channels = channels;
-    result.sampleRate = sampleRate;
+    result.channels = pcm.channels;
+    result.sampleRate = pcm.sampleRate;
 
-    free(pcmData);
+    pcm.samples.reset();
     return result;
 }
 
+void SoundSystem::PreloadRegisteredSounds()
+{
+    const auto* soundRegistry = m_registry.ctx().find<sound::SoundRegistry>();
+    if (!soundRegistry) {
+        ASCIIgL::Logger::Error("[SoundSystem] SoundRegistry missing from registry context");
+        return;
+    }
+
+    std::vector<std::string> paths;
+    for (const std::string& path : soundRegistry->GetAllPaths()) {
+        if (m_buffers.count(path) == 0 && !ShouldStream(path)) {
+            paths.push_back(path);
+        }
+    }
+    if (paths.empty()) {
+        return;
+    }
+
+    m_preloadStart = std::chrono::steady_clock::now();
+    m_cacheStats.preloadPending += paths.size();
+    for (std::string& path : paths) {
+        m_preloadTasks.run([this, path = std::move(path)] {
+            m_preloaded.push(DecodeOggPcm(path));
+        });
+    }
+
+    ASCIIgL::Logger::Infof("[SoundSystem] Preloading %zu sounds on worker threads", m_cacheStats.preloadPending);
+}
+
+void SoundSystem::DrainPreloadedBuffers()
+{
+    DecodedPcm pcm;
+    while (m_preloaded.try_pop(pcm)) {
+        --m_cacheStats.preloadPending;
+        RecordDecode(pcm.decodeMs);
+
+        // A play may have decoded it synchronously while the worker was still busy.
+        if (pcm.samples && m_buffers.count(pcm.path) == 0) {
+            const size_t bytes = static_cast<size_t>(pcm.sampleCount) * pcm.channels * sizeof(short);
+            if (m_cacheStats.residentBytes + bytes > PCM_BUDGET_BYTES) {
+                ++m_cacheStats.preloadsDropped;     // decoded again on first play, like any miss
+            } else {
+                SoundBuffer buf = UploadPcm(pcm);
+                if (buf.alBuffer != 0) {
+                    InsertBuffer(pcm.path, buf, false);
+                }
+            }
+        }
+
+        if (m_cacheStats.preloadPending == 0) {
+            const double wallMs = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - m_preloadStart).count();
+            ASCIIgL::Logger::Infof(
+                "[SoundSystem] Preload done in %.1f ms: %zu buffers, %zu KiB resident (budget %zu KiB), "
+                "%llu dropped over budget, %.1f ms total decode",
+                wallMs, m_cacheStats.residentBuffers, m_cacheStats.residentBytes / 1024,
+                PCM_BUDGET_BYTES / 1024, static_cast<unsigned long long>(m_cacheStats.preloadsDropped),
+                m_cacheStats.totalDecodeMs);
+        }
+    }
+
+    PROFILE_PLOT("Sound PCM resident KiB", static_cast<int64_t>(m_cacheStats.residentBytes / 1024));
+    PROFILE_PLOT("Sound cache hit rate", m_cacheStats.HitRate());
+}
+
+void SoundSystem::RecordDecode(double decodeMs)
+{
+    ++m_cacheStats.decodes;
+    m_cacheStats.totalDecodeMs += decodeMs;
+    m_cacheStats.maxDecodeMs = std::max(m_cacheStats.maxDecodeMs, decodeMs);
+}
+
+SoundSystem::SoundBuffer& SoundSystem::InsertBuffer(const std::string& path, SoundBuffer buf, bool mostRecent)
+{
+    auto [it, inserted] = m_buffers.emplace(path, buf);
+    it->second.lruIt = m_lru.insert(mostRecent ? m_lru.begin() : m_lru.end(), path);
+
+    m_cacheStats.residentBytes += buf.bytes;
+    m_cacheStats.residentBuffers = m_buffers.size();
+    if (mostRecent) {
+        EvictOverBudget(path);
+    }
+    return it->second;
+}
+
+void SoundSystem::TouchBuffer(SoundBuffer& buf)
+{
+    m_lru.splice(m_lru.begin(), m_lru, buf.lruIt);
+}
+
+void SoundSystem::EvictOverBudget(const std::string& keepPath)
+{
+    auto lruIt = m_lru.end();
+    while (m_cacheStats.residentBytes > PCM_BUDGET_BYTES && lruIt != m_lru.begin()) {
+        --lruIt;
+        if (*lruIt == keepPath) {
+            continue;
+        }
+
+        auto bufIt = m_buffers.find(*lruIt);
+        SoundBuffer& buf = bufIt->second;
+        if (buf.alBuffer != 0 && !DetachIfIdle(buf.alBuffer)) {
+            continue;   // still audible; try the next coldest
+        }
+
+        if (buf.alBuffer != 0) {
+            alDeleteBuffers(1, &buf.alBuffer);
+        }
+        m_cacheStats.residentBytes -= buf.bytes;
+        ++m_cacheStats.evictions;
+
+        m_buffers.erase(bufIt);
+        lruIt = m_lru.erase(lruIt);
+    }
+    m_cacheStats.residentBuffers = m_buffers.size();
+}
+
+bool SoundSystem::DetachIfIdle(ALuint alBuffer)
+{
+    // alDeleteBuffers fails on a buffer still attached to any source, even a stopped one.
+    for (ALuint source : m_sources) {
+        ALint attached = 0;
+        alGetSourcei(source, AL_BUFFER, &attached);
+        if (static_cast<ALuint>(attached) != alBuffer) {
+            continue;
+        }
+
+        ALint state = AL_STOPPED;
+        alGetSourcei(source, AL_SOURCE_STATE, &state);
+        if (state == AL_PLAYING || state == AL_PAUSED) {
+            return false;
+        }
+    }
+
+    for (ALuint source : m_sources) {
+        ALint attached = 0;
+        alGetSourcei(source, AL_BUFFER, &attached);
+        if (static_cast<ALuint>(attached) == alBuffer) {
+            alSourcei(source, AL_BUFFER, 0);
+        }
+    }
+    return true;
+}
+
 ALuint SoundSystem::AcquireSource()
 {
     for (ALuint source : m_sources) {
@@ -276,17 +499,76 @@ ALuint SoundSystem::AcquireSource()
 
 void SoundSystem::RecycleFinishedSources()
 {
-    // Voices are reused via AcquireSource(); no eviction needed yet.
+    // Pooled voices are reused via AcquireSource(); streamed SFX own their source and are dropped
+    // once played out. Streams still running get their buffers refilled here.
+    m_sfxStreams.erase(
+        std::remove_if(m_sfxStreams.begin(), m_sfxStreams.end(),
+            [](const std::unique_ptr<sound::StreamingSource>& stream) { return stream->IsFinished(); }),
+        m_sfxStreams.end());
+
+    for (auto& stream : m_sfxStreams) {
+        stream->Update();
+    }
+}
+
+void SoundSystem::RenderLoopbackFrames(int frames)
+{
+    if (!m_renderLoopbackSamples || frames <= 0) {
+        return;
+    }
+
+    frames = std::min(frames, LOOPBACK_SAMPLE_RATE);   // cap at one second after a long stall
+    m_loopbackScratch.resize(static_cast<size_t>(frames) * 2);
+    m_renderLoopbackSamples(m_device, m_loopbackScratch.data(), frames);
 }
 
-void SoundSystem::InitOpenAL()
+bool SoundSystem::OpenLoopbackDevice()
 {
-    m_device = alcOpenDevice(nullptr);
+    if (!alcIsExtensionPresent(nullptr, "ALC_SOFT_loopback")) {
+        return false;
+    }
+
+    auto openLoopback = reinterpret_cast<LPALCLOOPBACKOPENDEVICESOFT>(
+        alcGetProcAddress(nullptr, "alcLoopbackOpenDeviceSOFT"));
+    auto renderSamples = reinterpret_cast<LPALCRENDERSAMPLESSOFT>(
+        alcGetProcAddress(nullptr, "alcRenderSamplesSOFT"));
+    if (!openLoopback || !renderSamples) {
+        return false;
+    }
+
+    m_device = openLoopback(nullptr);
     if (!m_device) {
+        return false;
+    }
+
+    m_renderLoopbackSamples = renderSamples;
+    return true;
+}
+
+void SoundSystem::InitOpenAL()
+{
+    // ASCIICRAFT_AUDIO_DEVICE: unset = default output, "loopback" = ALC_SOFT_loopback (no output,
+    // mixed on demand; used headless), anything else = device name passed to alcOpenDevice.
+    const char* requestedDevice = std::getenv("ASCIICRAFT_AUDIO_DEVICE");
+    const bool wantLoopback = requestedDevice && std::string(requestedDevice) == "loopback";
+
+    if (!wantLoopback) {
+        m_device = alcOpenDevice((requestedDevice && *requestedDevice) ? requestedDevice : nullptr);
+        if (!m_device) {
+            ASCIIgL::Logger::Warning("[SoundSystem] No OpenAL output device; falling back to loopback");
+        }
+    }
+    if (!m_device && !OpenLoopbackDevice()) {
         throw std::runtime_error("SoundSystem: failed to open OpenAL device");
     }
 
-    m_context = alcCreateContext(m_device, nullptr);
+    const ALCint loopbackAttribs[] = {
+        ALC_FORMAT_CHANNELS_SOFT, ALC_STEREO_SOFT,
+        ALC_FORMAT_TYPE_SOFT, ALC_SHORT_SOFT,
+        ALC_FREQUENCY, LOOPBACK_SAMPLE_RATE,
+        0
+    };
+    m_context = alcCreateContext(m_device, IsLoopback() ? loopbackAttribs : nullptr);
     if (!m_context) {
         throw std::runtime_error("SoundSystem: failed to create OpenAL context");
     }
@@ -304,16 +586,16 @@ void SoundSystem::InitOpenAL()
     alListener3f(AL_VELOCITY, 0.0f, 0.0f, 0.0f);
     alListenerf(AL_GAIN, 1.0f);
 
-    ASCIIgL::Logger::Info("[SoundSystem] OpenAL initialized");
+    ASCIIgL::Logger::Info(IsLoopback()
+        ? "[SoundSystem] OpenAL initialized (loopback device)"
+        : "[SoundSystem] OpenAL initialized");
 }
 
 void SoundSystem::ShutdownOpenAL()
 {
-    if (m_musicSource != 0) {
-        alSourceStop(m_musicSource);
-        alDeleteSources(1, &m_musicSource);
-        m_musicSource = 0;
-    }
+    // Streams join their decoder threads and release AL objects; the context must still be current.
+    m_musicStream.reset();
+    m_sfxStreams.clear();
 
     for (ALuint source : m_sources) {
         alSourceStop(source);
@@ -321,12 +603,28 @@ void SoundSystem::ShutdownOpenAL()
     }
     m_sources.clear();
 
+    // Workers only decode into m_preloaded; wait for them before tearing down what they feed.
+    m_preloadTasks.wait();
+    m_preloaded.clear();
+
+    ASCIIgL::Logger::Infof(
+        "[SoundSystem] PCM cache: %zu KiB in %zu buffers, hit rate %.1f%% (%llu hits, %llu misses), "
+        "%llu evictions, %llu decodes (avg %.2f ms, max %.2f ms)",
+        m_cacheStats.residentBytes / 1024, m_cacheStats.residentBuffers, m_cacheStats.HitRate() * 100.0,
+        static_cast<unsigned long long>(m_cacheStats.hits), static_cast<unsigned long long>(m_cacheStats.misses),
+        static_cast<unsigned long long>(m_cacheStats.evictions), static_cast<unsigned long long>(m_cacheStats.decodes),
+        m_cacheStats.decodes ? m_cacheStats.totalDecodeMs / static_cast<double>(m_cacheStats.decodes) : 0.0,
+        m_cacheStats.maxDecodeMs);
+
     for (auto& [id, buf] : m_buffers) {
         if (buf.alBuffer != 0) {
             alDeleteBuffers(1, &buf.alBuffer);
         }
     }
     m_buffers.clear();
+    m_lru.clear();
+    m_cacheStats.residentBytes = 0;
+    m_cacheStats.residentBuffers = 0;
 
     alcMakeContextCurrent(nullptr);
     alcDestroyContext(m_context);
@@ -334,6 +632,7 @@ void SoundSystem::ShutdownOpenAL()
 
     m_context = nullptr;
     m_device  = nullptr;
+    m_renderLoopbackSamples = nullptr;
 
     ASCIIgL::Logger::Info("[SoundSystem] OpenAL shutdown");
 }
@@ -1,6 +1,9 @@
 #include <ASCIICraft/game/Game.hpp>
 #include <ASCIICraft/world/World.hpp>
 
+#include <array>
+#include <chrono>
+
 #include <ASCIIgL/renderer/screen/Screen.hpp>
 #include <ASCIIgL/renderer/Renderer.hpp>
 #include <ASCIIgL/renderer/Palette.hpp>
@@ -17,12 +20,14 @@
 #include <ASCIIgL/util/Logger.hpp>
 #include <ASCIIgL/util/Profiler.hpp>
 
+#include <oneapi/tbb/task_group.h>
 #include <glm/vec2.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
 #include <ASCIICraft/world/block/BlockBreakData.hpp>
 #include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
 #include <ASCIICraft/world/block/state/JsonBlockModelRegistration.hpp>
+#include <ASCIICraft/world/block/models/BakedModelCache.hpp>
 #include <ASCIICraft/world/block/models/JsonModelLoader.hpp>
 #include <ASCIICraft/world/block/state/JsonBlockStateLoader.hpp>
 #include <ASCIICraft/world/block/state/VariantKey.hpp>
@@ -54,6 +59,14 @@
 #include <ASCIICraft/rendering/BlockTargetOutlineShaders.hpp>
 #include <ASCIICraft/rendering/BreakOverlayShaders.hpp>
 
+namespace {
+
+constexpr const char* kVanillaBlockAssetRoot = "res";
+constexpr const char* kBakedModelCachePath = "cache/block_models.bin";
+constexpr size_t kTextureArrayBudgetBytes = size_t(32) << 20;   // per array, whole mip chain
+
+} // namespace
+
 Game::Game()
     : gameState(GameState::Playing)
     , inputSystem(eventBus)
@@ -91,10 +104,22 @@ Game::~Game() {
 
 bool Game::Initialize(bool renderToTerminal, bool multicolor) {
     ASCIIgL::Logger::Info("Initializing ASCIICraft...");
+    ASCIIgL::StartupTimeline::GetInst().Begin();
+
+    // The block-asset hash only reads res/ and overlaps texture decoding; registry and device work
+    // below stays on this thread in dependency order.
+    oneapi::tbb::task_group startupTasks;
+    blockAssetHashReady_ = false;
+    startupTasks.run([this] {
+        PROFILE_STARTUP("Startup::HashBlockAssets");
+        blockAssetHash_ = blockmodels::BakedModelCache::HashAssetTree(kVanillaBlockAssetRoot);
+    });
 
     ASCIIgL::Logger::Debug("Preloading textures for palette generation...");
 
     LoadTextures(multicolor);
+    startupTasks.wait();
+    blockAssetHashReady_ = true;
 
     const std::vector<float> blockPaletteWeights =
         textures::BuildPaletteLayerWeights(blocktextures::GetBlockTextureCatalog());
@@ -107,12 +132,21 @@ bool Game::Initialize(bool renderToTerminal, bool multicolor) {
         {1.0f, ASCIIgL::TextureLibrary::GetInst().GetTextureArray("itemTextureArray"), &itemPaletteWeights},
     };
 
-    std::unique_ptr<ASCIIgL::Palette> gamePalette = multicolor
-        ? std::make_unique<ASCIIgL::Palette>(textureWeights, textureArrayWeights)
-        : std::make_unique<ASCIIgL::MonochromePalette>(textureWeights, textureArrayWeights);
+    std::unique_ptr<ASCIIgL::Palette> gamePalette;
+    {
+        PROFILE_STARTUP("Startup::Palette");
+        gamePalette = multicolor
+            ? std::make_unique<ASCIIgL::Palette>(textureWeights, textureArrayWeights)
+            : std::make_unique<ASCIIgL::MonochromePalette>(textureWeights, textureArrayWeights);
+    }
 
     ASCIIgL::Logger::Debug("Initializing screen...");
-    if (ASCIIgL::Screen::GetInst().Initialize(SCREEN_WIDTH, SCREEN_HEIGHT, L"ASCIICraft", FONT_SIZE, *gamePalette, renderToTerminal) != 0) {
+    int screenStatus = 0;
+    {
+        PROFILE_STARTUP("Startup::Screen");
+        screenStatus = ASCIIgL::Screen::GetInst().Initialize(SCREEN_WIDTH, SCREEN_HEIGHT, L"ASCIICraft", FONT_SIZE, *gamePalette, renderToTerminal);
+    }
+    if (screenStatus != 0) {
         ASCIIgL::Logger::Error("Failed to initialize screen");
         return false;
     }
@@ -144,7 +178,10 @@ bool Game::Initialize(bool renderToTerminal, bool multicolor) {
     renderer.SetCCW(true);
 
     ASCIIgL::Logger::Debug("Initializing renderer...");
-    renderer.Initialize(SUPERSAMPLE_2X);
+    {
+        PROFILE_STARTUP("Startup::Renderer");
+        renderer.Initialize(SUPERSAMPLE_2X);
+    }
     if (!renderer.IsInitialized()) {
         ASCIIgL::Logger::Error("Failed to initialize renderer");
         return false;
@@ -186,6 +223,9 @@ bool Game::Initialize(bool renderToTerminal, bool multicolor) {
 
     gameState = GameState::Playing;
 
+    ASCIIgL::StartupTimeline::GetInst().End();
+    ASCIIgL::Logger::Info("Startup timeline:\n" + ASCIIgL::StartupTimeline::GetInst().FormatReport());
+
     ASCIIgL::Logger::Info("ASCIICraft initialized successfully!");
     return true;
 }
@@ -193,9 +233,43 @@ bool Game::Initialize(bool renderToTerminal, bool multicolor) {
 void Game::Run(std::function<bool()> shouldExternalExit, bool renderToTerminal, bool multicolor) {
     if (!Initialize(renderToTerminal, multicolor)) {
         ASCIIgL::Logger::Error("Failed to initialize game");
+        microbenchFailed_ = !microbench_.empty();
+        return;
+    }
+
+    if (!microbench_.empty()) {
+        RunMicrobench();
+        return;
+    }
+
+    if (!BeginCaptureAndReplay()) {
+        ASCIIgL::Logger::Error("Failed to set up frame capture/replay");
         return;
     }
 
+    if (replayMode_ == ReplayMode::OutputOnly) {
+        RunOutputReplay();
+        return;
+    }
+
+    if (dynamicResolution_ && replayMode_ == ReplayMode::None) {
+        ASCIIgL::FrameBudgetController::Config budget;
+        budget.budgetMs = 1000.0 / TARGET_FPS;
+        frameBudget_.SetConfig(budget);
+        ASCIIgL::Logger::Info("Dynamic resolution enabled (budget " + std::to_string(budget.budgetMs) + " ms).");
+    } else {
+        frameBudget_.SetEnabled(false);
+    }
+
+    if (pipelined_) {
+        if (replayMode_ != ReplayMode::None || !frameCapturePath_.empty()) {
+            ASCIIgL::Logger::Warning("Pipelined mode is disabled during capture/replay (frames must stay in lockstep).");
+        } else {
+            RunPipelined();
+            return;
+        }
+    }
+
     ASCIIgL::Logger::Info("Starting game loop...");
 
     int frameCounter = 0;
@@ -204,31 +278,91 @@ void Game::Run(std::function<bool()> shouldExternalExit, bool renderToTerminal,
         if (ASCIIgL::Screen::GetInst().ShouldExit())
             break;
 
+        if (replayMode_ == ReplayMode::FullPipeline && !BeginReplayFrame()) {
+            FinishReplay();
+            break;
+        }
+
         PROFILE_FRAME_MARK();
         ASCIIgL::FPSClock::GetInst().StartFPSClock();
 
         {
-            PROFILE_SCOPE("Update");
+            PROFILE_STAGE("Update");
             Update();
         }
 
+        if (replayMode_ == ReplayMode::FullPipeline) {
+            ApplyReplayFrameState();
+        }
+
         {
-            PROFILE_SCOPE("RenderGame");
+            PROFILE_STAGE("RenderGame");
             Render();
         }
 
+        // Drops texture array pixels the render thread has uploaded; reloads them if the GPU copy is gone.
+        ASCIIgL::TextureLibrary::GetInst().UpdateResidency();
+
+        CaptureFrame();
+
         eventBus.endFrame();
 
         ASCIIgL::FPSClock::GetInst().EndFPSClock();
+        UpdateFrameBudget();
         frameCounter++;
 
         if (frameCounter % 60 == 0) {
-            ASCIIgL::Logger::Info("FPS: " + std::to_string(ASCIIgL::FPSClock::GetInst().GetFPS()));
+            const ASCIIgL::Renderer::DrawStats draws = ASCIIgL::Renderer::GetInst().GetDrawStats();
+            const ASCIIgL::Renderer::MeshMemoryStats meshMemory = ASCIIgL::Renderer::GetInst().GetMeshMemoryStats();
+            PROFILE_PLOT("Mesh CPU KiB", static_cast<int64_t>(meshMemory.cpuBytes / 1024));
+            PROFILE_PLOT("Mesh GPU KiB", static_cast<int64_t>(meshMemory.gpuBytes / 1024));
+            size_t textureCpuBytes = 0;
+            size_t textureGpuBytes = 0;
+            for (const auto& entry : ASCIIgL::TextureLibrary::GetInst().GetTextureArrayResidency()) {
+                textureCpuBytes += entry.cpuBytes;
+                textureGpuBytes += entry.gpuBytes;
+            }
+            PROFILE_PLOT("Texture array GPU KiB", static_cast<int64_t>(textureGpuBytes / 1024));
+            ASCIIgL::Logger::Info("FPS: " + std::to_string(ASCIIgL::FPSClock::GetInst().GetFPS()) +
+                                  " | changed cells: " +
+                                  std::to_string(ASCIIgL::Screen::GetInst().GetChangedCellRatio() * 100.0f) + "%" +
+                                  " | render scale: " + std::to_string(ASCIIgL::Renderer::GetInst().GetRenderScale()) +
+                                  " | draws: " + std::to_string(draws.draws) +
+                                  " (" + std::to_string(draws.batches) + " batches, " +
+                                  std::to_string(draws.instancedDraws) + " instanced / " +
+                                  std::to_string(draws.instances) + " instances, " +
+                                  std::to_string(draws.stateChanges) + " state changes, " +
+                                  std::to_string(draws.constantUploads) + " CB uploads / " +
+                                  std::to_string(draws.constantBytes) + " B, " +
+                                  std::to_string(draws.bytesAllocated) + " B allocated)" +
+                                  " | mesh KiB CPU/GPU: " + std::to_string(meshMemory.cpuBytes / 1024) + "/" +
+                                  std::to_string(meshMemory.gpuBytes / 1024) +
+                                  " (" + std::to_string(meshMemory.gpuMeshes) + " meshes)" +
+                                  " | tex array KiB CPU/GPU: " + std::to_string(textureCpuBytes / 1024) + "/" +
+                                  std::to_string(textureGpuBytes / 1024));
+
+            const ASCIIgL::Renderer::MeshArenaStats arena = ASCIIgL::Renderer::GetInst().GetMeshArenaStats();
+            if (arena.slabs > 0) {
+                ASCIIgL::Logger::Infof("Mesh arena: %u slabs, %u meshes | VB %zu/%zu KiB, IB %zu/%zu KiB | "
+                                       "%u free blocks, fragmentation VB %.0f%% IB %.0f%% | %u buffer binds",
+                                       arena.slabs, arena.meshes,
+                                       arena.vertexBytesUsed / 1024, arena.vertexBytesCapacity / 1024,
+                                       arena.indexBytesUsed / 1024, arena.indexBytesCapacity / 1024,
+                                       arena.freeBlocks, arena.vertexFragmentation * 100.0f,
+                                       arena.indexFragmentation * 100.0f, draws.meshBufferBinds);
+            }
             frameCounter = 0;
         }
     }   
 }
 
+void Game::UpdateFrameBudget() {
+    if (!frameBudget_.IsEnabled()) return;
+    if (frameBudget_.Update(ASCIIgL::FPSClock::GetInst().GetFrameWorkTime())) {
+        ASCIIgL::Renderer::GetInst().SetRenderScale(frameBudget_.GetRenderScale());
+    }
+}
+
 void Game::Update() {
     const bool guiBlocking = guiManager.IsBlockingInput();
     const auto mode = guiBlocking ? input::InputMode::GUI : input::InputMode::Gameplay;
@@ -302,7 +436,7 @@ void Game::Update() {
 void Game::Render() {
 
     {
-        PROFILE_SCOPE("Clear Px Buff/Begin GPU Frame");
+        PROFILE_STAGE("Clear Px Buff/Begin GPU Frame");
         ASCIIgL::Screen::GetInst().ClearPixelBuffer();
         ASCIIgL::Renderer::GetInst().BeginGpuFrame();
     }
@@ -311,7 +445,7 @@ void Game::Render() {
     switch (gameState) {
         case GameState::Playing:
             {
-                PROFILE_SCOPE("Render.RenderPlaying");
+                PROFILE_STAGE("Render.RenderPlaying");
                  RenderPlaying();
             }
             break;
@@ -319,22 +453,22 @@ void Game::Render() {
 
     // Execute queued GPU draws in two passes (opaque, then transparent)
     {
-        PROFILE_SCOPE("Render.FlushDraws");
+        PROFILE_STAGE("Render.FlushDraws");
         ASCIIgL::Renderer::GetInst().FlushDraws();  
     }
 
     {
-        PROFILE_SCOPE("Render.EndGpuFrame");
+        PROFILE_STAGE("Render.EndGpuFrame");
         ASCIIgL::Renderer::GetInst().EndGpuFrame();
     }
 
     {
-        PROFILE_SCOPE("Render.PixelBufferDraws");
+        PROFILE_STAGE("Render.PixelBufferDraws");
         ASCIIgL::Renderer::GetInst().DrawScreenBorderPxBuff(0xF);
     }
 
     {
-        PROFILE_SCOPE("Render.PixelBufferOutput");
+        PROFILE_STAGE("Render.PixelBufferOutput");
         ASCIIgL::Screen::GetInst().OutputBuffer();
     }
 }
@@ -347,6 +481,11 @@ void Game::Shutdown() {
 
     ASCIIgL::Logger::Info("Shutting down ASCIICraft...");
 
+    // The render thread reads materials and mesh caches; finish its frame before releasing them.
+    framePipeline_.Stop();
+
+    frameCaptureWriter_.Close();
+
     ASCIIgL::InputManager::GetInst().Shutdown();
 
     // Clear libraries if we want to release all resources on shutdown
@@ -418,61 +557,107 @@ bool Game::LoadTextures(bool multicolor) {
         blockPerTileMono[static_cast<size_t>(fernLayer)].brightness = 1.3f;
     }
 
-    auto blockTextureArray = ASCIIgL::TextureLibrary::GetInst().LoadTextureArray(
-        blockTexturePaths, "terrainTextureArray", monoMap, blockPerTileMono);
-    if (!blockTextureArray || !blockTextureArray->IsValid()) {
-        ASCIIgL::Logger::Error("Failed to load block texture array");
-        return false;   
+    // A tile can never cover more texels than the render target is wide, so levels finer than that
+    // are never sampled; large resource packs are clamped on load and the CPU copies dropped after upload.
+    {
+        int renderWidth = SCREEN_WIDTH * (SUPERSAMPLE_2X ? 2 : 1);
+        int maxTile = 1;
+        while (maxTile < renderWidth) maxTile *= 2;
+
+        ASCIIgL::TextureArray::ResidencyPolicy residency;
+        residency.maxTileSize = maxTile;
+        residency.budgetBytes = kTextureArrayBudgetBytes;
+        residency.releaseCpuAfterUpload = true;
+        ASCIIgL::TextureLibrary::GetInst().SetTextureArrayResidency(residency);
     }
 
-    std::vector<std::string> itemTexturePaths =
-        textures::BuildTexturePaths(itemtextures::GetItemTextureCatalog());
-    auto itemTextureArray = ASCIIgL::TextureLibrary::GetInst().LoadTextureArray(itemTexturePaths, "itemTextureArray", monoMap);
-    if (!itemTextureArray || !itemTextureArray->IsValid()) {
-        ASCIIgL::Logger::Error("Failed to load item texture array");
-        return false;
-    }
+    // The four groups below are independent: decode them concurrently (each array also decodes its
+    // tiles in parallel). TextureLibrary only serializes its map updates.
+    const auto loadBlockTextures = [&] {
+        PROFILE_STARTUP("Startup::BlockTextures");
+        auto blockTextureArray = ASCIIgL::TextureLibrary::GetInst().LoadTextureArray(
+            blockTexturePaths, "terrainTextureArray", monoMap, blockPerTileMono);
+        if (!blockTextureArray || !blockTextureArray->IsValid()) {
+            ASCIIgL::Logger::Error("Failed to load block texture array");
+            return false;
+        }
+        return true;
+    };
 
-    auto inventoryTexture = ASCIIgL::TextureLibrary::GetInst().LoadTexture(
-        "res/textures/gui/container/inventory.png", "inventoryTexture", ASCIIgL::MonochromeMapping{}
-    );
-    if (!inventoryTexture) {
-        ASCIIgL::Logger::Error("Failed to load inventory texture");
-        return false;
-    }
+    const auto loadItemTextures = [&] {
+        PROFILE_STARTUP("Startup::ItemTextures");
+        std::vector<std::string> itemTexturePaths =
+            textures::BuildTexturePaths(itemtextures::GetItemTextureCatalog());
+        auto itemTextureArray = ASCIIgL::TextureLibrary::GetInst().LoadTextureArray(itemTexturePaths, "itemTextureArray", monoMap);
+        if (!itemTextureArray || !itemTextureArray->IsValid()) {
+            ASCIIgL::Logger::Error("Failed to load item texture array");
+            return false;
+        }
+        return true;
+    };
 
-    auto widgetsTexture = ASCIIgL::TextureLibrary::GetInst().LoadTexture(
-        "res/textures/gui/widgets.png", "widgetsTexture", ASCIIgL::MonochromeMapping{}
-    );
-    if (!widgetsTexture) {
-        ASCIIgL::Logger::Error("Failed to load widgets texture");
-        return false;
-    }
+    const auto loadGuiTextures = [&] {
+        PROFILE_STARTUP("Startup::GuiTextures");
+        auto inventoryTexture = ASCIIgL::TextureLibrary::GetInst().LoadTexture(
+            "res/textures/gui/container/inventory.png", "inventoryTexture", ASCIIgL::MonochromeMapping{}
+        );
+        if (!inventoryTexture) {
+            ASCIIgL::Logger::Error("Failed to load inventory texture");
+            return false;
+        }
 
-    auto cursorTexture = ASCIIgL::TextureLibrary::GetInst().LoadTexture(
-        "res/textures/gui/cursor.png", "cursorTexture", ASCIIgL::MonochromeMapping{}
-    );
-    if (!cursorTexture) {
-        ASCIIgL::Logger::Error("Failed to load cursor texture");
-        return false;
-    }
+        auto widgetsTexture = ASCIIgL::TextureLibrary::GetInst().LoadTexture(
+            "res/textures/gui/widgets.png", "widgetsTexture", ASCIIgL::MonochromeMapping{}
+        );
+        if (!widgetsTexture) {
+            ASCIIgL::Logger::Error("Failed to load widgets texture");
+            return false;
+        }
 
-    constexpr int kFontGlyphTileSize = 8; // Minecraft default font atlas uses 8x8 glyph cells.
-    auto fontTextureArray = ASCIIgL::TextureLibrary::GetInst().LoadTextureArray(
-        "res/font/default.png",
-        kFontGlyphTileSize,
-        "defaultFontTextureArray",
-        monoMap
-    );
-    if (!fontTextureArray || !fontTextureArray->IsValid()) {
-        ASCIIgL::Logger::Error("Failed to load default bitmap font texture atlas");
-        return false;
+        auto cursorTexture = ASCIIgL::TextureLibrary::GetInst().LoadTexture(
+            "res/textures/gui/cursor.png", "cursorTexture", ASCIIgL::MonochromeMapping{}
+        );
+        if (!cursorTexture) {
+            ASCIIgL::Logger::Error("Failed to load cursor texture");
+            return false;
+        }
+        return true;
+    };
+
+    const auto loadFontAtlas = [&] {
+        PROFILE_STARTUP("Startup::FontAtlas");
+        constexpr int kFontGlyphTileSize = 8; // Minecraft default font atlas uses 8x8 glyph cells.
+        auto fontTextureArray = ASCIIgL::TextureLibrary::GetInst().LoadTextureArray(
+            "res/font/default.png",
+            kFontGlyphTileSize,
+            "defaultFontTextureArray",
+            monoMap
+        );
+        if (!fontTextureArray || !fontTextureArray->IsValid()) {
+            ASCIIgL::Logger::Error("Failed to load default bitmap font texture atlas");
+            return false;
+        }
+        return true;
+    };
+
+    std::array<bool, 4> loaded{};
+    oneapi::tbb::task_group textureTasks;
+    textureTasks.run([&] { loaded[0] = loadBlockTextures(); });
+    textureTasks.run([&] { loaded[1] = loadItemTextures(); });
+    textureTasks.run([&] { loaded[2] = loadGuiTextures(); });
+    textureTasks.run([&] { loaded[3] = loadFontAtlas(); });
+    textureTasks.wait();
+
+    for (const auto& entry : ASCIIgL::TextureLibrary::GetInst().GetTextureArrayResidency()) {
+        ASCIIgL::Logger::Infof("Texture array %s: %d layers at %dpx, %zu KiB CPU resident",
+                               entry.name.c_str(), entry.layerCount, entry.tileSize, entry.cpuBytes / 1024);
     }
 
-    return true;
+    return loaded[0] && loaded[1] && loaded[2] && loaded[3];
 }
 
 bool Game::LoadResources() {
+    PROFILE_STARTUP("Startup::Materials");
     ASCIIgL::Logger::Info("Loading game resources...");
 
     if (!LoadTerrainMaterial())      return false;
@@ -494,7 +679,7 @@ bool Game::LoadTerrainMaterial() {
         "blockMaterial",
         TerrainShaders::GetTerrainVSSource(),
         TerrainShaders::GetTerrainPSSource(),
-        ASCIIgL::VertFormats::PosUVLayer(),
+        ASCIIgL::VertFormats::PosUVLayerLight(),
         TerrainShaders::GetTerrainPSUniformLayout(),
         true,
         [](ASCIIgL::Material& material) {
@@ -543,6 +728,35 @@ bool Game::LoadDroppedItemMaterial() {
         return false;
     }
     iconMaterial->SetTextureArray(0, itemTextureArray.get());
+
+    // Instanced twins; EntityRenderSystem batches entities that share a mesh onto these.
+    if (!ASCIIgL::BuildAndRegisterMaterial({
+        "droppedItemBlockMaterialInstanced",
+        DroppedItemShaders::GetInstancedVSSource(),
+        DroppedItemShaders::GetInstancedPSSource(),
+        ASCIIgL::VertFormats::PosUVLayerInstanced(),
+        DroppedItemShaders::GetInstancedUniformLayout(),
+        true,
+        [](ASCIIgL::Material& material) {
+            auto terrainTextureArray = ASCIIgL::TextureLibrary::GetInst().GetTextureArray("terrainTextureArray");
+            if (!terrainTextureArray) {
+                ASCIIgL::Logger::Error("terrainTextureArray missing for instanced dropped item block material");
+                return false;
+            }
+            material.SetTextureArray(0, terrainTextureArray.get());
+            return true;
+        }
+    })) {
+        return false;
+    }
+
+    auto iconInstancedMaterial = ASCIIgL::MaterialLibrary::GetInst().GetOrCreateFromTemplate(
+        "droppedItemBlockMaterialInstanced", "droppedItemMaterialInstanced");
+    if (!iconInstancedMaterial) {
+        ASCIIgL::Logger::Error("Failed to create droppedItemMaterialInstanced from template");
+        return false;
+    }
+    iconInstancedMaterial->SetTextureArray(0, itemTextureArray.get());
     return true;
 }
 
@@ -686,6 +900,7 @@ bool Game::LoadBreakOverlayMaterial() {
 }
 
 bool Game::LoadFont() {
+    PROFILE_STARTUP("Startup::Font");
     constexpr int kDefaultFontStartingLayer = 33;
     constexpr const char* kDefaultFontCharacters =
         R"(!"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~)";
@@ -710,11 +925,13 @@ void Game::RenderPlaying() {
     // blockTargetSystem.Render(); // Outline rendering disabled for now.
     breakOverlayRenderSystem.Render();
     entityRenderSystem.Render();
+    particleSystem.Render();
     heldItemRenderSystem.Render();
     guiManager.Render();
 }
 
 void Game::InitializeWorld() {
+    PROFILE_STARTUP("Startup::World");
     WorldParams worldParams{};
     worldParams.spawnPoint = WorldCoord(0, 120, 0);
     worldParams.renderDistance = 12;
@@ -724,17 +941,20 @@ void Game::InitializeWorld() {
 }
 
 void Game::InitializePlayer() {
+    PROFILE_STARTUP("Startup::Player");
     playerFactory.createPlayerEnt(GetWorldPtr(registry)->GetSpawnPoint().ToVec3(), GameMode::Survival);
     ASCIIgL::Logger::Debug("Player entity created");
 }
 
 void Game::InitializeSystems() {
+    PROFILE_STARTUP("Startup::Systems");
     ASCIIgL::Logger::Debug("Initializing systems...");
 
     entt::entity player = ecs::components::GetPlayerEntity(registry);
     if (player != entt::null) {
         auto* playerCamera = registry.try_get<ecs::components::PlayerCamera>(player);
         entityRenderSystem.SetActive3DCamera(playerCamera);
+        particleSystem.SetActive3DCamera(playerCamera);
     }
 
     heldItemRenderSystem.SetViewModelCamera(heldItemViewCamera.get());
@@ -746,11 +966,13 @@ void Game::InitializeSystems() {
     auto& soundRegistry = registry.ctx().emplace<sound::SoundRegistry>();
     sound::RegisterDefaultSounds(soundRegistry);
     registry.ctx().emplace<sound::BlockSoundMap>();
+    soundSystem.PreloadRegisteredSounds();
 
     ASCIIgL::Logger::Debug("Systems initialized.");
 }
 
 void Game::InitializeGUI() {
+    PROFILE_STARTUP("Startup::GUI");
     ASCIIgL::Logger::Debug("Initializing GUI screens...");
     guiManager.BuildCursorSurface();
 
@@ -784,6 +1006,7 @@ void Game::InitializeGUI() {
 }
 
 void Game::InitializeBlockStates() {
+    PROFILE_STARTUP("Startup::BlockStates");
     auto& bsr = registry.ctx().emplace<blockstate::BlockStateRegistry>();
     auto& modelLibrary = registry.ctx().emplace<blockmodels::BlockModelLibrary>();
 
@@ -797,25 +1020,15 @@ void Game::InitializeBlockStates() {
         s.isRenderable = false;
         s.isTransparent = true;
         s.renderMode = blockstate::RenderMode::Translucent;
+        s.lightFilter = 0;
     });
     modelLibrary.RegisterModel(airType, nullptr, bsr);
 
-    static constexpr const char* kVanillaBlockAssetRoot = "res";
-    blockstate::JsonBlockStateLoader blockstateLoader(kVanillaBlockAssetRoot);
-    blockmodels::JsonModelLoader jsonModelLoader(kVanillaBlockAssetRoot);
-
+    // JSON-backed models are installed once every type is registered (see InstallJsonBackedBlockModels),
+    // so a current baked cache can replace the whole load/resolve/bake pass.
+    std::vector<std::string> jsonBackedTypes;
     const auto registerJsonBackedOrLog = [&](const char* typeName) {
-        if (!blockstate::RegisterJsonBackedBlockType(
-                typeName,
-                bsr,
-                modelLibrary,
-                blockstateLoader,
-                jsonModelLoader
-            )) {
-            ASCIIgL::Logger::Error(
-                std::string("Game::InitializeBlockStates: JSON model registration failed for ") + typeName
-            );
-        }
+        jsonBackedTypes.emplace_back(typeName);
     };
 
     const auto registerOpaqueJsonBacked = [&](const char* typeName) {
@@ -832,6 +1045,7 @@ void Game::InitializeBlockStates() {
         s.isRenderable = true;
         s.isTransparent = false;
         s.renderMode = blockstate::RenderMode::Cutout;
+        s.lightFilter = 0;
         s.isFullBlock = false;
         s.cullSameType = false;
     });
@@ -843,6 +1057,7 @@ void Game::InitializeBlockStates() {
         s.isRenderable = true;
         s.isTransparent = false;
         s.renderMode = blockstate::RenderMode::Cutout;
+        s.lightFilter = 0;
         s.isFullBlock = false;
         s.cullSameType = false;
     });
@@ -854,6 +1069,7 @@ void Game::InitializeBlockStates() {
         s.isRenderable = true;
         s.isTransparent = false;
         s.renderMode = blockstate::RenderMode::Cutout;
+        s.lightFilter = 0;
         s.isFullBlock = false;
         s.cullSameType = false;
     });
@@ -865,6 +1081,7 @@ void Game::InitializeBlockStates() {
         s.isRenderable = true;
         s.isTransparent = false;
         s.renderMode = blockstate::RenderMode::Cutout;
+        s.lightFilter = 0;
         s.isFullBlock = false;
         s.cullSameType = false;
     });
@@ -882,6 +1099,7 @@ void Game::InitializeBlockStates() {
         s.isRenderable = true;
         s.isTransparent = false;
         s.renderMode = blockstate::RenderMode::Cutout;
+        s.lightFilter = 0;
         s.isFullBlock = false;
         s.cullSameType = false;
     });
@@ -987,6 +1205,7 @@ void Game::InitializeBlockStates() {
         s.isRenderable = true;
         s.isTransparent = false;                  // treat as cutout, not blended
         s.renderMode = blockstate::RenderMode::Cutout;
+        s.lightFilter = 1;                        // dims light a little per block
         s.cullSameType = false;                   // draw faces between leaves (fuller look)
     });
     registerJsonBackedOrLog("minecraft:oak_leaves");
@@ -1000,8 +1219,9 @@ void Game::InitializeBlockStates() {
         blockstate::BlockProperty{ "lit", { "false", "true" }, 0 },
     });
     const uint16_t furnaceType = bsr.GetTypeId("minecraft:furnace");
-    bsr.SetDerivedData(furnaceType, [](blockstate::BlockState& s) {
+    bsr.SetDerivedData(furnaceType, [&](blockstate::BlockState& s) {
         s.renderMode = blockstate::RenderMode::Opaque;
+        s.lightEmission = (bsr.GetPropertyValue(s.stateId, "lit") == "true") ? 13 : 0;
     });
     registerJsonBackedOrLog("minecraft:furnace");
 
@@ -1020,6 +1240,7 @@ void Game::InitializeBlockStates() {
     bsr.SetDerivedData(glassType, [&](blockstate::BlockState& s) {
         s.isTransparent = true;
         s.renderMode = blockstate::RenderMode::Cutout;
+        s.lightFilter = 0;
     });
     registerJsonBackedOrLog("minecraft:glass");
 
@@ -1046,6 +1267,7 @@ void Game::InitializeBlockStates() {
         s.isRenderable = true;
         s.isTransparent = true;
         s.renderMode = blockstate::RenderMode::Translucent;
+        s.lightFilter = 2;  // light fades with depth
         s.isFullBlock = !(bsr.GetPropertyValue(s.stateId, "top") == "true");
     });
     const auto& waterTypeDef = bsr.GetType(waterType);
@@ -1066,6 +1288,7 @@ void Game::InitializeBlockStates() {
         s.isRenderable = true;
         s.isTransparent = false;
         s.renderMode = blockstate::RenderMode::Cutout;
+        s.lightFilter = 0;
         s.isFullBlock = false;
         s.cullSameType = false;
     });
@@ -1080,6 +1303,7 @@ void Game::InitializeBlockStates() {
         s.isRenderable = true;
         s.isTransparent = false;
         s.renderMode = blockstate::RenderMode::Cutout;
+        s.lightFilter = 0;
         s.isFullBlock = false;
         s.cullSameType = false;
     });
@@ -1094,11 +1318,14 @@ void Game::InitializeBlockStates() {
         s.isRenderable = true;
         s.isTransparent = false;
         s.renderMode = blockstate::RenderMode::Cutout;
+        s.lightFilter = 0;
         s.isFullBlock = false;
         s.cullSameType = false;
     });
     registerJsonBackedOrLog("minecraft:potatoes");
 
+    InstallJsonBackedBlockModels(jsonBackedTypes);
+
     for (uint16_t tid = 0; tid < bsr.GetTotalTypeCount(); ++tid) {
         blockstate::AssertUniqueVariantKeysPerType(bsr, tid, "Game::InitializeBlockStates");
     }
@@ -1112,7 +1339,98 @@ void Game::InitializeBlockStates() {
         std::to_string(bsr.GetTotalStateCount()) + " states registered.");
 }
 
+void Game::InstallJsonBackedBlockModels(const std::vector<std::string>& typeNames) {
+    using Clock = std::chrono::steady_clock;
+    const auto elapsedMs = [](Clock::time_point from) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - from).count();
+    };
+
+    auto& bsr = registry.ctx().get<blockstate::BlockStateRegistry>();
+    auto& modelLibrary = registry.ctx().get<blockmodels::BlockModelLibrary>();
+
+    // The asset hash normally comes precomputed from the startup task that overlaps texture loading.
+    const Clock::time_point hashStart = Clock::now();
+    const blockmodels::BakedModelCache::Key key{
+        blockAssetHashReady_ ? blockAssetHash_ : blockmodels::BakedModelCache::HashAssetTree(kVanillaBlockAssetRoot),
+        blockmodels::BakedModelCache::ComputeRegistrySignature(bsr, typeNames)
+    };
+    const double hashMs = elapsedMs(hashStart);
+
+    // Warm start: map the blob and install the baked model sets directly.
+    const Clock::time_point warmStart = Clock::now();
+    blockmodels::BakedModelCache::InstallStats stats;
+    if (blockmodels::BakedModelCache::TryInstall(kBakedModelCachePath, key, typeNames, bsr, modelLibrary, &stats)) {
+        const double installMs = elapsedMs(warmStart);
+        ASCIIgL::Logger::Infof(
+            "[BlockModelCache] warm start: %zu states, %zu unique models (%zu KiB) installed in %.1f ms "
+            "+ %.1f ms asset hash; cold JSON bake took %.1f ms",
+            stats.stateCount, stats.modelCount, stats.blobBytes / 1024, installMs, hashMs, stats.coldBuildMs);
+        return;
+    }
+
+    // Cold start: load, resolve and bake every JSON-backed type, then refresh the cache.
+    const Clock::time_point coldStart = Clock::now();
+    blockstate::JsonBlockStateLoader blockstateLoader(kVanillaBlockAssetRoot);
+    blockmodels::JsonModelLoader jsonModelLoader(kVanillaBlockAssetRoot);
+
+    // File reads and JSON parsing fan out across workers into the loader caches; the registration
+    // pass below (registry + model library mutation) stays serial and only hits the caches.
+    size_t prefetchedModels = 0;
+    {
+        PROFILE_STARTUP("Startup::PrefetchBlockJson");
+        blockstateLoader.PrefetchBlockstates(typeNames);
+
+        std::vector<std::string> modelIds;
+        for (const std::string& typeName : typeNames) {
+            auto blockstateRes = blockstateLoader.GetOrLoadBlockstate(typeName);
+            if (!blockstateRes.Ok()) continue;
+            for (const auto& [variantKey, refs] : blockstateRes.value->variants) {
+                for (const blockstate::VariantModelRef& ref : refs) {
+                    modelIds.push_back(ref.model.ToString());
+                }
+            }
+        }
+        prefetchedModels = jsonModelLoader.PrefetchBlockModels(modelIds);
+    }
+    ASCIIgL::Logger::Debugf("[BlockModelCache] prefetched %zu block models in %.1f ms",
+                            prefetchedModels, elapsedMs(coldStart));
+
+    PROFILE_STARTUP("Startup::RegisterBlockModels");
+    bool allOk = true;
+    for (const std::string& typeName : typeNames) {
+        if (!blockstate::RegisterJsonBackedBlockType(
+                typeName,
+                bsr,
+                modelLibrary,
+                blockstateLoader,
+                jsonModelLoader
+            )) {
+            ASCIIgL::Logger::Error(
+                "Game::InitializeBlockStates: JSON model registration failed for " + typeName
+            );
+            allOk = false;
+        }
+    }
+    const double coldMs = elapsedMs(coldStart);
+
+    if (!allOk) {
+        ASCIIgL::Logger::Infof(
+            "[BlockModelCache] cold start: JSON bake of %zu types took %.1f ms; cache not written (registration errors)",
+            typeNames.size(), coldMs);
+        return;
+    }
+
+    const Clock::time_point writeStart = Clock::now();
+    const size_t written = blockmodels::BakedModelCache::Write(
+        kBakedModelCachePath, key, typeNames, bsr, modelLibrary, coldMs);
+    ASCIIgL::Logger::Infof(
+        "[BlockModelCache] cold start: JSON bake of %zu types took %.1f ms + %.1f ms asset hash; "
+        "wrote %zu KiB to %s in %.1f ms",
+        typeNames.size(), coldMs, hashMs, written / 1024, kBakedModelCachePath, elapsedMs(writeStart));
+}
+
 void Game::InitializeItemDefinitions() {
+    PROFILE_STARTUP("Startup::ItemDefinitions");
     auto& itemRegistry = registry.ctx().emplace<ecs::data::ItemRegistry>();
 
     const auto itemLayer = [](const char* textureId) -> float {
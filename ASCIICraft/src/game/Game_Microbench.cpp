@@ -0,0 +1,1216 @@
+#include <ASCIICraft/game/Game.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+
+#include <ASCIIgL/engine/MipFilters.hpp>
+#include <ASCIIgL/engine/MonochromeMapping.hpp>
+#include <ASCIIgL/engine/TextureLibrary.hpp>
+#include <ASCIIgL/renderer/Material.hpp>
+#include <ASCIIgL/util/CpuFeatures.hpp>
+#include <ASCIIgL/util/EventBus.hpp>
+#include <ASCIIgL/util/Logger.hpp>
+
+#include <ASCIICraft/ecs/components/DroppedItemTag.hpp>
+#include <ASCIICraft/ecs/components/Inventory.hpp>
+#include <ASCIICraft/ecs/components/Lifetime.hpp>
+#include <ASCIICraft/ecs/components/PhysicsBody.hpp>
+#include <ASCIICraft/ecs/components/Pickup.hpp>
+#include <ASCIICraft/ecs/components/PlayerTag.hpp>
+#include <ASCIICraft/ecs/components/Transform.hpp>
+#include <ASCIICraft/ecs/systems/DroppedItemSystem.hpp>
+#include <ASCIICraft/ecs/data/SpatialHash.hpp>
+#include <ASCIICraft/world/World.hpp>
+#include <ASCIICraft/world/chunk/ChunkUtil.hpp>
+#include <ASCIICraft/world/light/LightEngine.hpp>
+#include <ASCIICraft/world/query/VoxelAccessor.hpp>
+#include <ASCIICraft/world/query/VoxelOverlap.hpp>
+#include <ASCIICraft/world/terrain/TerrainGenerator.hpp>
+#include <ASCIICraft/world/terrain/TerrainResult.hpp>
+
+// Microbenchmarks for hot paths that a frame replay cannot isolate. Each runs after Initialize
+// (so real materials, registries and the world exist), logs one report and the game exits.
+// Select with --microbench <name>; "all" runs every benchmark.
+
+namespace {
+
+using BenchClock = std::chrono::steady_clock;
+
+double NsPerIter(BenchClock::time_point start, BenchClock::time_point end, size_t iterations) {
+    return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+}
+
+/// Pumps world streaming until the chunk holding the spawn point has terrain (or ~10 s passed);
+/// benchmarks that touch voxels run before the first game frame.
+void WaitForSpawnChunk(World& world) {
+    const ChunkCoord spawnChunk = world.GetSpawnPoint().ToChunkCoord();
+    const auto deadline = BenchClock::now() + std::chrono::seconds(10);
+    for (;;) {
+        const Chunk* chunk = world.GetChunkManager()->FindChunk(spawnChunk);
+        if ((chunk && chunk->IsGenerated()) || BenchClock::now() >= deadline) {
+            return;
+        }
+        world.Update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+}
+
+/// Top of the first physics-solid voxel in column (x, z) at or below \p fromY, searching 96 blocks.
+bool FindSurface(const worldquery::VoxelAccessor& voxels, const blockstate::BlockStateRegistry* bsr,
+                 float x, float z, int fromY, float& outTop) {
+    const int bx = static_cast<int>(std::floor(x));
+    const int bz = static_cast<int>(std::floor(z));
+    for (int y = fromY; y > fromY - 96; --y) {
+        if (blockquery::IsSolidForPhysics(bsr, voxels.GetBlockState(bx, y, bz))) {
+            outTop = static_cast<float>(y + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+/// The EventBus before dense type ids (type_index map of virtual buffers, full clear every frame),
+/// kept as the baseline for the event_bus benchmark.
+class MapEventBus {
+public:
+    template<typename T>
+    void emit(T&& event) {
+        using U = std::decay_t<T>;
+        auto key = std::type_index(typeid(U));
+        auto it = m_events.find(key);
+        if (it == m_events.end()) {
+            it = m_events.emplace(key, std::make_unique<Buffer<U>>()).first;
+        }
+        static_cast<Buffer<U>*>(it->second.get())->data.emplace_back(std::forward<T>(event));
+    }
+
+    template<typename T>
+    std::vector<T>& view() {
+        auto it = m_events.find(std::type_index(typeid(T)));
+        if (it == m_events.end()) {
+            static std::vector<T> empty;
+            return empty;
+        }
+        return static_cast<Buffer<T>*>(it->second.get())->data;
+    }
+
+    void endFrame() {
+        for (auto& [type, buffer] : m_events) {
+            (void)type;
+            buffer->clear();
+        }
+    }
+
+private:
+    struct IBuffer {
+        virtual ~IBuffer() = default;
+        virtual void clear() = 0;
+    };
+    template<typename T>
+    struct Buffer : IBuffer {
+        std::vector<T> data;
+        void clear() override { data.clear(); }
+    };
+    std::unordered_map<std::type_index, std::unique_ptr<IBuffer>> m_events;
+};
+
+/// Distinct event types of game-event size (an entity, a position, a payload word).
+template<int N>
+struct BenchEvent {
+    uint32_t entity;
+    float x, y, z;
+    int payload;
+};
+
+} // namespace
+
+void Game::RunMicrobench() {
+    ASCIIgL::Logger::Info("Running microbenchmark '" + microbench_ + "'.");
+
+    const bool all = microbench_ == "all";
+    bool ran = false;
+    bool passed = true;
+    const auto run = [&](const char* name, bool (Game::*bench)()) {
+        if (all || microbench_ == name) {
+            passed = (this->*bench)() && passed;
+            ran = true;
+        }
+    };
+    run("uniforms", &Game::BenchUniformUpdates);
+    run("texture_kernels", &Game::BenchTextureKernels);
+    run("collision", &Game::BenchCollision);
+    run("physics", &Game::BenchPhysicsScaling);
+    run("spatial_hash", &Game::BenchSpatialHash);
+    run("dropped_items", &Game::BenchDroppedItems);
+    run("event_bus", &Game::BenchEventBus);
+    run("feature_apply", &Game::BenchFeatureApply);
+    run("light", &Game::BenchLight);
+    run("texture_residency", &Game::BenchTextureResidency);
+
+    if (!ran) {
+        ASCIIgL::Logger::Error("Unknown microbenchmark '" + microbench_ + "' (expected: uniforms, texture_kernels, collision, physics, spatial_hash, dropped_items, event_bus, feature_apply, light, texture_residency, all).");
+    }
+    microbenchFailed_ = !ran || !passed;
+}
+
+// Per-draw uniform update cost for blockMaterial, the way ChunkManager::RenderChunks drives it:
+// mvp, cameraPos, fogParams, fogColor and waterAnimPhase every frame, then the seal-time pack.
+// "by name" is the string API (hash into _uniformValues + layout lookup per call); "by handle"
+// resolves once and writes the staging block directly. Upload volume (dirty registers only) is
+// reported live as "CB uploads / N B" in the periodic frame log.
+bool Game::BenchUniformUpdates() {
+    auto mat = ASCIIgL::MaterialLibrary::GetInst().Get("blockMaterial");
+    if (!mat) {
+        ASCIIgL::Logger::Error("[Microbench] uniforms: blockMaterial not found.");
+        return false;
+    }
+
+    constexpr size_t kIterations = 200000;
+    const glm::vec4 fogParams(48.0f, 64.0f, 0.0f, 0.0f);
+    const glm::vec3 fogColor(0.6f, 0.75f, 1.0f);
+    // Camera drifts a little each iteration so mvp/cameraPos really change, fog does not.
+    const auto cameraAt = [](size_t i) { return glm::vec3(static_cast<float>(i) * 0.01f, 70.0f, 0.0f); };
+    const auto mvpAt = [](size_t i) {
+        glm::mat4 m(1.0f);
+        m[3][0] = static_cast<float>(i) * 0.01f;
+        return m;
+    };
+
+    const auto byNameStart = BenchClock::now();
+    for (size_t i = 0; i < kIterations; ++i) {
+        mat->SetMatrix4("mvp", mvpAt(i));
+        mat->SetFloat3("cameraPos", cameraAt(i));
+        mat->SetFloat4("fogParams", fogParams);
+        mat->SetFloat3("fogColor", fogColor);
+        if (mat->HasUniform("waterAnimPhase")) {
+            mat->SetFloat("waterAnimPhase", static_cast<float>(i));
+        }
+        mat->UpdateConstantBufferData();
+    }
+    const auto byNameEnd = BenchClock::now();
+
+    const ASCIIgL::UniformHandle mvp = mat->GetUniformHandle("mvp");
+    const ASCIIgL::UniformHandle cameraPos = mat->GetUniformHandle("cameraPos");
+    const ASCIIgL::UniformHandle fog = mat->GetUniformHandle("fogParams");
+    const ASCIIgL::UniformHandle fogCol = mat->GetUniformHandle("fogColor");
+    const ASCIIgL::UniformHandle water = mat->GetUniformHandle("waterAnimPhase");
+
+    const auto byHandleStart = BenchClock::now();
+    for (size_t i = 0; i < kIterations; ++i) {
+        mat->Set(mvp, mvpAt(i));
+        mat->Set(cameraPos, cameraAt(i));
+        mat->Set(fog, fogParams);
+        mat->Set(fogCol, fogColor);
+        mat->Set(water, static_cast<float>(i));
+        mat->UpdateConstantBufferData();
+    }
+    const auto byHandleEnd = BenchClock::now();
+
+    const double byName = NsPerIter(byNameStart, byNameEnd, kIterations);
+    const double byHandle = NsPerIter(byHandleStart, byHandleEnd, kIterations);
+    ASCIIgL::Logger::Infof("[Microbench] uniforms: %zu iterations, 5 uniforms each | by name %.1f ns | by handle %.1f ns | %.1fx",
+                           kIterations, byName, byHandle, byHandle > 0.0 ? byName / byHandle : 0.0);
+    return true;
+}
+
+// Load-time pixel kernels: BoxFilter (one mip step) and the monochrome bake, scalar reference
+// versus the dispatched SSE2/AVX2 path, on random 64x64 tiles. Also the equivalence check: the box
+// filter must match exactly and the mono bake within 1 LSB per channel, else the report is an error.
+bool Game::BenchTextureKernels() {
+    constexpr int kTile = 64;
+    constexpr int kTiles = 512;
+    constexpr size_t kTileBytes = static_cast<size_t>(kTile) * kTile * 4;
+
+    std::vector<uint8_t> source(kTileBytes * kTiles);
+    std::mt19937 rng(1234);
+    for (uint8_t& byte : source) byte = static_cast<uint8_t>(rng() & 0xFF);
+
+    ASCIIgL::MonochromeMapping mono;
+    mono.enabled = true;
+    mono.darkL = 0.02f;
+    mono.lightL = 0.7f;
+    mono.hueDir = glm::ivec3(255, 204, 136);
+    mono.brightness = 1.3f;
+
+    const ASCIIgL::SimdLevel level = ASCIIgL::GetSimdLevel();
+    std::vector<uint8_t> reference(kTileBytes / 4 * kTiles);
+    std::vector<uint8_t> vectorized(reference.size());
+
+    const auto boxScalarStart = BenchClock::now();
+    for (int t = 0; t < kTiles; ++t) {
+        ASCIIgL::MipFilters::BoxFilterScalar(source.data() + kTileBytes * t, kTile, kTile,
+                                             reference.data() + kTileBytes / 4 * t, kTile / 2, kTile / 2);
+    }
+    const auto boxVectorStart = BenchClock::now();
+    for (int t = 0; t < kTiles; ++t) {
+        ASCIIgL::MipFilters::BoxFilter(source.data() + kTileBytes * t, kTile, kTile,
+                                       vectorized.data() + kTileBytes / 4 * t, kTile / 2, kTile / 2);
+    }
+    const auto boxEnd = BenchClock::now();
+
+    int boxMaxDiff = 0;
+    for (size_t i = 0; i < reference.size(); ++i) {
+        boxMaxDiff = std::max(boxMaxDiff, std::abs(reference[i] - vectorized[i]));
+    }
+
+    reference = source;
+    vectorized = source;
+    const auto monoScalarStart = BenchClock::now();
+    for (int t = 0; t < kTiles; ++t) {
+        ASCIIgL::ApplyMonochromeMappingRGBA8Scalar(reference.data() + kTileBytes * t, kTile, kTile, mono);
+    }
+    const auto monoVectorStart = BenchClock::now();
+    for (int t = 0; t < kTiles; ++t) {
+        ASCIIgL::ApplyMonochromeMappingRGBA8(vectorized.data() + kTileBytes * t, kTile, kTile, mono);
+    }
+    const auto monoEnd = BenchClock::now();
+
+    int monoMaxDiff = 0;
+    for (size_t i = 0; i < reference.size(); ++i) {
+        monoMaxDiff = std::max(monoMaxDiff, std::abs(reference[i] - vectorized[i]));
+    }
+
+    const size_t pixels = static_cast<size_t>(kTile) * kTile * kTiles;
+    const double boxScalar = NsPerIter(boxScalarStart, boxVectorStart, pixels / 4);
+    const double boxVector = NsPerIter(boxVectorStart, boxEnd, pixels / 4);
+    const double monoScalar = NsPerIter(monoScalarStart, monoVectorStart, pixels);
+    const double monoVector = NsPerIter(monoVectorStart, monoEnd, pixels);
+    ASCIIgL::Logger::Infof("[Microbench] texture_kernels (%s): %d tiles %dx%d | box filter %.2f -> %.2f ns/px (%.1fx) | "
+                           "mono %.2f -> %.2f ns/px (%.1fx)",
+                           ASCIIgL::ToString(level), kTiles, kTile, kTile,
+                           boxScalar, boxVector, boxVector > 0.0 ? boxScalar / boxVector : 0.0,
+                           monoScalar, monoVector, monoVector > 0.0 ? monoScalar / monoVector : 0.0);
+
+    if (boxMaxDiff != 0 || monoMaxDiff > 1) {
+        ASCIIgL::Logger::Errorf("[Microbench] texture_kernels: %s path diverges from scalar (box max diff %d, mono max diff %d LSB)",
+                                ASCIIgL::ToString(level), boxMaxDiff, monoMaxDiff);
+        return false;
+    }
+    return true;
+}
+
+// Entity collision steps against the real spawn terrain. One "step" is the probe pattern of
+// PhysicsSystem::ResolveAABBAgainstWorld for a falling, walking player-sized collider: vertical
+// sweep, two horizontal sweeps (each with an 8-probe binary search on contact) and the ground probe.
+// "map" reads every voxel through World::GetBlockState behind a std::function (hash lookup per
+// cell, the pre-VoxelAccessor path); "accessor" shares one VoxelAccessor per step, as physics does.
+bool Game::BenchCollision() {
+    World* world = GetWorldPtr(registry);
+    const auto* bsr = registry.ctx().find<blockstate::BlockStateRegistry>();
+    if (!world || !world->GetChunkManager() || !bsr) {
+        ASCIIgL::Logger::Error("[Microbench] collision: world or block state registry missing.");
+        return false;
+    }
+
+    WaitForSpawnChunk(*world);
+    const WorldCoord spawn = world->GetSpawnPoint();
+
+    constexpr size_t kEntities = 2000;
+    constexpr int kSteps = 30;
+    constexpr int kSearchProbes = 8;
+    const glm::vec3 half(0.3f, 0.9f, 0.3f);
+    const glm::vec3 fallStep(0.0f, -0.3f, 0.0f);
+    const glm::vec3 walkX(0.15f, 0.0f, 0.0f);
+    const glm::vec3 walkZ(0.0f, 0.0f, 0.15f);
+
+    // Drop entities just above the first solid voxel under the spawn height (or leave them in the air).
+    std::vector<glm::vec3> centers(kEntities);
+    size_t grounded = 0;
+    {
+        const worldquery::VoxelAccessor voxels(world);
+        std::mt19937 rng(99);
+        std::uniform_real_distribution<float> offset(-24.0f, 24.0f);
+        std::uniform_real_distribution<float> hover(0.0f, 2.0f);
+        for (glm::vec3& c : centers) {
+            c = glm::vec3(static_cast<float>(spawn.x) + offset(rng), static_cast<float>(spawn.y),
+                          static_cast<float>(spawn.z) + offset(rng));
+            float top = 0.0f;
+            if (FindSurface(voxels, bsr, c.x, c.z, spawn.y, top)) {
+                c.y = top + half.y + hover(rng);
+                ++grounded;
+            }
+        }
+    }
+
+    size_t queries = 0;
+    const auto sweep = [&](const auto& voxels, const glm::vec3& pos, const glm::vec3& delta) {
+        ++queries;
+        if (!worldquery::OverlapsSolidForPhysics(voxels, bsr, pos + delta, half)) {
+            return 1u;
+        }
+        float lo = 0.0f;
+        float hi = 1.0f;
+        for (int i = 0; i < kSearchProbes; ++i) {
+            const float mid = 0.5f * (lo + hi);
+            ++queries;
+            (worldquery::OverlapsSolidForPhysics(voxels, bsr, pos + delta * mid, half) ? hi : lo) = mid;
+        }
+        return 0u;
+    };
+    const auto step = [&](const auto& voxels, const glm::vec3& pos) {
+        unsigned bits = sweep(voxels, pos, fallStep);
+        bits += sweep(voxels, pos, walkX) << 1;
+        bits += sweep(voxels, pos, walkZ) << 2;
+        ++queries;
+        bits += worldquery::OverlapsSolidForPhysics(voxels, bsr, pos + glm::vec3(0.0f, -0.05f, 0.0f), half) ? 8u : 0u;
+        return bits;
+    };
+
+    uint64_t mapChecksum = 0;
+    const worldquery::BlockStateGetter mapGetter = [world](int x, int y, int z) { return world->GetBlockState(x, y, z); };
+    const auto mapStart = BenchClock::now();
+    for (int s = 0; s < kSteps; ++s) {
+        for (const glm::vec3& c : centers) {
+            mapChecksum = mapChecksum * 31 + step(mapGetter, c);
+        }
+    }
+    const auto mapEnd = BenchClock::now();
+    const size_t queriesPerRun = queries;
+
+    uint64_t accessorChecksum = 0;
+    uint32_t chunkLookups = 0;
+    const auto accessorStart = BenchClock::now();
+    for (int s = 0; s < kSteps; ++s) {
+        const worldquery::VoxelAccessor voxels(world);
+        for (const glm::vec3& c : centers) {
+            accessorChecksum = accessorChecksum * 31 + step(voxels, c);
+        }
+        chunkLookups += voxels.GetChunkLookups();
+    }
+    const auto accessorEnd = BenchClock::now();
+
+    const size_t steps = kEntities * kSteps;
+    const double mapNs = NsPerIter(mapStart, mapEnd, steps);
+    const double accessorNs = NsPerIter(accessorStart, accessorEnd, steps);
+    ASCIIgL::Logger::Infof("[Microbench] collision: %zu entities (%zu grounded) x %d steps, %.1f overlap queries/step | "
+                           "map %.0f ns (%.2fM steps/s) | accessor %.0f ns (%.2fM steps/s) | %.1fx | %u chunk lookups",
+                           kEntities, grounded, kSteps, static_cast<double>(queriesPerRun) / static_cast<double>(steps),
+                           mapNs, mapNs > 0.0 ? 1e3 / mapNs : 0.0,
+                           accessorNs, accessorNs > 0.0 ? 1e3 / accessorNs : 0.0,
+                           accessorNs > 0.0 ? mapNs / accessorNs : 0.0, chunkLookups);
+
+    if (mapChecksum != accessorChecksum) {
+        ASCIIgL::Logger::Error("[Microbench] collision: accessor results differ from World::GetBlockState.");
+        return false;
+    }
+    return true;
+}
+
+// PhysicsSystem fixed steps with 1k and 10k dropped-item bodies (ItemFactory's collider, gravity
+// and ground components) raining onto the spawn terrain: serial reference versus the TBB pass.
+// Both runs start from the same state and must end in exactly the same positions. A last pass
+// repeats the scene with PhysicsSleep to show the cost once the items have settled.
+bool Game::BenchPhysicsScaling() {
+    World* world = GetWorldPtr(registry);
+    const auto* bsr = registry.ctx().find<blockstate::BlockStateRegistry>();
+    if (!world || !world->GetChunkManager() || !bsr) {
+        ASCIIgL::Logger::Error("[Microbench] physics: world or block state registry missing.");
+        return false;
+    }
+    WaitForSpawnChunk(*world);
+    const WorldCoord spawn = world->GetSpawnPoint();
+
+    constexpr int kSteps = 60;      // two seconds of fixed ticks: falling, landing, sliding, resting
+    constexpr float kColliderHalf = 0.125f;
+    bool passed = true;
+
+    for (const size_t count : {size_t(1000), size_t(10000)}) {
+        struct InitialState {
+            entt::entity entity;
+            glm::vec3 position;
+            glm::vec3 velocity;
+        };
+        std::vector<InitialState> bodies;
+        bodies.reserve(count);
+
+        {
+            const worldquery::VoxelAccessor voxels(world);
+            std::mt19937 rng(7);
+            std::uniform_real_distribution<float> offset(-32.0f, 32.0f);
+            std::uniform_real_distribution<float> drop(1.0f, 6.0f);
+            std::uniform_real_distribution<float> toss(-2.0f, 2.0f);
+            for (size_t i = 0; i < count; ++i) {
+                glm::vec3 pos(static_cast<float>(spawn.x) + offset(rng), static_cast<float>(spawn.y),
+                              static_cast<float>(spawn.z) + offset(rng));
+                float top = 0.0f;
+                if (FindSurface(voxels, bsr, pos.x, pos.z, spawn.y, top)) {
+                    pos.y = top + drop(rng);
+                }
+                const glm::vec3 vel(toss(rng), 2.0f + toss(rng), toss(rng));
+
+                const entt::entity e = registry.create();
+                registry.emplace<ecs::components::Transform>(e).setPosition(pos);
+                registry.emplace<ecs::components::Velocity>(e).linear = vel;
+                auto& collider = registry.emplace<ecs::components::Collider>(e);
+                collider.halfExtents = glm::vec3(kColliderHalf);
+                registry.emplace<ecs::components::Gravity>(e);
+                registry.emplace<ecs::components::GroundPhysics>(e);
+                bodies.push_back({e, pos, vel});
+            }
+        }
+
+        const auto reset = [&] {
+            for (const InitialState& b : bodies) {
+                registry.get<ecs::components::Transform>(b.entity).setPosition(b.position);
+                registry.get<ecs::components::Velocity>(b.entity).linear = b.velocity;
+                registry.get<ecs::components::GroundPhysics>(b.entity).onGround = false;
+            }
+        };
+
+        ecs::systems::PhysicsSystem physics(registry);
+
+        reset();
+        physics.SetParallelEnabled(false);
+        const auto serialStart = BenchClock::now();
+        physics.RunFixedSteps(kSteps);
+        const auto serialEnd = BenchClock::now();
+
+        std::vector<glm::vec3> serialPositions;
+        serialPositions.reserve(count);
+        for (const InitialState& b : bodies) {
+            serialPositions.push_back(registry.get<ecs::components::Transform>(b.entity).position);
+        }
+
+        reset();
+        physics.SetParallelEnabled(true);
+        const auto parallelStart = BenchClock::now();
+        physics.RunFixedSteps(kSteps);
+        const auto parallelEnd = BenchClock::now();
+
+        float maxDiff = 0.0f;
+        size_t resting = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const glm::vec3 d = registry.get<ecs::components::Transform>(bodies[i].entity).position - serialPositions[i];
+            maxDiff = std::max({maxDiff, std::abs(d.x), std::abs(d.y), std::abs(d.z)});
+            resting += registry.get<ecs::components::GroundPhysics>(bodies[i].entity).onGround ? 1 : 0;
+        }
+
+        const double serialMs = std::chrono::duration<double, std::milli>(serialEnd - serialStart).count() / kSteps;
+        const double parallelMs = std::chrono::duration<double, std::milli>(parallelEnd - parallelStart).count() / kSteps;
+        ASCIIgL::Logger::Infof("[Microbench] physics: %zu bodies (%zu resting after %d steps, %u on workers) | "
+                               "serial %.3f ms/step | parallel %.3f ms/step | %.2fx on %u threads",
+                               count, resting, kSteps, physics.GetStats().parallelBodies,
+                               serialMs, parallelMs, parallelMs > 0.0 ? serialMs / parallelMs : 0.0,
+                               std::thread::hardware_concurrency());
+        if (maxDiff != 0.0f) {
+            ASCIIgL::Logger::Errorf("[Microbench] physics: parallel pass diverges from serial (max %.6f blocks)", maxDiff);
+            passed = false;
+        }
+
+        // Same scene with PhysicsSleep (as ItemFactory attaches it): settle once, then time the
+        // resting steps, where bodies that came to rest are skipped instead of integrated.
+        for (const InitialState& b : bodies) {
+            registry.emplace<ecs::components::PhysicsSleep>(b.entity);
+        }
+        physics.RunFixedSteps(kSteps);
+        const auto restStart = BenchClock::now();
+        physics.RunFixedSteps(kSteps);
+        const auto restEnd = BenchClock::now();
+
+        const double restMs = std::chrono::duration<double, std::milli>(restEnd - restStart).count() / kSteps;
+        ASCIIgL::Logger::Infof("[Microbench] physics: %zu bodies with sleep, %u asleep after settling | "
+                               "%.3f ms/step | %.1fx vs awake parallel",
+                               count, physics.GetStats().sleeping, restMs, restMs > 0.0 ? parallelMs / restMs : 0.0);
+
+        for (const InitialState& b : bodies) {
+            registry.destroy(b.entity);
+        }
+    }
+    return passed;
+}
+
+// The queries DroppedItemSystem runs per frame, over 50k dropped items scattered across a
+// 256 x 256 area: hash maintenance (full rebuild vs the incremental per-frame sync after a small
+// drift), player pickup (magnet radius around a point) and stack-merge neighbourhoods (the 1 x 0.5
+// x 1 box per item). "scan" is the full-view walk each query used to be; both must agree.
+bool Game::BenchSpatialHash() {
+    using namespace ecs::components;
+
+    constexpr size_t kItems = 50000;
+    constexpr float kExtent = 128.0f;
+    constexpr int kPickupQueries = 1000;
+    constexpr int kMergeQueries = 2000;
+    const glm::vec3 mergeReach(0.5f, 0.25f, 0.5f);
+
+    std::vector<entt::entity> items;
+    items.reserve(kItems);
+    {
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> horizontal(-kExtent, kExtent);
+        std::uniform_real_distribution<float> height(60.0f, 70.0f);
+        for (size_t i = 0; i < kItems; ++i) {
+            const entt::entity e = registry.create();
+            registry.emplace<DroppedItemTag>(e);
+            registry.emplace<Transform>(e).setPosition(glm::vec3(horizontal(rng), height(rng), horizontal(rng)));
+            registry.emplace<Pickup>(e);
+            items.push_back(e);
+        }
+    }
+    auto view = registry.view<DroppedItemTag, Transform>();
+
+    ecs::data::SpatialHash hash;
+
+    const auto rebuildStart = BenchClock::now();
+    hash.Clear();
+    hash.BeginSync();
+    for (auto e : view) hash.Update(e, view.get<Transform>(e).position);
+    hash.EndSync();
+    const auto rebuildEnd = BenchClock::now();
+
+    {
+        std::mt19937 rng(12);
+        std::uniform_real_distribution<float> drift(-0.1f, 0.1f);
+        for (auto e : items) {
+            auto& t = registry.get<Transform>(e);
+            t.setPosition(t.position + glm::vec3(drift(rng), drift(rng), drift(rng)));
+        }
+    }
+    const auto syncStart = BenchClock::now();
+    hash.BeginSync();
+    for (auto e : view) hash.Update(e, view.get<Transform>(e).position);
+    hash.EndSync();
+    const auto syncEnd = BenchClock::now();
+    const uint32_t moves = hash.GetStats().moves;
+
+    std::vector<glm::vec3> centers;
+    {
+        std::mt19937 rng(13);
+        std::uniform_real_distribution<float> horizontal(-kExtent, kExtent);
+        std::uniform_real_distribution<float> height(60.0f, 70.0f);
+        for (int i = 0; i < kPickupQueries; ++i) {
+            centers.emplace_back(horizontal(rng), height(rng), horizontal(rng));
+        }
+    }
+    const float radius = Pickup{}.magnetRadius;
+    const float radiusSq = radius * radius;
+
+    size_t scanHits = 0;
+    const auto pickupScanStart = BenchClock::now();
+    for (const glm::vec3& c : centers) {
+        for (auto e : view) {
+            const glm::vec3 d = view.get<Transform>(e).position - c;
+            scanHits += glm::dot(d, d) <= radiusSq ? 1 : 0;
+        }
+    }
+    const auto pickupScanEnd = BenchClock::now();
+
+    size_t hashHits = 0;
+    const auto pickupHashStart = BenchClock::now();
+    for (const glm::vec3& c : centers) {
+        hash.QueryRadius(c, radius, [&](entt::entity, const glm::vec3&) { ++hashHits; });
+    }
+    const auto pickupHashEnd = BenchClock::now();
+
+    // Merge neighbourhoods: the scan is O(n) per item, so time a sample and report per query.
+    size_t mergeScanHits = 0;
+    const auto mergeScanStart = BenchClock::now();
+    for (int i = 0; i < kMergeQueries; ++i) {
+        const glm::vec3 p = registry.get<Transform>(items[i]).position;
+        for (auto e : view) {
+            const glm::vec3 d = glm::abs(view.get<Transform>(e).position - p);
+            mergeScanHits += (e != items[i] && d.x <= mergeReach.x && d.y <= mergeReach.y && d.z <= mergeReach.z) ? 1 : 0;
+        }
+    }
+    const auto mergeScanEnd = BenchClock::now();
+
+    size_t mergeHashHits = 0;
+    const auto mergeHashStart = BenchClock::now();
+    for (int i = 0; i < kMergeQueries; ++i) {
+        const glm::vec3 p = registry.get<Transform>(items[i]).position;
+        hash.QueryAabb(p - mergeReach, p + mergeReach, [&](entt::entity e, const glm::vec3&) {
+            mergeHashHits += e != items[i] ? 1 : 0;
+        });
+    }
+    const auto mergeHashEnd = BenchClock::now();
+
+    const auto ms = [](BenchClock::time_point a, BenchClock::time_point b) {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    };
+    const double pickupScanUs = NsPerIter(pickupScanStart, pickupScanEnd, kPickupQueries) / 1000.0;
+    const double pickupHashUs = NsPerIter(pickupHashStart, pickupHashEnd, kPickupQueries) / 1000.0;
+    const double mergeScanUs = NsPerIter(mergeScanStart, mergeScanEnd, kMergeQueries) / 1000.0;
+    const double mergeHashUs = NsPerIter(mergeHashStart, mergeHashEnd, kMergeQueries) / 1000.0;
+
+    ASCIIgL::Logger::Infof("[Microbench] spatial_hash: %zu items in %u cells | rebuild %.3f ms | sync %.3f ms (%u cell moves)",
+                           kItems, hash.GetStats().cells, ms(rebuildStart, rebuildEnd), ms(syncStart, syncEnd), moves);
+    ASCIIgL::Logger::Infof("[Microbench] spatial_hash: pickup r=%.1f | scan %.2f us | hash %.2f us | %.1fx (%.2f hits/query)",
+                           radius, pickupScanUs, pickupHashUs, pickupHashUs > 0.0 ? pickupScanUs / pickupHashUs : 0.0,
+                           static_cast<double>(hashHits) / kPickupQueries);
+    ASCIIgL::Logger::Infof("[Microbench] spatial_hash: merge box | scan %.2f us | hash %.2f us | %.1fx (%.2f neighbours/item)",
+                           mergeScanUs, mergeHashUs, mergeHashUs > 0.0 ? mergeScanUs / mergeHashUs : 0.0,
+                           static_cast<double>(mergeHashHits) / kMergeQueries);
+    if (scanHits != hashHits || mergeScanHits != mergeHashHits) {
+        ASCIIgL::Logger::Errorf("[Microbench] spatial_hash: hash disagrees with scan (pickup %zu vs %zu, merge %zu vs %zu)",
+                                hashHits, scanHits, mergeHashHits, mergeScanHits);
+    }
+    const bool passed = scanHits == hashHits && mergeScanHits == mergeHashHits;
+
+    for (auto e : items) {
+        registry.destroy(e);
+    }
+    return passed;
+}
+
+// DroppedItemSystem::Update over 50k settled items with a player in the middle, in a private
+// registry: "full" is the per-frame walk over every item (hash sync, pickup delays, lifetime), the
+// "queued" path only touches what registry signals reported. Each frame 1% of the items move the
+// way PhysicsSystem's write-back does (patch) and every 10th frame a few expire. Both runs must end
+// with the same items, and each hash must hold exactly the live items at their current positions.
+bool Game::BenchDroppedItems() {
+    using namespace ecs::components;
+
+    constexpr size_t kItems = 50000;
+    constexpr float kExtent = 128.0f;
+    constexpr int kFrames = 120;
+    constexpr size_t kMovingPerFrame = kItems / 100;
+    constexpr size_t kExpiringPerTenFrames = 20;
+    constexpr float kDt = 1.0f / 60.0f;
+
+    struct Result {
+        double msPerFrame = 0.0;
+        size_t liveItems = 0;
+        size_t delayedItems = 0;
+        bool hashExact = true;
+    };
+
+    const auto runScene = [&](bool fullSync) {
+        entt::registry sceneRegistry;
+        ASCIIgL::EventBus sceneBus;
+        ecs::systems::DroppedItemSystem system(sceneRegistry, sceneBus);
+        system.SetFullSyncEnabled(fullSync);
+
+        const entt::entity player = sceneRegistry.create();
+        sceneRegistry.emplace<PlayerTag>(player);
+        sceneRegistry.emplace<Transform>(player).setPosition(glm::vec3(0.0f, 64.0f, 0.0f));
+        sceneRegistry.emplace<Collider>(player);
+        sceneRegistry.emplace<Inventory>(player);
+
+        std::vector<entt::entity> items;
+        items.reserve(kItems);
+        std::mt19937 rng(21);
+        std::uniform_real_distribution<float> horizontal(-kExtent, kExtent);
+        std::uniform_real_distribution<float> height(60.0f, 70.0f);
+        for (size_t i = 0; i < kItems; ++i) {
+            const entt::entity e = sceneRegistry.create();
+            sceneRegistry.emplace<Transform>(e).setPosition(glm::vec3(horizontal(rng), height(rng), horizontal(rng)));
+            sceneRegistry.emplace<DroppedItemTag>(e);
+            sceneRegistry.emplace<Pickup>(e).pickupDelay = (i % 4 == 0) ? 1.0f : 0.0f;
+            sceneRegistry.emplace<Lifetime>(e).maxLifetimeSeconds = 300.0f;
+            // Distinct ids: no merges, so both runs stay comparable item for item.
+            ItemStack stack;
+            stack.itemId = static_cast<int>(i);
+            stack.count = 1;
+            sceneRegistry.emplace<ItemStack>(e, std::move(stack));
+            items.push_back(e);
+        }
+        system.Update(kDt);
+
+        std::uniform_int_distribution<size_t> pick(0, kItems - 1);
+        std::uniform_real_distribution<float> drift(-0.2f, 0.2f);
+        double totalMs = 0.0;
+        for (int frame = 0; frame < kFrames; ++frame) {
+            for (size_t m = 0; m < kMovingPerFrame; ++m) {
+                const entt::entity e = items[pick(rng)];
+                if (!sceneRegistry.valid(e)) continue;
+                sceneRegistry.patch<Transform>(e, [&](Transform& t) {
+                    t.setPosition(t.position + glm::vec3(drift(rng), drift(rng), drift(rng)));
+                });
+            }
+            if (frame % 10 == 0) {
+                for (size_t x = 0; x < kExpiringPerTenFrames; ++x) {
+                    const entt::entity e = items[pick(rng)];
+                    if (!sceneRegistry.valid(e)) continue;
+                    sceneRegistry.patch<Lifetime>(e, [](Lifetime& l) { l.shouldDespawn = true; });
+                }
+            }
+
+            const auto start = BenchClock::now();
+            system.Update(kDt);
+            totalMs += std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+            sceneBus.endFrame();
+        }
+
+        Result result;
+        result.msPerFrame = totalMs / kFrames;
+        const ecs::data::SpatialHash& hash = system.GetSpatialHash();
+        auto view = sceneRegistry.view<DroppedItemTag, Transform>();
+        for (auto e : view) {
+            ++result.liveItems;
+            result.delayedItems += sceneRegistry.get<Pickup>(e).pickupDelay > 0.0f ? 1 : 0;
+            const glm::vec3 p = view.get<Transform>(e).position;
+            bool found = false;
+            hash.QueryAabb(p, p, [&](entt::entity hit, const glm::vec3&) { found = found || hit == e; });
+            result.hashExact = result.hashExact && found;
+        }
+        result.hashExact = result.hashExact && hash.Size() == result.liveItems;
+        return result;
+    };
+
+    const Result full = runScene(true);
+    const Result queued = runScene(false);
+
+    ASCIIgL::Logger::Infof("[Microbench] dropped_items: %zu items, %zu moving/frame | full %.3f ms/frame | "
+                           "queued %.3f ms/frame | %.1fx (%zu live, %zu still delayed)",
+                           kItems, kMovingPerFrame, full.msPerFrame, queued.msPerFrame,
+                           queued.msPerFrame > 0.0 ? full.msPerFrame / queued.msPerFrame : 0.0,
+                           queued.liveItems, queued.delayedItems);
+    if (!full.hashExact || !queued.hashExact || full.liveItems != queued.liveItems ||
+        full.delayedItems != queued.delayedItems) {
+        ASCIIgL::Logger::Errorf("[Microbench] dropped_items: queued sync diverges from the full walk "
+                                "(live %zu vs %zu, delayed %zu vs %zu, hash exact %d/%d)",
+                                queued.liveItems, full.liveItems, queued.delayedItems, full.delayedItems,
+                                queued.hashExact ? 1 : 0, full.hashExact ? 1 : 0);
+        return false;
+    }
+    return true;
+}
+
+// A frame's worth of event traffic shaped like the game's: 24 event types registered, 8 of them
+// active per frame with a few events each, every active type viewed by two systems, then endFrame.
+// "map" is the previous type_index bus, "dense" the current one. A second pass measures worker
+// emits (emitConcurrent from TBB, then one flush) against the same count emitted on one thread.
+bool Game::BenchEventBus() {
+    constexpr int kFrames = 20000;
+    constexpr int kEventsPerType = 4;
+    constexpr size_t kConcurrentEvents = 200000;
+
+    size_t sink = 0;
+    const auto frame = [&](auto& bus, int f) {
+        const auto emitSome = [&](auto tag) {
+            using E = decltype(tag);
+            for (int i = 0; i < kEventsPerType; ++i) {
+                bus.emit(E{static_cast<uint32_t>(f), 1.0f, 2.0f, 3.0f, i});
+            }
+        };
+        const auto viewSome = [&](auto tag) {
+            using E = decltype(tag);
+            for (int pass = 0; pass < 2; ++pass) {
+                for (const E& e : bus.template view<E>()) {
+                    sink += static_cast<size_t>(e.payload);
+                }
+            }
+        };
+        emitSome(BenchEvent<0>{});  emitSome(BenchEvent<3>{});  emitSome(BenchEvent<6>{});
+        emitSome(BenchEvent<9>{});  emitSome(BenchEvent<12>{}); emitSome(BenchEvent<15>{});
+        emitSome(BenchEvent<18>{}); emitSome(BenchEvent<21>{});
+        viewSome(BenchEvent<0>{});  viewSome(BenchEvent<3>{});  viewSome(BenchEvent<6>{});
+        viewSome(BenchEvent<9>{});  viewSome(BenchEvent<12>{}); viewSome(BenchEvent<15>{});
+        viewSome(BenchEvent<18>{}); viewSome(BenchEvent<21>{});
+        // Types systems poll but that rarely fire (input and GUI events).
+        viewSome(BenchEvent<1>{});  viewSome(BenchEvent<4>{});  viewSome(BenchEvent<7>{});
+        viewSome(BenchEvent<10>{});
+        bus.endFrame();
+    };
+    // Every type gets a buffer up front, as in a session that has seen all of them once.
+    const auto registerAll = [](auto& bus) {
+        const auto touch = [&](auto... tags) { (bus.emit(tags), ...); };
+        touch(BenchEvent<0>{}, BenchEvent<1>{}, BenchEvent<2>{}, BenchEvent<3>{}, BenchEvent<4>{}, BenchEvent<5>{},
+              BenchEvent<6>{}, BenchEvent<7>{}, BenchEvent<8>{}, BenchEvent<9>{}, BenchEvent<10>{}, BenchEvent<11>{},
+              BenchEvent<12>{}, BenchEvent<13>{}, BenchEvent<14>{}, BenchEvent<15>{}, BenchEvent<16>{},
+              BenchEvent<17>{}, BenchEvent<18>{}, BenchEvent<19>{}, BenchEvent<20>{}, BenchEvent<21>{},
+              BenchEvent<22>{}, BenchEvent<23>{});
+        bus.endFrame();
+    };
+
+    MapEventBus mapBus;
+    registerAll(mapBus);
+    const auto mapStart = BenchClock::now();
+    for (int f = 0; f < kFrames; ++f) frame(mapBus, f);
+    const auto mapEnd = BenchClock::now();
+
+    ASCIIgL::EventBus denseBus;
+    registerAll(denseBus);
+    const auto denseStart = BenchClock::now();
+    for (int f = 0; f < kFrames; ++f) frame(denseBus, f);
+    const auto denseEnd = BenchClock::now();
+
+    ASCIIgL::EventBus doubleBus(ASCIIgL::EventBus::Buffering::Double);
+    registerAll(doubleBus);
+    const auto doubleStart = BenchClock::now();
+    for (int f = 0; f < kFrames; ++f) frame(doubleBus, f);
+    const auto doubleEnd = BenchClock::now();
+
+    const double mapNs = NsPerIter(mapStart, mapEnd, kFrames);
+    const double denseNs = NsPerIter(denseStart, denseEnd, kFrames);
+    const double doubleNs = NsPerIter(doubleStart, doubleEnd, kFrames);
+    ASCIIgL::Logger::Infof("[Microbench] event_bus: frame (%d emits, %d views) | map %.1f ns | dense %.1f ns (%.2fx) | "
+                           "dense double-buffered %.1f ns | sink %zu",
+                           8 * kEventsPerType, 24, mapNs, denseNs, denseNs > 0.0 ? mapNs / denseNs : 0.0, doubleNs, sink);
+
+    using WorkerEvent = BenchEvent<24>;
+    ASCIIgL::EventBus workerBus;
+
+    const auto serialStart = BenchClock::now();
+    for (size_t i = 0; i < kConcurrentEvents; ++i) {
+        workerBus.emit(WorkerEvent{static_cast<uint32_t>(i), 0.0f, 0.0f, 0.0f, 1});
+    }
+    const auto serialEnd = BenchClock::now();
+    const size_t serialCount = workerBus.view<WorkerEvent>().size();
+    workerBus.endFrame();
+
+    const auto concurrentStart = BenchClock::now();
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<size_t>(0, kConcurrentEvents),
+        [&](const oneapi::tbb::blocked_range<size_t>& r) {
+            for (size_t i = r.begin(); i != r.end(); ++i) {
+                workerBus.emitConcurrent(WorkerEvent{static_cast<uint32_t>(i), 0.0f, 0.0f, 0.0f, 1});
+            }
+        });
+    workerBus.flushConcurrent();
+    const auto concurrentEnd = BenchClock::now();
+    const size_t concurrentCount = workerBus.view<WorkerEvent>().size();
+    workerBus.endFrame();
+
+    ASCIIgL::Logger::Infof("[Microbench] event_bus: %zu events | emit %.1f ns/event | emitConcurrent + flush %.1f ns/event on %u threads",
+                           kConcurrentEvents, NsPerIter(serialStart, serialEnd, kConcurrentEvents),
+                           NsPerIter(concurrentStart, concurrentEnd, kConcurrentEvents), std::thread::hardware_concurrency());
+    if (serialCount != kConcurrentEvents || concurrentCount != kConcurrentEvents) {
+        ASCIIgL::Logger::Errorf("[Microbench] event_bus: lost events (emit %zu, emitConcurrent %zu of %zu)",
+                                serialCount, concurrentCount, kConcurrentEvents);
+        return false;
+    }
+    return true;
+}
+
+// Main-thread cost of applying terrain feature placements (trees, grass, flowers) as
+// ApplyDrainedTerrainResults sees them. The spawn area's own placements are regenerated with the
+// world seed and re-applied to the loaded chunks: "per block" is the old one SetBlockState per
+// placement, "grouped" is GroupPlacementsByChunk (now on the terrain worker, timed separately)
+// plus one ApplyChunkEditGroups per result. The slowest result is the frame-time spike.
+// The written chunks get their original blocks back afterwards, so Shutdown's SaveAll does not
+// store the benchmark's writes over the player's edits.
+bool Game::BenchFeatureApply() {
+    World* world = GetWorldPtr(registry);
+    const auto* bsr = registry.ctx().find<blockstate::BlockStateRegistry>();
+    if (!world || !world->GetChunkManager() || !bsr) {
+        ASCIIgL::Logger::Error("[Microbench] feature_apply: world or block state registry missing.");
+        return false;
+    }
+    WaitForSpawnChunk(*world);
+    ChunkManager* chunkManager = world->GetChunkManager();
+    const ChunkCoord spawnChunk = world->GetSpawnPoint().ToChunkCoord();
+
+    constexpr int kRadius = 4;
+    constexpr int kReps = 5;
+
+    const auto isGenerated = [&](const ChunkCoord& coord) {
+        const Chunk* chunk = chunkManager->FindChunk(coord);
+        return chunk && chunk->IsGenerated();
+    };
+
+    // Placements into chunks that are not generated would land in MetaBuckets and later overwrite
+    // fresh terrain, so only keep the ones the loaded area can absorb.
+    TerrainGenerator generator(registry, world->GetWorldSeed());
+    std::vector<uint32_t> scratch(Chunk::VOLUME);
+    std::vector<std::vector<WorldBlockPlacement>> results;
+    size_t placements = 0;
+    for (int cz = -kRadius; cz <= kRadius; ++cz) {
+        for (int cy = -2; cy <= 2; ++cy) {
+            for (int cx = -kRadius; cx <= kRadius; ++cx) {
+                const ChunkCoord coord = spawnChunk + ChunkCoord(cx, cy, cz);
+                if (!isGenerated(coord)) continue;
+                TerrainResult result;
+                generator.GenerateChunkInto(coord, scratch.data(), result, bsr);
+                auto& kept = result.crossChunkBlocks;
+                kept.erase(std::remove_if(kept.begin(), kept.end(),
+                                          [&](const WorldBlockPlacement& p) { return !isGenerated(p.pos.ToChunkCoord()); }),
+                           kept.end());
+                if (kept.empty()) continue;
+                placements += kept.size();
+                results.push_back(std::move(kept));
+            }
+        }
+    }
+    if (results.empty()) {
+        ASCIIgL::Logger::Error("[Microbench] feature_apply: no feature placements around spawn.");
+        return false;
+    }
+
+    std::vector<WorldBlockPlacement> original;
+    original.reserve(placements);
+    for (const auto& result : results) {
+        for (const WorldBlockPlacement& p : result) {
+            original.push_back(WorldBlockPlacement{ p.pos, chunkManager->GetBlockState(p.pos) });
+        }
+    }
+
+    double perBlockMs = 0.0, perBlockMaxUs = 0.0;
+    for (int rep = 0; rep < kReps; ++rep) {
+        for (const auto& result : results) {
+            const auto start = BenchClock::now();
+            for (const WorldBlockPlacement& p : result) {
+                chunkManager->SetBlockState(p.pos, p.stateId);
+            }
+            const double us = std::chrono::duration<double, std::micro>(BenchClock::now() - start).count();
+            perBlockMs += us / 1000.0;
+            perBlockMaxUs = std::max(perBlockMaxUs, us);
+        }
+    }
+
+    std::vector<uint32_t> expected;
+    expected.reserve(placements);
+    for (const auto& result : results) {
+        for (const WorldBlockPlacement& p : result) {
+            expected.push_back(chunkManager->GetBlockState(p.pos));
+        }
+    }
+
+    std::vector<std::vector<ChunkEditGroup>> grouped(results.size());
+    const auto groupStart = BenchClock::now();
+    for (size_t i = 0; i < results.size(); ++i) {
+        GroupPlacementsByChunk(results[i], grouped[i]);
+    }
+    const auto groupEnd = BenchClock::now();
+
+    size_t groups = 0;
+    for (const auto& g : grouped) groups += g.size();
+
+    double groupedMs = 0.0, groupedMaxUs = 0.0;
+    for (int rep = 0; rep < kReps; ++rep) {
+        for (const auto& g : grouped) {
+            const auto start = BenchClock::now();
+            chunkManager->ApplyChunkEditGroups(g);
+            const double us = std::chrono::duration<double, std::micro>(BenchClock::now() - start).count();
+            groupedMs += us / 1000.0;
+            groupedMaxUs = std::max(groupedMaxUs, us);
+        }
+    }
+
+    size_t mismatches = 0, index = 0;
+    for (const auto& result : results) {
+        for (const WorldBlockPlacement& p : result) {
+            mismatches += chunkManager->GetBlockState(p.pos) != expected[index++] ? 1 : 0;
+        }
+    }
+
+    // Put the world back and drop the change log the writes filled, so the first game frame does
+    // not wake everything. The queued light edits stay; they relight the restored blocks.
+    chunkManager->SetBlockStates(original);
+    std::vector<WorldCoord> changes;
+    bool overflowed = false;
+    chunkManager->TakeBlockChanges(changes, overflowed);
+
+    perBlockMs /= kReps;
+    groupedMs /= kReps;
+    ASCIIgL::Logger::Infof("[Microbench] feature_apply: %zu results, %zu placements into %zu chunk groups | "
+                           "per block %.3f ms (worst result %.1f us) | grouped %.3f ms (worst result %.1f us), %.2fx | "
+                           "grouping on workers %.3f ms",
+                           results.size(), placements, groups, perBlockMs, perBlockMaxUs, groupedMs, groupedMaxUs,
+                           groupedMs > 0.0 ? perBlockMs / groupedMs : 0.0,
+                           std::chrono::duration<double, std::milli>(groupEnd - groupStart).count());
+    if (mismatches != 0) {
+        ASCIIgL::Logger::Errorf("[Microbench] feature_apply: grouped apply diverges from per-block writes (%zu of %zu blocks)",
+                                mismatches, placements);
+        return false;
+    }
+    return true;
+}
+
+// Voxel light: a from-scratch relight of the loaded area around spawn (what chunks get once, when
+// they load), then block edits near the surface applied incrementally and timed one by one against
+// relighting the edited chunk. The incremental result must equal a full relight of the final blocks.
+bool Game::BenchLight() {
+    World* world = GetWorldPtr(registry);
+    const auto* bsr = registry.ctx().find<blockstate::BlockStateRegistry>();
+    if (!world || !world->GetChunkManager() || !bsr) {
+        ASCIIgL::Logger::Error("[Microbench] light: world or block state registry missing.");
+        return false;
+    }
+    WaitForSpawnChunk(*world);
+    ChunkManager* chunkManager = world->GetChunkManager();
+    const ChunkCoord spawnChunk = world->GetSpawnPoint().ToChunkCoord();
+
+    constexpr int kRadius = 3;
+    constexpr int kReps = 3;
+    constexpr int kEdits = 64;
+
+    // Window of generated chunks, all relit from scratch.
+    worldlight::LightJob full;
+    std::unordered_map<ChunkCoord, size_t> sectionIndex;
+    for (int cz = -kRadius; cz <= kRadius; ++cz) {
+        for (int cy = -2; cy <= 2; ++cy) {
+            for (int cx = -kRadius; cx <= kRadius; ++cx) {
+                const ChunkCoord coord = spawnChunk + ChunkCoord(cx, cy, cz);
+                const Chunk* chunk = chunkManager->FindChunk(coord);
+                if (!chunk || !chunk->IsGenerated()) continue;
+                worldlight::LightSection& section = full.sections.emplace_back();
+                section.coord = coord;
+                section.blocks.assign(chunk->GetBlockData(), chunk->GetBlockData() + Chunk::VOLUME);
+                section.relight = true;
+                sectionIndex.emplace(coord, full.sections.size() - 1);
+            }
+        }
+    }
+    if (full.sections.empty()) {
+        ASCIIgL::Logger::Error("[Microbench] light: no generated chunks around spawn.");
+        return false;
+    }
+    for (worldlight::LightSection& section : full.sections) {
+        section.skyAbove = sectionIndex.count(NeighborChunkCoord(section.coord, FaceDir::Top)) == 0;
+    }
+
+    const auto relightAll = [&](worldlight::LightJob& job) {
+        for (worldlight::LightSection& section : job.sections) {
+            section.relight = true;
+            section.light.Clear();
+        }
+        worldlight::RunLightJob(job, *bsr);
+    };
+
+    double fullMs = 0.0;
+    worldlight::LightJob lit;
+    for (int rep = 0; rep < kReps; ++rep) {
+        lit = full;
+        const auto start = BenchClock::now();
+        worldlight::RunLightJob(lit, *bsr);
+        fullMs += std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+    }
+    fullMs /= kReps;
+    const uint32_t fullCells = lit.cellsVisited;
+    for (worldlight::LightSection& section : lit.sections) {
+        section.relight = false;
+        section.lit = true;
+    }
+
+    // Edits one above the surface near spawn: alternately a lit furnace (block light source) and
+    // stone (casts a sky shadow), so both channels add and remove.
+    const uint32_t stoneId = bsr->GetDefaultState("minecraft:stone");
+    const uint32_t furnaceId = bsr->WithProperty(bsr->GetDefaultState("minecraft:furnace"), "lit", "true");
+    const WorldCoord spawn = world->GetSpawnPoint();
+    const int windowTop = (spawnChunk.y + 3) * sizes::CHUNK_SIZE - 2;
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int> offset(-20, 20);
+
+    double editUs = 0.0, editMaxUs = 0.0, chunkRelightUs = 0.0;
+    uint64_t editCells = 0, chunkRelightCells = 0;
+    int edits = 0;
+    for (int i = 0; i < kEdits; ++i) {
+        const int x = spawn.x + offset(rng);
+        const int z = spawn.z + offset(rng);
+        int y = windowTop;
+        while (y > windowTop - 4 * sizes::CHUNK_SIZE && chunkManager->GetBlockState(x, y, z) == blockstate::BlockStateRegistry::AIR_STATE_ID) --y;
+        const WorldCoord pos(x, y + 1, z);
+        const auto it = sectionIndex.find(pos.ToChunkCoord());
+        if (it == sectionIndex.end()) continue;
+        const glm::ivec3 local = pos.ToLocalChunkPos();
+        const uint32_t stateId = (i % 2 == 0) ? furnaceId : stoneId;
+        lit.sections[it->second].blocks[chunkutil::GetBlockIndex(local.x, local.y, local.z)] = stateId;
+        full.sections[it->second].blocks = lit.sections[it->second].blocks;
+
+        // What relighting the edited chunk among its lit neighbours costs instead.
+        worldlight::LightJob chunkRelight;
+        chunkRelight.sections.push_back(lit.sections[it->second]);
+        chunkRelight.sections.back().relight = true;
+        for (FaceDir face : kAllFaceDirs) {
+            const auto n = sectionIndex.find(NeighborChunkCoord(pos.ToChunkCoord(), face));
+            if (n != sectionIndex.end()) chunkRelight.sections.push_back(lit.sections[n->second]);
+        }
+        const auto relightStart = BenchClock::now();
+        worldlight::RunLightJob(chunkRelight, *bsr);
+        chunkRelightUs += std::chrono::duration<double, std::micro>(BenchClock::now() - relightStart).count();
+        chunkRelightCells += chunkRelight.cellsVisited;
+
+        lit.edits.assign(1, pos);
+        const auto start = BenchClock::now();
+        worldlight::RunLightJob(lit, *bsr);
+        const double us = std::chrono::duration<double, std::micro>(BenchClock::now() - start).count();
+        editUs += us;
+        editMaxUs = std::max(editMaxUs, us);
+        editCells += lit.cellsVisited;
+        ++edits;
+    }
+    if (edits == 0) {
+        ASCIIgL::Logger::Error("[Microbench] light: no edit positions inside the lit area.");
+        return false;
+    }
+
+    relightAll(full);
+    size_t mismatches = 0;
+    for (size_t s = 0; s < full.sections.size(); ++s) {
+        for (int i = 0; i < worldlight::ChunkLight::VOLUME; ++i) {
+            mismatches += lit.sections[s].light.GetPacked(i) != full.sections[s].light.GetPacked(i) ? 1 : 0;
+        }
+    }
+
+    ASCIIgL::Logger::Infof("[Microbench] light: relight %zu chunks %.2f ms (%.1f us/chunk, %u cells) | "
+                           "%d edits: incremental %.1f us avg (worst %.1f us, %.0f cells) | "
+                           "edited chunk relight %.1f us avg (%.0f cells), %.1fx",
+                           full.sections.size(), fullMs, fullMs * 1000.0 / static_cast<double>(full.sections.size()),
+                           fullCells, edits, editUs / edits, editMaxUs, static_cast<double>(editCells) / edits,
+                           chunkRelightUs / edits, static_cast<double>(chunkRelightCells) / edits,
+                           editUs > 0.0 ? chunkRelightUs / editUs : 0.0);
+    if (mismatches != 0) {
+        ASCIIgL::Logger::Errorf("[Microbench] light: incremental light diverges from a full relight (%zu cells)",
+                                mismatches);
+        return false;
+    }
+    return true;
+}
+
+// What texture array residency saves with the loaded packs. The load-time clamp only drops levels
+// finer than the policy's max tile (packs above the render width); the CPU release after upload is
+// what frees memory for the shipped 16px tiles. Each array is released and reloaded from its source
+// files (what TextureLibrary::UpdateResidency does when the GPU copy is lost); the reload must
+// restore the same bytes.
+bool Game::BenchTextureResidency() {
+    const auto checksum = [](const ASCIIgL::TextureArray& texArray) {
+        uint64_t hash = 1469598103934665603ull;
+        for (int layer = 0; layer < texArray.GetLayerCount(); ++layer) {
+            for (int mip = 0; mip < texArray.GetMipCount(); ++mip) {
+                const uint8_t* data = texArray.GetLayerData(layer, mip);
+                if (!data) continue;
+                const size_t bytes = static_cast<size_t>(texArray.GetMipWidth(mip)) * texArray.GetMipHeight(mip) * 4;
+                for (size_t i = 0; i < bytes; ++i) hash = (hash ^ data[i]) * 1099511628211ull;
+            }
+        }
+        return hash;
+    };
+
+    bool passed = true;
+    size_t totalCpu = 0;
+    size_t totalFreed = 0;
+    for (const auto& entry : ASCIIgL::TextureLibrary::GetInst().GetTextureArrayResidency()) {
+        auto texArray = ASCIIgL::TextureLibrary::GetInst().GetTextureArray(entry.name);
+        if (!texArray || !texArray->HasCpuData()) continue;
+
+        const ASCIIgL::TextureArray::ResidencyPolicy& policy = texArray->GetResidencyPolicy();
+        const uint64_t before = checksum(*texArray);
+        const size_t cpuBytes = texArray->GetCpuBytes();
+
+        const auto releaseStart = BenchClock::now();
+        const bool released = texArray->ReleaseCpuData();
+        const auto reloadStart = BenchClock::now();
+        const bool reloaded = released && texArray->ReloadCpuData();
+        const auto reloadEnd = BenchClock::now();
+
+        ASCIIgL::Logger::Infof("[Microbench] texture_residency %s: %d layers at %dpx (max tile %dpx) | "
+                               "CPU %zu KiB, release frees %zu KiB in %.3f ms | reload %.2f ms",
+                               entry.name.c_str(), entry.layerCount, entry.tileSize, policy.maxTileSize,
+                               cpuBytes / 1024, released ? cpuBytes / 1024 : 0,
+                               std::chrono::duration<double, std::milli>(reloadStart - releaseStart).count(),
+                               std::chrono::duration<double, std::milli>(reloadEnd - reloadStart).count());
+        totalCpu += cpuBytes;
+        totalFreed += released ? cpuBytes : 0;
+
+        if (released && (!reloaded || texArray->GetCpuBytes() != cpuBytes || checksum(*texArray) != before)) {
+            ASCIIgL::Logger::Errorf("[Microbench] texture_residency %s: reload does not restore the released pixels",
+                                    entry.name.c_str());
+            passed = false;
+        }
+    }
+
+    ASCIIgL::Logger::Infof("[Microbench] texture_residency: %zu of %zu KiB CPU pixels released after upload",
+                           totalFreed / 1024, totalCpu / 1024);
+    return passed;
+}
@@ -0,0 +1,170 @@
+#include <ASCIICraft/game/Game.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include <ASCIIgL/renderer/Renderer.hpp>
+#include <ASCIIgL/renderer/screen/Screen.hpp>
+#include <ASCIIgL/engine/FPSClock.hpp>
+#include <ASCIIgL/util/Logger.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
+
+// Pipelined frame loop. The main thread runs Update() and records draws (RenderPlaying) for
+// frame N+1 while the render thread executes frame N: BeginGpuFrame, FlushDraws, quantization,
+// readback and console/window output. The Renderer's two draw packets are the double-buffered
+// render snapshot: camera matrices, the visible chunk list and entity transforms
+// (Transform::renderPosition) are all baked into draw calls and material snapshots at record
+// time, and mesh GPU caches are retired only after the packet that references them has run.
+// FramePipeline holds one frame, so the added latency is bounded by one render-thread frame.
+
+namespace {
+
+struct PipelineStats {
+    double simMs = 0.0;       // Update + record on the main thread
+    double executeMs = 0.0;   // render thread
+    double waitMs = 0.0;      // main thread blocked on the render thread
+    double latencyMs = 0.0;   // simulation start -> presented
+    double frameMs = 0.0;     // main-loop interval (throughput)
+    size_t frames = 0;
+
+    void Add(double sim, double execute, double wait, double latency, double frame) {
+        simMs += sim;
+        executeMs += execute;
+        waitMs += wait;
+        latencyMs += latency;
+        frameMs += frame;
+        ++frames;
+    }
+
+    void Merge(const PipelineStats& other) {
+        simMs += other.simMs;
+        executeMs += other.executeMs;
+        waitMs += other.waitMs;
+        latencyMs += other.latencyMs;
+        frameMs += other.frameMs;
+        frames += other.frames;
+    }
+
+    std::string Format() const {
+        if (frames == 0) return "no frames";
+        const double n = static_cast<double>(frames);
+        // Serial cost of the same work: one thread would run both halves back to back.
+        const double serialMs = (simMs + executeMs) / n;
+        const double pipelinedMs = frameMs / n;
+        char line[256];
+        std::snprintf(line, sizeof(line),
+                      "frame %.2f ms (serial est. %.2f ms, throughput x%.2f) | latency %.2f ms (+%.2f ms) | "
+                      "sim %.2f ms, render thread %.2f ms, wait %.2f ms",
+                      pipelinedMs, serialMs, pipelinedMs > 0.0 ? serialMs / pipelinedMs : 0.0,
+                      latencyMs / n, latencyMs / n - serialMs,
+                      simMs / n, executeMs / n, waitMs / n);
+        return line;
+    }
+};
+
+double ElapsedMs(ASCIIgL::FramePipeline::Clock::time_point from, ASCIIgL::FramePipeline::Clock::time_point to) {
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+} // namespace
+
+void Game::RunPipelined() {
+    using Clock = ASCIIgL::FramePipeline::Clock;
+
+    auto& screen = ASCIIgL::Screen::GetInst();
+    auto& renderer = ASCIIgL::Renderer::GetInst();
+
+    renderer.SetPipelinedSubmission(true);
+    framePipeline_.Start([this](uint64_t) { ExecuteRenderFrame(); });
+    ASCIIgL::Logger::Info("Starting pipelined game loop (simulation overlaps rendering by one frame)...");
+
+    PipelineStats window;
+    PipelineStats total;
+    uint64_t frameIndex = 0;
+    bool haveSubmitted = false;
+    Clock::time_point lastLoopStart = Clock::now();
+
+    while (!shouldExternalExit() && !shouldInternalExit) {
+        screen.ProcessMessages();
+        if (screen.ShouldExit())
+            break;
+
+        PROFILE_FRAME_MARK();
+        ASCIIgL::FPSClock::GetInst().StartFPSClock();
+        const Clock::time_point simStart = Clock::now();
+        const double frameMs = ElapsedMs(lastLoopStart, simStart);
+        lastLoopStart = simStart;
+
+        {
+            PROFILE_SCOPE("Pipeline.Update");
+            Update();
+        }
+        {
+            PROFILE_SCOPE("Pipeline.Record");
+            if (gameState == GameState::Playing) {
+                RenderPlaying();
+            }
+        }
+        eventBus.endFrame();
+        const double simMs = ElapsedMs(simStart, Clock::now());
+
+        double waitMs = 0.0;
+        {
+            PROFILE_SCOPE("Pipeline.WaitRender");
+            waitMs = framePipeline_.WaitIdle();
+        }
+
+        // Render thread is idle: swap draw packets and apply renderer settings for the next frame.
+        renderer.PublishRecordedDraws();
+        UpdateFrameBudget();
+
+        if (haveSubmitted) {
+            window.Add(simMs, framePipeline_.GetLastExecuteMs(), waitMs, framePipeline_.GetLastLatencyMs(), frameMs);
+        }
+        framePipeline_.Submit(frameIndex++, simStart);
+        haveSubmitted = true;
+
+        ASCIIgL::FPSClock::GetInst().EndFPSClock();
+
+        if (window.frames >= 60) {
+            ASCIIgL::Logger::Info("FPS: " + std::to_string(ASCIIgL::FPSClock::GetInst().GetFPS()) +
+                                  " | pipelined " + window.Format());
+            total.Merge(window);
+            window = PipelineStats{};
+        }
+    }
+
+    framePipeline_.Stop();
+    renderer.SetPipelinedSubmission(false);
+    total.Merge(window);
+    ASCIIgL::Logger::Info("Pipelined loop summary over " + std::to_string(total.frames) + " frames: " + total.Format());
+}
+
+void Game::ExecuteRenderFrame() {
+    auto& screen = ASCIIgL::Screen::GetInst();
+    auto& renderer = ASCIIgL::Renderer::GetInst();
+
+    // PROFILE_SCOPE only: StageTimings is main-thread state.
+    {
+        PROFILE_SCOPE("Pipeline.Render.BeginGpuFrame");
+        screen.ClearPixelBuffer();
+        renderer.BeginGpuFrame();
+    }
+    {
+        PROFILE_SCOPE("Pipeline.Render.FlushDraws");
+        renderer.FlushDraws();
+    }
+    {
+        PROFILE_SCOPE("Pipeline.Render.EndGpuFrame");
+        renderer.EndGpuFrame();
+    }
+    {
+        PROFILE_SCOPE("Pipeline.Render.PixelBufferDraws");
+        renderer.DrawScreenBorderPxBuff(0xF);
+    }
+    {
+        PROFILE_SCOPE("Pipeline.Render.PixelBufferOutput");
+        screen.OutputBuffer();
+    }
+}
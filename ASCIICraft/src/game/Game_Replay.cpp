@@ -0,0 +1,166 @@
+#include <ASCIICraft/game/Game.hpp>
+
+#include <cstring>
+#include <fstream>
+
+#include <ASCIIgL/renderer/screen/Screen.hpp>
+#include <ASCIIgL/engine/FPSClock.hpp>
+#include <ASCIIgL/util/Logger.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
+#include <ASCIIgL/util/StageTimings.hpp>
+
+#include <ASCIICraft/ecs/components/Transform.hpp>
+#include <ASCIICraft/ecs/components/Velocity.hpp>
+#include <ASCIICraft/ecs/components/PlayerCamera.hpp>
+#include <ASCIICraft/ecs/components/PlayerTag.hpp>
+
+// Frame capture and replay for renderer benchmarks.
+// Capture records the player/camera state and the resolved ScreenPixel grid of every frame.
+// FullPipeline replay is camera path playback: dt is pinned and the captured player/camera are
+// written over whatever Update produced, so Render draws the recorded path. Simulation is not
+// replayed (live input, physics and chunk streaming still run), so Update timings and the loaded
+// world can differ between runs; compare the Render.* stages. OutputOnly replay feeds the recorded
+// grids through Screen output alone and is exactly repeatable.
+// Both report per-stage timings under the PROFILE_STAGE names used in Run/Render.
+
+bool Game::BeginCaptureAndReplay() {
+    auto& screen = ASCIIgL::Screen::GetInst();
+
+    if (!frameCapturePath_.empty()) {
+        if (!screen.IsRenderToTerminal()) {
+            ASCIIgL::Logger::Warning("Frame capture requires terminal mode (window mode does not read back the pixel buffer); capture disabled.");
+        } else if (!frameCaptureWriter_.Open(frameCapturePath_, screen.GetWidth(), screen.GetHeight())) {
+            return false;
+        }
+    }
+
+    if (replayMode_ == ReplayMode::None) {
+        return true;
+    }
+
+    if (!frameReplayReader_.Open(replayPath_)) {
+        return false;
+    }
+    if (frameReplayReader_.GetWidth() != screen.GetWidth() || frameReplayReader_.GetHeight() != screen.GetHeight()) {
+        ASCIIgL::Logger::Error("Replay capture is " + std::to_string(frameReplayReader_.GetWidth()) + "x" +
+                               std::to_string(frameReplayReader_.GetHeight()) + " but the screen is " +
+                               std::to_string(screen.GetWidth()) + "x" + std::to_string(screen.GetHeight()) + ".");
+        return false;
+    }
+
+    // Run frames back-to-back; the FPS cap would otherwise dominate the measurement.
+    ASCIIgL::FPSClock::GetInst().SetFPSCap(0);
+    ASCIIgL::StageTimings::GetInst().Reset();
+    ASCIIgL::StageTimings::GetInst().SetEnabled(true);
+    replayFramesPlayed_ = 0;
+
+    ASCIIgL::Logger::Info("Replaying '" + replayPath_ + "' (" +
+                          (replayMode_ == ReplayMode::FullPipeline ? "full pipeline" : "output only") + ").");
+    return true;
+}
+
+void Game::CaptureFrame() {
+    if (!frameCaptureWriter_.IsOpen()) return;
+
+    auto& screen = ASCIIgL::Screen::GetInst();
+    const ASCIIgL::ScreenPixel* pixels = screen.GetPixelBufferData();
+    if (!pixels) return;
+
+    ASCIIgL::CapturedFrame frame;
+    frame.deltaTime = ASCIIgL::FPSClock::GetInst().GetDeltaTime();
+
+    const entt::entity player = ecs::components::GetPlayerEntity(registry);
+    if (player != entt::null) {
+        if (const auto* t = registry.try_get<ecs::components::Transform>(player)) {
+            frame.playerPos = t->position;
+        }
+        if (const auto* cam = registry.try_get<ecs::components::PlayerCamera>(player)) {
+            frame.cameraPos = cam->camera.pos;
+            frame.cameraYaw = cam->camera.GetYaw();
+            frame.cameraPitch = cam->camera.GetPitch();
+            frame.cameraFov = cam->camera.GetFov();
+        }
+    }
+
+    frame.pixels.assign(pixels, pixels + screen.GetPixelBufferSize());
+    frameCaptureWriter_.WriteFrame(frame);
+}
+
+bool Game::BeginReplayFrame() {
+    if (!frameReplayReader_.ReadFrame(replayFrame_)) {
+        return false;
+    }
+    ASCIIgL::FPSClock::GetInst().SetDeltaTimeOverride(replayFrame_.deltaTime);
+    ++replayFramesPlayed_;
+    return true;
+}
+
+void Game::ApplyReplayFrameState() {
+    const entt::entity player = ecs::components::GetPlayerEntity(registry);
+    if (player == entt::null) return;
+
+    if (auto* t = registry.try_get<ecs::components::Transform>(player)) {
+        t->setPosition(replayFrame_.playerPos);
+        t->previousPosition = replayFrame_.playerPos;
+    }
+    if (auto* v = registry.try_get<ecs::components::Velocity>(player)) {
+        v->linear = glm::vec3(0.0f);
+    }
+    if (auto* cam = registry.try_get<ecs::components::PlayerCamera>(player)) {
+        cam->camera.SetFov(replayFrame_.cameraFov);
+        cam->camera.setCamPos(replayFrame_.cameraPos);
+        cam->camera.setCamDir(replayFrame_.cameraYaw, replayFrame_.cameraPitch);
+    }
+}
+
+void Game::RunOutputReplay() {
+    auto& screen = ASCIIgL::Screen::GetInst();
+
+    while (!screen.ShouldExit()) {
+        screen.ProcessMessages();
+        if (!frameReplayReader_.ReadFrame(replayFrame_)) {
+            break;
+        }
+        ++replayFramesPlayed_;
+
+        ASCIIgL::ScreenPixel* dest = screen.GetPixelBufferData();
+        if (!dest || screen.GetPixelBufferSize() != replayFrame_.pixels.size()) {
+            ASCIIgL::Logger::Error("Replay frame does not match the screen pixel buffer; stopping.");
+            break;
+        }
+
+        PROFILE_FRAME_MARK();
+        {
+            PROFILE_STAGE("Render.PixelBufferCopy");
+            std::memcpy(dest, replayFrame_.pixels.data(), replayFrame_.pixels.size() * sizeof(ASCIIgL::ScreenPixel));
+        }
+        {
+            PROFILE_STAGE("Render.PixelBufferOutput");
+            screen.OutputBuffer();
+        }
+    }
+
+    FinishReplay();
+}
+
+void Game::FinishReplay() {
+    ASCIIgL::FPSClock::GetInst().ClearDeltaTimeOverride();
+    frameReplayReader_.Close();
+
+    auto& timings = ASCIIgL::StageTimings::GetInst();
+    const std::string report = timings.FormatReport();
+    timings.SetEnabled(false);
+
+    ASCIIgL::Logger::Info("Replay finished after " + std::to_string(replayFramesPlayed_) + " frames. Stage timings:\n" + report);
+
+    const std::string reportPath = replayPath_ + ".timings.txt";
+    std::ofstream out(reportPath, std::ios::trunc);
+    if (out.is_open()) {
+        out << "frames " << replayFramesPlayed_ << "\n" << report;
+        ASCIIgL::Logger::Info("Replay timings written to '" + reportPath + "'.");
+    } else {
+        ASCIIgL::Logger::Warning("Could not write replay timings to '" + reportPath + "'.");
+    }
+
+    shouldInternalExit = true;
+}
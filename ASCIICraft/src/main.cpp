@@ -73,6 +73,23 @@ static bool ParseMulticolor(int argc, char* argv[]) {
     return multicolor;
 }
 
+/// Value following \a flag (e.g. "--capture out.cap"); empty if the flag is absent.
+static std::string ParseFlagValue(int argc, char* argv[], const char* flag) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string(argv[i]) == flag)
+            return argv[i + 1];
+    }
+    return {};
+}
+
+static bool ParseFlag(int argc, char* argv[], const char* flag) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == flag)
+            return true;
+    }
+    return false;
+}
+
 int main(int argc, char* argv[]) {
     // Initialize logging
     #ifdef NDEBUG
@@ -86,12 +103,34 @@ int main(int argc, char* argv[]) {
     bool renderToTerminal = ParseRenderToTerminal(argc, argv);
     bool multicolor = ParseMulticolor(argc, argv);
 
+    int exitCode = 0;
     try {
         Game game;
         ConsoleHandlerScope closeHandler(&game);
 
+        // Benchmark capture/replay: --capture <file>, --replay <file>, --replay-output <file>
+        const std::string capturePath = ParseFlagValue(argc, argv, "--capture");
+        const std::string replayPath = ParseFlagValue(argc, argv, "--replay");
+        const std::string replayOutputPath = ParseFlagValue(argc, argv, "--replay-output");
+        if (!capturePath.empty())
+            game.SetFrameCapturePath(capturePath);
+        if (!replayPath.empty())
+            game.SetReplay(replayPath, ReplayMode::FullPipeline);
+        else if (!replayOutputPath.empty())
+            game.SetReplay(replayOutputPath, ReplayMode::OutputOnly);
+        if (ParseFlag(argc, argv, "--dynamic-res"))
+            game.SetDynamicResolution(true);
+        if (ParseFlag(argc, argv, "--pipelined"))
+            game.SetPipelined(true);
+        // Microbenchmark: --microbench <name> (runs after startup, logs a report, exits non-zero on failure)
+        const std::string microbench = ParseFlagValue(argc, argv, "--microbench");
+        if (!microbench.empty())
+            game.SetMicrobench(microbench);
+
         // Exit when user closes window or console (handled by ASCIIgL::Screen)
         game.Run([]() { return ASCIIgL::Screen::GetInst().ShouldExit(); }, renderToTerminal, multicolor);
+        if (game.MicrobenchFailed())
+            exitCode = 1;
     }
     catch (const std::exception& e) {
         ASCIIgL::Logger::Error("Game crashed with exception: " + std::string(e.what()));
@@ -103,5 +142,5 @@ int main(int argc, char* argv[]) {
     ASCIIgL::Logger::Info("ASCIICraft exited");
     ASCIIgL::Logger::Close();
 
-    return 0;
+    return exitCode;
 }
\ No newline at end of file
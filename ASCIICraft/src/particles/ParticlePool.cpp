@@ -0,0 +1,288 @@
+#include <ASCIICraft/particles/ParticlePool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <ASCIIgL/util/CpuFeatures.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
+
+#include <ASCIICraft/world/World.hpp>
+#include <ASCIICraft/world/query/BlockQueries.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define ASCIICRAFT_PARTICLE_SSE2 1
+#endif
+
+namespace particles {
+
+namespace {
+
+constexpr float kNoFloor = -std::numeric_limits<float>::max();
+
+// Horizontal speed kept per physics step while resting (PhysicsSystem ground friction at 30 Hz).
+constexpr float kGroundFrictionPerStep = 0.8f;
+constexpr float kPhysicsStepsPerSecond = 30.0f;
+
+// Cells scanned below a falling particle per frame; more than any debris falls in one frame.
+constexpr int kMaxFloorProbeCells = 4;
+
+struct IntegrateStreams {
+    float* posX;
+    float* posY;
+    float* posZ;
+    float* velX;
+    float* velY;
+    float* velZ;
+    float* life;
+    const float* damping;
+    const float* gravity;
+    const float* halfSize;
+    const float* floorY;
+};
+
+// Same order of operations as PhysicsSystem::IntegrateEntities: gravity, damping, move; then the
+// floor clamp zeroes vertical speed and applies ground friction.
+void IntegrateScalar(const IntegrateStreams& s, size_t begin, size_t end, float dt, float groundFriction) {
+    for (size_t i = begin; i < end; ++i) {
+        float vx = s.velX[i];
+        float vy = s.velY[i] + s.gravity[i] * dt;
+        float vz = s.velZ[i];
+        const float damp = 1.0f / (1.0f + s.damping[i] * dt);
+        vx *= damp;
+        vy *= damp;
+        vz *= damp;
+
+        float py = s.posY[i] + vy * dt;
+        if (py - s.halfSize[i] < s.floorY[i]) {
+            py = s.floorY[i] + s.halfSize[i];
+            vy = 0.0f;
+            vx *= groundFriction;
+            vz *= groundFriction;
+        }
+
+        s.posX[i] += vx * dt;
+        s.posY[i] = py;
+        s.posZ[i] += vz * dt;
+        s.velX[i] = vx;
+        s.velY[i] = vy;
+        s.velZ[i] = vz;
+        s.life[i] -= dt;
+    }
+}
+
+#if defined(ASCIICRAFT_PARTICLE_SSE2)
+// Four particles per iteration; the floor clamp is a compare mask blended in with and/andnot.
+size_t IntegrateSSE2(const IntegrateStreams& s, size_t count, float dt, float groundFriction) {
+    const __m128 vdt = _mm_set1_ps(dt);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 friction = _mm_set1_ps(groundFriction);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(s.velX + i);
+        __m128 vy = _mm_add_ps(_mm_loadu_ps(s.velY + i), _mm_mul_ps(_mm_loadu_ps(s.gravity + i), vdt));
+        __m128 vz = _mm_loadu_ps(s.velZ + i);
+        const __m128 damp = _mm_div_ps(one, _mm_add_ps(one, _mm_mul_ps(_mm_loadu_ps(s.damping + i), vdt)));
+        vx = _mm_mul_ps(vx, damp);
+        vy = _mm_mul_ps(vy, damp);
+        vz = _mm_mul_ps(vz, damp);
+
+        const __m128 half = _mm_loadu_ps(s.halfSize + i);
+        const __m128 floorY = _mm_loadu_ps(s.floorY + i);
+        __m128 py = _mm_add_ps(_mm_loadu_ps(s.posY + i), _mm_mul_ps(vy, vdt));
+        const __m128 hit = _mm_cmplt_ps(_mm_sub_ps(py, half), floorY);
+
+        py = _mm_or_ps(_mm_and_ps(hit, _mm_add_ps(floorY, half)), _mm_andnot_ps(hit, py));
+        vy = _mm_andnot_ps(hit, vy);
+        const __m128 slow = _mm_or_ps(_mm_and_ps(hit, friction), _mm_andnot_ps(hit, one));
+        vx = _mm_mul_ps(vx, slow);
+        vz = _mm_mul_ps(vz, slow);
+
+        _mm_storeu_ps(s.posX + i, _mm_add_ps(_mm_loadu_ps(s.posX + i), _mm_mul_ps(vx, vdt)));
+        _mm_storeu_ps(s.posY + i, py);
+        _mm_storeu_ps(s.posZ + i, _mm_add_ps(_mm_loadu_ps(s.posZ + i), _mm_mul_ps(vz, vdt)));
+        _mm_storeu_ps(s.velX + i, vx);
+        _mm_storeu_ps(s.velY + i, vy);
+        _mm_storeu_ps(s.velZ + i, vz);
+        _mm_storeu_ps(s.life + i, _mm_sub_ps(_mm_loadu_ps(s.life + i), vdt));
+    }
+    return i;
+}
+#endif
+
+} // namespace
+
+ParticlePool::ParticlePool(size_t capacity)
+    : m_capacity(capacity)
+{
+    for (std::vector<float>* stream : {&m_posX, &m_posY, &m_posZ, &m_velX, &m_velY, &m_velZ, &m_life,
+                                       &m_damping, &m_gravity, &m_halfSize, &m_floorY, &m_layer}) {
+        stream->resize(capacity);
+    }
+    m_collide.resize(capacity);
+    m_floorCellX.resize(capacity);
+    m_floorCellZ.resize(capacity);
+    m_uvRect.resize(capacity);
+}
+
+bool ParticlePool::Spawn(const ParticleDesc& desc) {
+    if (m_count >= m_capacity) {
+        ++m_stats.dropped;
+        return false;
+    }
+
+    const size_t i = m_count++;
+    m_posX[i] = desc.position.x;
+    m_posY[i] = desc.position.y;
+    m_posZ[i] = desc.position.z;
+    m_velX[i] = desc.velocity.x;
+    m_velY[i] = desc.velocity.y;
+    m_velZ[i] = desc.velocity.z;
+    m_life[i] = desc.lifetime;
+    m_damping[i] = desc.damping;
+    m_gravity[i] = desc.gravity;
+    m_halfSize[i] = desc.halfSize;
+    m_floorY[i] = kNoFloor;
+    m_collide[i] = desc.collideFloor ? 1 : 0;
+    m_floorCellX[i] = std::numeric_limits<int32_t>::min();
+    m_floorCellZ[i] = std::numeric_limits<int32_t>::min();
+    m_layer[i] = desc.textureLayer;
+    m_uvRect[i] = desc.uvRect;
+    ++m_stats.spawned;
+    return true;
+}
+
+void ParticlePool::Simulate(float dt, const World* world, const blockstate::BlockStateRegistry* bsr,
+                            const glm::vec3& keepCenter, float keepRadius) {
+    PROFILE_SCOPE("ParticlePool::Simulate");
+    m_stats.floorProbes = 0;
+
+    if (m_count > 0 && dt > 0.0f) {
+        if (world) {
+            ProbeFloors(dt, *world, bsr);
+        }
+        Integrate(dt);
+    }
+    Compact(keepCenter, keepRadius);
+
+    m_stats.alive = static_cast<uint32_t>(m_count);
+    PROFILE_PLOT("Pooled particles", static_cast<int64_t>(m_count));
+}
+
+void ParticlePool::ProbeFloors(float dt, const World& world, const blockstate::BlockStateRegistry* bsr) {
+    uint32_t probes = 0;
+    for (size_t i = 0; i < m_count; ++i) {
+        if (!m_collide[i]) {
+            continue;
+        }
+
+        const int32_t cellX = static_cast<int32_t>(std::floor(m_posX[i]));
+        const int32_t cellZ = static_cast<int32_t>(std::floor(m_posZ[i]));
+        const float bottom = m_posY[i] - m_halfSize[i];
+
+        // Resting on the cached floor in the same column: nothing can have changed underneath
+        // that a sub-second particle needs to notice.
+        const bool resting = m_velY[i] == 0.0f && m_floorY[i] != kNoFloor && bottom <= m_floorY[i] + 1e-3f;
+        if (resting && cellX == m_floorCellX[i] && cellZ == m_floorCellZ[i]) {
+            continue;
+        }
+
+        // Scan from the cell holding the particle's bottom down to where it will be after this
+        // frame's fall; the first solid cell's top is the floor.
+        const float nextVelY = m_velY[i] + m_gravity[i] * dt;
+        const float reach = std::min(bottom, bottom + nextVelY * dt);
+        const int top = static_cast<int>(std::floor(bottom));
+        const int lowest = std::max(static_cast<int>(std::floor(reach)), top - kMaxFloorProbeCells + 1);
+
+        float floorY = kNoFloor;
+        for (int y = top; y >= lowest; --y) {
+            ++probes;
+            if (blockquery::IsSolidForPhysics(bsr, world.GetBlockState(cellX, y, cellZ))) {
+                floorY = static_cast<float>(y + 1);
+                break;
+            }
+        }
+
+        m_floorY[i] = floorY;
+        m_floorCellX[i] = cellX;
+        m_floorCellZ[i] = cellZ;
+    }
+    m_stats.floorProbes = probes;
+}
+
+void ParticlePool::Integrate(float dt) {
+    const IntegrateStreams streams{
+        m_posX.data(), m_posY.data(), m_posZ.data(),
+        m_velX.data(), m_velY.data(), m_velZ.data(),
+        m_life.data(),
+        m_damping.data(), m_gravity.data(), m_halfSize.data(), m_floorY.data(),
+    };
+    const float groundFriction = std::pow(kGroundFrictionPerStep, dt * kPhysicsStepsPerSecond);
+
+    size_t done = 0;
+#if defined(ASCIICRAFT_PARTICLE_SSE2)
+    if (ASCIIgL::GetSimdLevel() >= ASCIIgL::SimdLevel::SSE2) {
+        done = IntegrateSSE2(streams, m_count, dt, groundFriction);
+    }
+#endif
+    IntegrateScalar(streams, done, m_count, dt, groundFriction);
+}
+
+void ParticlePool::Compact(const glm::vec3& keepCenter, float keepRadius) {
+    const float keepRadius2 = keepRadius * keepRadius;
+    size_t i = 0;
+    while (i < m_count) {
+        const float dx = m_posX[i] - keepCenter.x;
+        const float dy = m_posY[i] - keepCenter.y;
+        const float dz = m_posZ[i] - keepCenter.z;
+        const bool dead = m_life[i] <= 0.0f || dx * dx + dy * dy + dz * dz > keepRadius2;
+        if (!dead) {
+            ++i;
+            continue;
+        }
+        // Swap-remove: order does not matter and the arrays stay dense for the kernel.
+        --m_count;
+        if (i != m_count) {
+            MoveParticle(i, m_count);
+        }
+    }
+}
+
+void ParticlePool::MoveParticle(size_t dst, size_t src) {
+    m_posX[dst] = m_posX[src];
+    m_posY[dst] = m_posY[src];
+    m_posZ[dst] = m_posZ[src];
+    m_velX[dst] = m_velX[src];
+    m_velY[dst] = m_velY[src];
+    m_velZ[dst] = m_velZ[src];
+    m_life[dst] = m_life[src];
+    m_damping[dst] = m_damping[src];
+    m_gravity[dst] = m_gravity[src];
+    m_halfSize[dst] = m_halfSize[src];
+    m_floorY[dst] = m_floorY[src];
+    m_collide[dst] = m_collide[src];
+    m_floorCellX[dst] = m_floorCellX[src];
+    m_floorCellZ[dst] = m_floorCellZ[src];
+    m_layer[dst] = m_layer[src];
+    m_uvRect[dst] = m_uvRect[src];
+}
+
+void ParticlePool::WriteInstances(std::vector<BillboardInstance>& instances) const {
+    instances.resize(m_count);
+    for (size_t i = 0; i < m_count; ++i) {
+        BillboardInstance& inst = instances[i];
+        inst.center = glm::vec3(m_posX[i], m_posY[i], m_posZ[i]);
+        inst.halfSize = m_halfSize[i];
+        inst.uvRect = m_uvRect[i];
+        inst.layer = m_layer[i];
+    }
+}
+
+void ParticlePool::Clear() {
+    m_count = 0;
+    m_stats = Stats{};
+}
+
+} // namespace particles
@@ -0,0 +1,114 @@
+#include <ASCIICraft/rendering/BlockParticleShaders.hpp>
+
+namespace BlockParticleShaders {
+
+const char* GetVSSource() {
+    return R"(
+cbuffer ConstantBuffer : register(b0)
+{
+    float4x4 mvp;
+    float3 cameraPos;
+    float4 fogParams;
+    float3 fogColor;
+    float3 cameraRight;
+    float3 cameraUp;
+};
+
+struct VS_INPUT
+{
+    float3 position : POSITION;
+    float3 texcoord : TEXCOORD0;
+    float4 centerHalfSize : TEXCOORD4;
+    float4 uvRect : TEXCOORD5;
+    float layer : TEXCOORD6;
+};
+
+struct PS_INPUT
+{
+    float4 position : SV_POSITION;
+    float3 texcoord : TEXCOORD0;
+    float dist : TEXCOORD1;
+};
+
+PS_INPUT main(VS_INPUT input)
+{
+    PS_INPUT output;
+    float3 center = input.centerHalfSize.xyz;
+    float halfSize = input.centerHalfSize.w;
+    float3 world = center + (cameraRight * input.position.x + cameraUp * input.position.y) * halfSize;
+    output.position = mul(mvp, float4(world, 1.0));
+
+    // Unit-quad corner -> sub-rect: left/right pick u0/u1, bottom/top pick v1/v0 (V=0 is the texture top).
+    float2 corner = input.position.xy * 0.5 + 0.5;
+    output.texcoord = float3(lerp(input.uvRect.x, input.uvRect.z, corner.x),
+                             lerp(input.uvRect.w, input.uvRect.y, corner.y),
+                             input.layer);
+    output.dist = distance(center, cameraPos);
+    return output;
+}
+)";
+}
+
+const char* GetPSSource() {
+    return R"(
+#include "ColorUtil.hlsl"
+
+Texture2DArray blockTextures : register(t0);
+SamplerState samplerState : register(s0);
+
+cbuffer ConstantBuffer : register(b0)
+{
+    float4x4 mvp;
+    float3 cameraPos;
+    float4 fogParams;
+    float3 fogColor;
+};
+
+struct PS_INPUT
+{
+    float4 position : SV_POSITION;
+    float3 texcoord : TEXCOORD0;
+    float dist : TEXCOORD1;
+};
+
+float4 main(PS_INPUT input) : SV_TARGET
+{
+    float4 texColor = blockTextures.Sample(samplerState, input.texcoord);
+
+    static const float ALPHA_CUTOFF = 0.5;
+    clip(texColor.a - ALPHA_CUTOFF);
+
+    float fogFactor = saturate((input.dist - fogParams.x) / (fogParams.y - fogParams.x));
+    float3 fogLinear = sRGBToLinear(fogColor);
+    float3 finalColorLinear = lerp(texColor.rgb, fogLinear, fogFactor);
+
+    return float4(finalColorLinear, texColor.a);
+}
+)";
+}
+
+ASCIIgL::UniformBufferLayout GetUniformLayout() {
+    return ASCIIgL::UniformBufferLayout::Builder()
+        .Add("mvp", ASCIIgL::UniformType::Mat4)
+        .Add("cameraPos", ASCIIgL::UniformType::Float3)
+        .Add("fogParams", ASCIIgL::UniformType::Float4)
+        .Add("fogColor", ASCIIgL::UniformType::Float3)
+        .Add("cameraRight", ASCIIgL::UniformType::Float3)
+        .Add("cameraUp", ASCIIgL::UniformType::Float3)
+        .Build();
+}
+
+const ASCIIgL::VertFormat& GetVertFormat() {
+    using ASCIIgL::VertexElementSemantic;
+    using ASCIIgL::VertexElementType;
+    static ASCIIgL::VertFormat format = ASCIIgL::VertFormat::Builder()
+        .AddFloat3(VertexElementSemantic::Position)      // unit-quad corner (12 bytes)
+        .AddFloat3(VertexElementSemantic::TexCoord, 0)   // UV + Layer, unused (12 bytes)
+        .AddInstance(VertexElementSemantic::TexCoord, VertexElementType::Float4, 4)  // centre + half size (16 bytes)
+        .AddInstance(VertexElementSemantic::TexCoord, VertexElementType::Float4, 5)  // uvRect (16 bytes)
+        .AddInstance(VertexElementSemantic::TexCoord, VertexElementType::Float, 6)   // layer (4 bytes)
+        .Build();
+    return format;
+}
+
+} // namespace BlockParticleShaders
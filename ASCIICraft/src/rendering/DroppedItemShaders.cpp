@@ -84,4 +84,100 @@ ASCIIgL::UniformBufferLayout GetUniformLayout() {
         .Build();
 }
 
+const char* GetInstancedVSSource() {
+    return R"(
+cbuffer ConstantBuffer : register(b0)
+{
+    float4x4 viewProj;
+    float3 cameraPos;
+};
+
+struct VS_INPUT
+{
+    float3 position : POSITION;
+    float3 texcoord : TEXCOORD0;
+    float4 model0 : TEXCOORD4;
+    float4 model1 : TEXCOORD5;
+    float4 model2 : TEXCOORD6;
+    float4 model3 : TEXCOORD7;
+    float4 tint : COLOR0;
+    float layer : TEXCOORD8;
+};
+
+struct PS_INPUT
+{
+    float4 position : SV_POSITION;
+    float3 texcoord : TEXCOORD0;
+    float dist : TEXCOORD1;
+    float4 tint : COLOR0;
+};
+
+PS_INPUT main(VS_INPUT input)
+{
+    PS_INPUT output;
+    float4 world = input.model0 * input.position.x
+                 + input.model1 * input.position.y
+                 + input.model2 * input.position.z
+                 + input.model3;
+    output.position = mul(viewProj, world);
+    output.texcoord = input.texcoord;
+    if (input.layer >= 0.0)
+    {
+        output.texcoord.z = input.layer;
+    }
+    output.dist = distance(world.xyz, cameraPos);
+    output.tint = input.tint;
+    return output;
+}
+)";
+}
+
+const char* GetInstancedPSSource() {
+    return R"(
+#include "ColorUtil.hlsl"
+
+Texture2DArray itemTextures : register(t0);
+SamplerState samplerState : register(s0);
+
+cbuffer ConstantBuffer : register(b0)
+{
+    float4x4 viewProj;
+    float3 cameraPos;
+    float4 fogParams;
+    float3 fogColor;
+};
+
+struct PS_INPUT
+{
+    float4 position : SV_POSITION;
+    float3 texcoord : TEXCOORD0;
+    float dist : TEXCOORD1;
+    float4 tint : COLOR0;
+};
+
+float4 main(PS_INPUT input) : SV_TARGET
+{
+    float4 texColor = itemTextures.Sample(samplerState, input.texcoord) * input.tint;
+
+    static const float ALPHA_CUTOFF = 0.5;
+    clip(texColor.a - ALPHA_CUTOFF);
+
+    float fogFactor = saturate((input.dist - fogParams.x) / (fogParams.y - fogParams.x));
+    float3 fogLinear = sRGBToLinear(fogColor);
+    float3 finalColorLinear = lerp(texColor.rgb, fogLinear, fogFactor);
+
+    return float4(finalColorLinear, texColor.a);
+}
+)";
+}
+
+ASCIIgL::UniformBufferLayout GetInstancedUniformLayout() {
+    return ASCIIgL::UniformBufferLayout::Builder()
+        .Add("viewProj", ASCIIgL::UniformType::Mat4)
+        .Add("cameraPos", ASCIIgL::UniformType::Float3)
+        .Add("fogParams", ASCIIgL::UniformType::Float4)
+        .Add("fogColor", ASCIIgL::UniformType::Float3)
+        .Build();
+}
+
 } // namespace DroppedItemShaders
@@ -7,7 +7,7 @@
 namespace TerrainShaders {
 
 const char* GetTerrainVSSource() {
-    // Same as texture array vertex shader - passes position + UVLayer
+    // Same as texture array vertex shader - passes position + UVLayer, plus the face's packed light
     return R"(
 cbuffer ConstantBuffer : register(b0)
 {
@@ -19,6 +19,7 @@ struct VS_INPUT
 {
     float3 position : POSITION;
     float3 texcoord : TEXCOORD0;  // UV.xy + Layer.z
+    float light : TEXCOORD1;      // sky * 16 + block (0-15 each)
 };
 
 struct PS_INPUT
@@ -27,6 +28,7 @@ struct PS_INPUT
     float3 texcoord : TEXCOORD0;
     float dist : TEXCOORD1;
     nointerpolation float waterPhaseOffset : TEXCOORD2;
+    nointerpolation float light : TEXCOORD3;
 };
 
 PS_INPUT main(VS_INPUT input)
@@ -39,6 +41,7 @@ PS_INPUT main(VS_INPUT input)
     float2 tileCoord = floor(input.position.xz);
     float rand = frac(sin(dot(tileCoord, float2(12.9898, 78.233))) * 43758.5453);
     output.waterPhaseOffset = rand;
+    output.light = input.light;
     return output;
 }
 )";
@@ -72,6 +75,7 @@ struct PS_INPUT
     float3 texcoord : TEXCOORD0;
     float dist : TEXCOORD1;
     nointerpolation float waterPhaseOffset : TEXCOORD2;
+    nointerpolation float light : TEXCOORD3;
 };
 
 float4 main(PS_INPUT input) : SV_TARGET
@@ -95,7 +99,12 @@ float4 main(PS_INPUT input) : SV_TARGET
     static const float ALPHA_CUTOFF = 0.5;
     clip(texColor.a - ALPHA_CUTOFF);
     
-    float3 mappedColor = texColor.rgb;
+    // Brighter of sky and block light; each level below 15 keeps 80% of the next one up, with a
+    // floor so caves stay readable once the ASCII palette quantizes them.
+    float sky = floor(input.light / 16.0);
+    float level = max(sky, input.light - sky * 16.0);
+    float brightness = lerp(0.08, 1.0, pow(0.8, 15.0 - level));
+    float3 mappedColor = texColor.rgb * brightness;
 
     float fogFactor = saturate((input.dist - fogParams.x) / (fogParams.y - fogParams.x));
     float3 fogLinear = sRGBToLinear(fogColor);
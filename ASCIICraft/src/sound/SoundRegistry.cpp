@@ -2,6 +2,8 @@
 
 #include <ASCIICraft/util/RNG.hpp>
 
+#include <algorithm>
+
 namespace sound {
 
 void SoundRegistry::Register(const std::string& soundId, std::vector<std::string> paths) {
@@ -28,6 +30,16 @@ const std::vector<std::string>* SoundRegistry::TryGetPaths(const std::string& so
     return &it->second;
 }
 
+std::vector<std::string> SoundRegistry::GetAllPaths() const {
+    std::vector<std::string> out;
+    for (const auto& [soundId, paths] : m_entries) {
+        out.insert(out.end(), paths.begin(), paths.end());
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return out;
+}
+
 std::string SoundRegistry::PickRandomPath(const std::string& soundId) const {
     const std::vector<std::string>* paths = TryGetPaths(soundId);
     if (!paths) {
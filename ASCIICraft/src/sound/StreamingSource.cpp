@@ -0,0 +1,223 @@
+#include <ASCIICraft/sound/StreamingSource.hpp>
+
+#include <algorithm>
+
+#include <ASCIIgL/util/Logger.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
+
+// Implementation lives in SoundSystem.cpp.
+#define STB_VORBIS_HEADER_ONLY
+#include "stb_vorbis.c"
+
+namespace sound {
+
+StreamingSource::StreamingSource()
+{
+    alGenSources(1, &m_source);
+    alGenBuffers(kBufferCount, m_buffers);
+    m_freeBuffers.assign(m_buffers, m_buffers + kBufferCount);
+}
+
+StreamingSource::~StreamingSource()
+{
+    StopDecoder();
+
+    if (m_source != 0) {
+        alSourceStop(m_source);
+        alSourcei(m_source, AL_BUFFER, 0);
+        alDeleteSources(1, &m_source);
+    }
+    alDeleteBuffers(kBufferCount, m_buffers);
+}
+
+bool StreamingSource::Open(const std::string& path)
+{
+    StopDecoder();
+
+    int error = 0;
+    stb_vorbis* vorbis = stb_vorbis_open_filename(path.c_str(), &error, nullptr);
+    if (!vorbis) {
+        ASCIIgL::Logger::Errorf("[StreamingSource] stb_vorbis failed to open: %s (error code: %d)", path.c_str(), error);
+        return false;
+    }
+
+    const stb_vorbis_info info = stb_vorbis_get_info(vorbis);
+    // get_samples_short_interleaved downmixes for us; AL only has mono/stereo 16-bit formats.
+    m_channels = std::min(info.channels, 2);
+    m_sampleRate = static_cast<int>(info.sample_rate);
+    m_format = (m_channels == 1) ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16;
+    m_path = path;
+    m_stats = Stats{};
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopRequested = false;
+    }
+    m_decodeDone = false;
+    m_opened = true;
+    m_decoder = std::thread(&StreamingSource::DecodeLoop, this, static_cast<void*>(vorbis));
+    return true;
+}
+
+void StreamingSource::Play()
+{
+    m_wantPlaying = true;
+}
+
+void StreamingSource::Stop()
+{
+    m_wantPlaying = false;
+    StopDecoder();
+
+    if (m_source != 0) {
+        alSourceStop(m_source);
+        alSourcei(m_source, AL_BUFFER, 0);      // unqueues everything on a stopped source
+    }
+    m_freeBuffers.assign(m_buffers, m_buffers + kBufferCount);
+    m_opened = false;
+}
+
+void StreamingSource::Update()
+{
+    if (!m_opened) {
+        return;
+    }
+    PROFILE_SCOPE("StreamingSource::Update");
+
+    ALint processed = 0;
+    alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processed);
+    while (processed-- > 0) {
+        ALuint buffer = 0;
+        alSourceUnqueueBuffers(m_source, 1, &buffer);
+        m_freeBuffers.push_back(buffer);
+    }
+
+    Chunk chunk;
+    while (!m_freeBuffers.empty() && TryPopChunk(chunk)) {
+        const ALuint buffer = m_freeBuffers.back();
+        m_freeBuffers.pop_back();
+
+        alBufferData(
+            buffer,
+            m_format,
+            chunk.samples.data(),
+            chunk.frames * m_channels * static_cast<int>(sizeof(short)),
+            m_sampleRate
+        );
+        alSourceQueueBuffers(m_source, 1, &buffer);
+        m_stats.framesQueued += static_cast<uint64_t>(chunk.frames);
+        ++m_stats.buffersQueued;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_spare.push_back(std::move(chunk));
+    }
+
+    if (!m_wantPlaying) {
+        return;
+    }
+
+    ALint state = AL_STOPPED;
+    ALint queued = 0;
+    alGetSourcei(m_source, AL_SOURCE_STATE, &state);
+    alGetSourcei(m_source, AL_BUFFERS_QUEUED, &queued);
+    if (state != AL_PLAYING && state != AL_PAUSED && queued > 0) {
+        // A stopped source with fresh buffers ran dry mid-stream (decoder fell behind or a long frame).
+        if (state == AL_STOPPED) {
+            ++m_stats.underruns;
+        }
+        alSourcePlay(m_source);
+    }
+}
+
+bool StreamingSource::IsFinished() const
+{
+    if (!m_opened) {
+        return true;
+    }
+    if (!m_decodeDone.load()) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_ready.empty()) {
+            return false;
+        }
+    }
+
+    ALint state = AL_STOPPED;
+    ALint queued = 0;
+    ALint processed = 0;
+    alGetSourcei(m_source, AL_SOURCE_STATE, &state);
+    alGetSourcei(m_source, AL_BUFFERS_QUEUED, &queued);
+    alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processed);
+    return state != AL_PLAYING && state != AL_PAUSED && queued == processed;
+}
+
+void StreamingSource::DecodeLoop(void* vorbisHandle)
+{
+    stb_vorbis* vorbis = static_cast<stb_vorbis*>(vorbisHandle);
+
+    for (;;) {
+        Chunk chunk;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] {
+                return m_stopRequested || m_ready.size() < static_cast<size_t>(kDecodeAheadChunks);
+            });
+            if (m_stopRequested) {
+                break;
+            }
+            if (!m_spare.empty()) {
+                chunk = std::move(m_spare.back());
+                m_spare.pop_back();
+            }
+        }
+
+        chunk.samples.resize(static_cast<size_t>(kBufferFrames) * m_channels);
+        chunk.frames = stb_vorbis_get_samples_short_interleaved(
+            vorbis, m_channels, chunk.samples.data(), static_cast<int>(chunk.samples.size()));
+        if (chunk.frames <= 0) {
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_ready.push_back(std::move(chunk));
+    }
+
+    stb_vorbis_close(vorbis);
+    m_decodeDone = true;
+}
+
+void StreamingSource::StopDecoder()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopRequested = true;
+    }
+    m_cv.notify_all();
+    if (m_decoder.joinable()) {
+        m_decoder.join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (Chunk& chunk : m_ready) {
+        m_spare.push_back(std::move(chunk));
+    }
+    m_ready.clear();
+}
+
+bool StreamingSource::TryPopChunk(Chunk& out)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_ready.empty()) {
+            return false;
+        }
+        out = std::move(m_ready.front());
+        m_ready.pop_front();
+    }
+    m_cv.notify_one();
+    return true;
+}
+
+} // namespace sound
@@ -0,0 +1,503 @@
+#include <ASCIICraft/world/block/models/BakedModelCache.hpp>
+
+#include <ASCIICraft/textures/BlockTextureCatalog.hpp>
+#include <ASCIICraft/world/block/FaceCulling.hpp>
+#include <ASCIICraft/world/block/models/BlockModel.hpp>
+#include <ASCIICraft/world/block/models/BlockModelLibrary.hpp>
+#include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
+
+#include <ASCIIgL/util/Logger.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace blockmodels {
+
+namespace {
+
+constexpr char kMagic[4] = { 'A', 'C', 'B', 'M' };
+
+// ---------------------------------------------------------------------------
+// Hashing
+// ---------------------------------------------------------------------------
+
+constexpr uint64_t kFnvOffset = 1469598103934665603ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+void HashBytes(uint64_t& h, const void* data, size_t size) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        h ^= p[i];
+        h *= kFnvPrime;
+    }
+}
+
+void HashString(uint64_t& h, const std::string& s) {
+    const uint64_t len = s.size();
+    HashBytes(h, &len, sizeof(len));
+    HashBytes(h, s.data(), s.size());
+}
+
+template <typename T>
+void HashValue(uint64_t& h, const T& v) {
+    HashBytes(h, &v, sizeof(v));
+}
+
+// ---------------------------------------------------------------------------
+// Read-only file mapping
+// ---------------------------------------------------------------------------
+
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) return;
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file_, &size) || size.QuadPart <= 0) return;
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_) return;
+        void* view = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+        if (!view) return;
+        data_ = static_cast<const std::byte*>(view);
+        size_ = static_cast<size_t>(size.QuadPart);
+#else
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) return;
+        struct stat st{};
+        if (::fstat(fd_, &st) != 0 || st.st_size <= 0) return;
+        void* view = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (view == MAP_FAILED) return;
+        data_ = static_cast<const std::byte*>(view);
+        size_ = static_cast<size_t>(st.st_size);
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+        if (data_) UnmapViewOfFile(data_);
+        if (mapping_) CloseHandle(mapping_);
+        if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+        if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+        if (fd_ >= 0) ::close(fd_);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const std::byte* Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+private:
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+};
+
+// ---------------------------------------------------------------------------
+// Serialization (native endianness; the blob never leaves the machine that wrote it)
+// ---------------------------------------------------------------------------
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint64_t assetHash;
+    uint64_t registrySignature;
+    double coldBuildMs;
+    uint32_t modelCount;
+    uint32_t typeCount;
+};
+
+class BlobWriter {
+public:
+    template <typename T>
+    void Put(const T& v) {
+        const size_t at = bytes_.size();
+        bytes_.resize(at + sizeof(T));
+        std::memcpy(bytes_.data() + at, &v, sizeof(T));
+    }
+
+    void PutBytes(const void* data, size_t size) {
+        const size_t at = bytes_.size();
+        bytes_.resize(at + size);
+        if (size) std::memcpy(bytes_.data() + at, data, size);
+    }
+
+    void PutString(const std::string& s) {
+        Put(static_cast<uint32_t>(s.size()));
+        PutBytes(s.data(), s.size());
+    }
+
+    void PutLayer(const blockstate::RenderLayer& layer) {
+        Put(static_cast<uint32_t>(layer.vertices.size()));
+        PutBytes(layer.vertices.data(), layer.vertices.size());
+        Put(static_cast<uint32_t>(layer.indices.size()));
+        PutBytes(layer.indices.data(), layer.indices.size() * sizeof(int));
+        Put(static_cast<uint32_t>(layer.faces.size()));
+        for (const blockstate::FaceRange& f : layer.faces) {
+            Put(static_cast<int32_t>(f.vertByteOffset));
+            Put(static_cast<int32_t>(f.vertByteCount));
+            Put(static_cast<int32_t>(f.idxOffset));
+            Put(static_cast<int32_t>(f.idxCount));
+            Put(f.cardinalFace);
+        }
+    }
+
+    std::vector<std::byte>& Bytes() { return bytes_; }
+
+private:
+    std::vector<std::byte> bytes_;
+};
+
+// Bounds-checked cursor over the mapped blob; any overrun marks the blob invalid.
+class BlobReader {
+public:
+    BlobReader(const std::byte* data, size_t size) : p_(data), end_(data + size) {}
+
+    template <typename T>
+    bool Get(T& out) {
+        if (static_cast<size_t>(end_ - p_) < sizeof(T)) return Fail();
+        std::memcpy(&out, p_, sizeof(T));
+        p_ += sizeof(T);
+        return true;
+    }
+
+    bool GetBytes(void* out, size_t size) {
+        if (static_cast<size_t>(end_ - p_) < size) return Fail();
+        if (size) std::memcpy(out, p_, size);
+        p_ += size;
+        return true;
+    }
+
+    bool GetString(std::string& out) {
+        uint32_t len = 0;
+        if (!Get(len) || static_cast<size_t>(end_ - p_) < len) return Fail();
+        out.assign(reinterpret_cast<const char*>(p_), len);
+        p_ += len;
+        return true;
+    }
+
+    bool GetLayer(blockstate::RenderLayer& layer) {
+        uint32_t vertexBytes = 0;
+        if (!Get(vertexBytes) || static_cast<size_t>(end_ - p_) < vertexBytes) return Fail();
+        layer.vertices.assign(p_, p_ + vertexBytes);
+        p_ += vertexBytes;
+
+        uint32_t indexCount = 0;
+        if (!Get(indexCount) || static_cast<size_t>(end_ - p_) / sizeof(int) < indexCount) return Fail();
+        layer.indices.resize(indexCount);
+        GetBytes(layer.indices.data(), static_cast<size_t>(indexCount) * sizeof(int));
+
+        uint32_t faceCount = 0;
+        if (!Get(faceCount)) return false;
+        layer.faces.resize(faceCount);
+        for (blockstate::FaceRange& f : layer.faces) {
+            int32_t v[4] = {};
+            if (!GetBytes(v, sizeof(v)) || !Get(f.cardinalFace)) return false;
+            f.vertByteOffset = v[0];
+            f.vertByteCount = v[1];
+            f.idxOffset = v[2];
+            f.idxCount = v[3];
+        }
+        return ok_;
+    }
+
+    bool Ok() const { return ok_; }
+    bool AtEnd() const { return p_ == end_; }
+
+private:
+    bool Fail() {
+        ok_ = false;
+        p_ = end_;
+        return false;
+    }
+
+    const std::byte* p_;
+    const std::byte* end_;
+    bool ok_ = true;
+};
+
+} // namespace
+
+uint64_t BakedModelCache::HashAssetTree(const std::string& assetRoot) {
+    namespace fs = std::filesystem;
+
+    std::vector<fs::path> files;
+    for (const char* sub : { "blockstates", "models" }) {
+        const fs::path dir = fs::path(assetRoot) / sub;
+        std::error_code ec;
+        if (!fs::is_directory(dir, ec)) continue;
+        for (fs::recursive_directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+            if (it->is_regular_file(ec)) {
+                files.push_back(it->path());
+            }
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    uint64_t h = kFnvOffset;
+    std::vector<char> buffer;
+    for (const fs::path& file : files) {
+        HashString(h, file.lexically_relative(assetRoot).generic_string());
+
+        std::ifstream in(file, std::ios::binary | std::ios::ate);
+        if (!in) continue;
+        const std::streamsize size = in.tellg();
+        in.seekg(0, std::ios::beg);
+        buffer.resize(static_cast<size_t>(std::max<std::streamsize>(size, 0)));
+        if (size > 0) in.read(buffer.data(), size);
+        HashValue(h, static_cast<uint64_t>(buffer.size()));
+        HashBytes(h, buffer.data(), buffer.size());
+    }
+    return h;
+}
+
+uint64_t BakedModelCache::ComputeRegistrySignature(
+    const blockstate::BlockStateRegistry& bsr,
+    const std::vector<std::string>& typeNames
+) {
+    uint64_t h = kFnvOffset;
+    HashValue(h, kFormatVersion);
+    for (const std::string& name : typeNames) {
+        const blockstate::BlockType& type = bsr.GetType(bsr.GetTypeId(name));
+        HashString(h, type.name);
+        HashValue(h, type.baseStateId);
+        HashValue(h, type.stateCount);
+        for (const blockstate::BlockProperty& prop : type.properties) {
+            HashString(h, prop.name);
+            for (const std::string& value : prop.allowedValues) {
+                HashString(h, value);
+            }
+        }
+    }
+    // Texture-array layers are baked into vertex data.
+    for (const blocktextures::CatalogEntry& entry : blocktextures::GetBlockTextureCatalog()) {
+        HashString(h, entry.textureId ? entry.textureId : "");
+    }
+    return h;
+}
+
+bool BakedModelCache::TryInstall(
+    const std::string& path,
+    const Key& key,
+    const std::vector<std::string>& typeNames,
+    blockstate::BlockStateRegistry& bsr,
+    BlockModelLibrary& modelLibrary,
+    InstallStats* stats
+) {
+    const MappedFile file(path);
+    if (!file.Data()) {
+        return false;
+    }
+
+    BlobReader reader(file.Data(), file.Size());
+    Header header{};
+    if (!reader.Get(header) || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        ASCIIgL::Logger::Warning("BakedModelCache: '" + path + "' is not a model cache; rebuilding");
+        return false;
+    }
+    if (header.version != kFormatVersion || header.assetHash != key.assetHash ||
+        header.registrySignature != key.registrySignature) {
+        ASCIIgL::Logger::Info("BakedModelCache: '" + path + "' is stale (assets, registry or format changed); rebuilding");
+        return false;
+    }
+
+    // Decode everything before touching the library so a corrupt blob leaves it untouched.
+    std::vector<BlockModelLibrary::ModelPtr> models;
+    models.reserve(header.modelCount);
+    for (uint32_t i = 0; i < header.modelCount && reader.Ok(); ++i) {
+        blockstate::BlockModel model;
+        uint8_t flags = 0;
+        reader.Get(flags);
+        model.isFullBlock = (flags & 1u) != 0;
+        model.opaqueNoCull = (flags & 2u) != 0;
+        reader.GetLayer(model.opaque);
+        reader.GetLayer(model.transparent);
+
+        uint32_t boxCount = 0;
+        reader.Get(boxCount);
+        model.collisionBoxes.resize(reader.Ok() ? boxCount : 0);
+        for (blockstate::CollisionAabb& box : model.collisionBoxes) {
+            float v[6] = {};
+            if (!reader.GetBytes(v, sizeof(v))) break;
+            box.min = glm::vec3(v[0], v[1], v[2]);
+            box.max = glm::vec3(v[3], v[4], v[5]);
+        }
+        // Same policy as BakeResolvedModel: only full blocks get neighbour culling.
+        model.computeVisibleFaces = model.isFullBlock ? faceculling::ComputeVisibleFacesFullBlock : nullptr;
+        models.push_back(std::make_shared<const blockstate::BlockModel>(std::move(model)));
+    }
+
+    struct PendingSet {
+        uint32_t stateId;
+        std::vector<BlockModelLibrary::ModelPtr> models;
+    };
+    std::vector<PendingSet> pending;
+
+    if (header.typeCount != typeNames.size()) {
+        return false;
+    }
+    for (uint32_t t = 0; t < header.typeCount && reader.Ok(); ++t) {
+        std::string name;
+        uint32_t baseStateId = 0;
+        uint32_t stateCount = 0;
+        reader.GetString(name);
+        reader.Get(baseStateId);
+        reader.Get(stateCount);
+        if (!reader.Ok() || name != typeNames[t]) {
+            return false;
+        }
+        for (uint32_t s = 0; s < stateCount && reader.Ok(); ++s) {
+            uint32_t setSize = 0;
+            reader.Get(setSize);
+            PendingSet set{ baseStateId + s, {} };
+            for (uint32_t m = 0; m < setSize && reader.Ok(); ++m) {
+                uint32_t modelIndex = 0;
+                if (reader.Get(modelIndex) && modelIndex < models.size()) {
+                    set.models.push_back(models[modelIndex]);
+                } else {
+                    return false;
+                }
+            }
+            if (!set.models.empty()) {
+                pending.push_back(std::move(set));
+            }
+        }
+    }
+    if (!reader.Ok() || !reader.AtEnd()) {
+        ASCIIgL::Logger::Warning("BakedModelCache: '" + path + "' is truncated or corrupt; rebuilding");
+        return false;
+    }
+
+    for (const PendingSet& set : pending) {
+        modelLibrary.RegisterModelSet(set.stateId, set.models, bsr);
+    }
+
+    if (stats) {
+        stats->modelCount = models.size();
+        stats->stateCount = pending.size();
+        stats->blobBytes = file.Size();
+        stats->coldBuildMs = header.coldBuildMs;
+    }
+    return true;
+}
+
+size_t BakedModelCache::Write(
+    const std::string& path,
+    const Key& key,
+    const std::vector<std::string>& typeNames,
+    const blockstate::BlockStateRegistry& bsr,
+    const BlockModelLibrary& modelLibrary,
+    double coldBuildMs
+) {
+    // The library canonicalizes identical models, so pointer identity deduplicates the table.
+    std::vector<const blockstate::BlockModel*> table;
+    std::unordered_map<const blockstate::BlockModel*, uint32_t> tableIndex;
+    BlobWriter body;
+
+    for (const std::string& name : typeNames) {
+        const blockstate::BlockType& type = bsr.GetType(bsr.GetTypeId(name));
+        body.PutString(type.name);
+        body.Put(type.baseStateId);
+        body.Put(type.stateCount);
+        for (uint32_t s = 0; s < type.stateCount; ++s) {
+            const std::vector<BlockModelLibrary::ModelPtr>* set = modelLibrary.GetModelSet(type.baseStateId + s);
+            const uint32_t setSize = set ? static_cast<uint32_t>(set->size()) : 0u;
+            body.Put(setSize);
+            for (uint32_t m = 0; m < setSize; ++m) {
+                const blockstate::BlockModel* model = (*set)[m].get();
+                auto [it, inserted] = tableIndex.try_emplace(model, static_cast<uint32_t>(table.size()));
+                if (inserted) {
+                    table.push_back(model);
+                }
+                body.Put(it->second);
+            }
+        }
+    }
+
+    BlobWriter blob;
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kFormatVersion;
+    header.assetHash = key.assetHash;
+    header.registrySignature = key.registrySignature;
+    header.coldBuildMs = coldBuildMs;
+    header.modelCount = static_cast<uint32_t>(table.size());
+    header.typeCount = static_cast<uint32_t>(typeNames.size());
+    blob.Put(header);
+
+    for (const blockstate::BlockModel* model : table) {
+        const uint8_t flags = static_cast<uint8_t>((model->isFullBlock ? 1u : 0u) | (model->opaqueNoCull ? 2u : 0u));
+        blob.Put(flags);
+        blob.PutLayer(model->opaque);
+        blob.PutLayer(model->transparent);
+        blob.Put(static_cast<uint32_t>(model->collisionBoxes.size()));
+        for (const blockstate::CollisionAabb& box : model->collisionBoxes) {
+            const float v[6] = { box.min.x, box.min.y, box.min.z, box.max.x, box.max.y, box.max.z };
+            blob.PutBytes(v, sizeof(v));
+        }
+    }
+    blob.PutBytes(body.Bytes().data(), body.Bytes().size());
+
+    // Write to a temporary file and rename, so an interrupted write never leaves a half blob behind.
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    const fs::path target(path);
+    if (target.has_parent_path()) {
+        fs::create_directories(target.parent_path(), ec);
+    }
+    const fs::path temp = fs::path(path + ".tmp");
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            ASCIIgL::Logger::Warning("BakedModelCache: cannot write '" + temp.string() + "'");
+            return 0;
+        }
+        out.write(reinterpret_cast<const char*>(blob.Bytes().data()), static_cast<std::streamsize>(blob.Bytes().size()));
+        if (!out) {
+            ASCIIgL::Logger::Warning("BakedModelCache: short write to '" + temp.string() + "'");
+            return 0;
+        }
+    }
+    fs::rename(temp, target, ec);
+    if (ec) {
+        fs::remove(target, ec);
+        fs::rename(temp, target, ec);
+        if (ec) {
+            ASCIIgL::Logger::Warning("BakedModelCache: cannot replace '" + path + "': " + ec.message());
+            return 0;
+        }
+    }
+    return blob.Bytes().size();
+}
+
+} // namespace blockmodels
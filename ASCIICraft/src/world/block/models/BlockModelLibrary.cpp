@@ -131,6 +131,11 @@ const blockstate::BlockModel* BlockModelLibrary::GetModelForBlock(
     return set[idx].get();
 }
 
+const std::vector<BlockModelLibrary::ModelPtr>* BlockModelLibrary::GetModelSet(uint32_t stateId) const {
+    if (stateId >= stateModelSets_.size() || stateModelSets_[stateId].empty()) return nullptr;
+    return &stateModelSets_[stateId];
+}
+
 void BlockModelLibrary::RegisterModel(uint32_t stateId, ModelPtr model, blockstate::BlockStateRegistry& bsr) {
     RegisterModelSet(stateId, { std::move(model) }, bsr);
 }
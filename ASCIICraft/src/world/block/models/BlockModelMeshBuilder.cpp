@@ -66,6 +66,56 @@ void AppendRenderLayer(
     }
 }
 
+void AppendRenderLayerLit(
+    std::vector<std::byte>& dstVerts,
+    std::vector<int>& dstIndices,
+    const blockstate::RenderLayer& layer,
+    glm::vec3 positionOffset,
+    const std::vector<bool>& visibleFaces,
+    const std::array<float, 7>& faceLight
+) {
+    using Src = ASCIIgL::VertStructs::PosUVLayer;
+    using V = ASCIIgL::VertStructs::PosUVLayerLight;
+    constexpr unsigned kFaceUnset = 255;
+    constexpr size_t kUncardinalLight = 6;
+
+    Src src;
+    for (size_t i = 0; i < layer.faces.size(); ++i) {
+        const blockstate::FaceRange& f = layer.faces[i];
+        if (!visibleFaces.empty()) {
+            if (f.cardinalFace != kFaceUnset && f.cardinalFace < visibleFaces.size()) {
+                if (!visibleFaces[f.cardinalFace]) {
+                    continue;
+                }
+            }
+        }
+
+        if (f.vertByteCount <= 0 || (f.vertByteCount % static_cast<int>(sizeof(Src)) != 0)) {
+            continue;
+        }
+        const int vertCount = f.vertByteCount / static_cast<int>(sizeof(Src));
+        const int baseVertex = static_cast<int>(dstVerts.size() / sizeof(V));
+        const float light = faceLight[f.cardinalFace < kUncardinalLight ? f.cardinalFace : kUncardinalLight];
+
+        size_t dstOffset = dstVerts.size();
+        dstVerts.resize(dstOffset + static_cast<size_t>(vertCount) * sizeof(V));
+        const std::byte* srcBytes = layer.vertices.data() + static_cast<size_t>(f.vertByteOffset);
+        for (int v = 0; v < vertCount; ++v) {
+            std::memcpy(&src, srcBytes + static_cast<size_t>(v) * sizeof(Src), sizeof(Src));
+            V out;
+            out.SetXYZ(src.GetXYZ() + positionOffset);
+            out.SetUVLayer(src.GetUVLayer());
+            out.SetLight(light);
+            std::memcpy(dstVerts.data() + dstOffset, &out, sizeof(V));
+            dstOffset += sizeof(V);
+        }
+
+        for (int j = 0; j < f.idxCount; ++j) {
+            dstIndices.push_back(baseVertex + layer.indices[f.idxOffset + j]);
+        }
+    }
+}
+
 BlockModelMeshBuffers BuildMeshBuffers(const blockstate::BlockModel& model, glm::vec3 positionOffset) {
     BlockModelMeshBuffers out;
     const std::vector<bool> noCull;
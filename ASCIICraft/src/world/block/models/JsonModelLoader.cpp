@@ -1,8 +1,10 @@
 #include <ASCIICraft/world/block/models/JsonModelLoader.hpp>
 
+#include <unordered_set>
 #include <utility>
 
 #include <nlohmann/json.hpp>
+#include <oneapi/tbb/parallel_for.h>
 
 namespace blockmodels {
 
@@ -87,6 +89,45 @@ void JsonModelLoader::ClearCaches() {
     modelByResource_.clear();
 }
 
+size_t JsonModelLoader::PrefetchBlockModels(const std::vector<std::string>& resourceIds) {
+    std::unordered_set<std::string> attempted;
+    std::vector<ResourceLocation> wave;
+
+    const auto enqueue = [&](const ResourceLocation& rl) {
+        const std::string key = CanonicalResourceKey(rl);
+        if (modelByResource_.count(key) || !attempted.insert(key).second) return;
+        wave.push_back(rl);
+    };
+
+    for (const std::string& id : resourceIds) {
+        auto rl = ResourceLocation::Parse(id);
+        if (rl.has_value()) enqueue(rl.value());
+    }
+
+    size_t added = 0;
+    std::vector<std::optional<BlockModelDefinition>> parsed;
+    while (!wave.empty()) {
+        parsed.assign(wave.size(), std::nullopt);
+        oneapi::tbb::parallel_for(size_t(0), wave.size(), [&](size_t i) {
+            auto textRes = jsonutil::ReadFileText(ResolveBlockModelPath(wave[i]));
+            if (!textRes.Ok()) return;
+            auto parsedRes = ParseBlockModelJsonText(textRes.value.value(), CanonicalResourceKey(wave[i]));
+            if (parsedRes.Ok()) parsed[i] = std::move(parsedRes.value);
+        });
+
+        const std::vector<ResourceLocation> current = std::move(wave);
+        wave.clear();
+        for (size_t i = 0; i < current.size(); ++i) {
+            if (!parsed[i].has_value()) continue;
+            auto& def = modelByResource_[CanonicalResourceKey(current[i])];
+            def = std::move(parsed[i].value());
+            ++added;
+            if (def.parent.has_value()) enqueue(def.parent.value());
+        }
+    }
+    return added;
+}
+
 std::string JsonModelLoader::CanonicalResourceKey(const ResourceLocation& rl) {
     return rl.ToString();
 }
@@ -3,6 +3,7 @@
 #include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
 #include <ASCIICraft/world/block/state/FaceDir.hpp>
 #include <ASCIICraft/world/chunk/ChunkManager.hpp>
+#include <ASCIICraft/world/query/VoxelAccessor.hpp>
 
 namespace blockplacement::detail {
 
@@ -34,12 +35,22 @@ uint32_t FinalizeFencePlacedState(
     const ChunkManager& chunkManager,
     uint32_t stateId,
     const WorldCoord& position
+) {
+    const worldquery::VoxelAccessor voxels(&chunkManager);
+    return FinalizeFencePlacedState(bsr, voxels, stateId, position);
+}
+
+uint32_t FinalizeFencePlacedState(
+    const blockstate::BlockStateRegistry& bsr,
+    const worldquery::VoxelAccessor& voxels,
+    uint32_t stateId,
+    const WorldCoord& position
 ) {
     uint32_t outStateId = stateId;
 
     for (FaceDir dir : kHorizontalFaceDirs) {
         const WorldCoord neighborPos = NeighborCoord(position, dir);
-        const uint32_t neighborStateId = chunkManager.GetBlockState(neighborPos);
+        const uint32_t neighborStateId = voxels.GetBlockState(neighborPos);
         const bool connected = ShouldFenceConnectToNeighbor(bsr, neighborStateId);
         outStateId = bsr.WithProperty(outStateId, FaceDirToString(dir), connected ? "true" : "false");
     }
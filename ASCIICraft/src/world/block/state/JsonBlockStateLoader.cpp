@@ -1,8 +1,11 @@
 #include <ASCIICraft/world/block/state/JsonBlockStateLoader.hpp>
 
+#include <optional>
+#include <unordered_set>
 #include <utility>
 
 #include <nlohmann/json.hpp>
+#include <oneapi/tbb/parallel_for.h>
 
 namespace blockstate {
 
@@ -115,6 +118,34 @@ void JsonBlockStateLoader::ClearCaches() {
     blockstateByResource_.clear();
 }
 
+size_t JsonBlockStateLoader::PrefetchBlockstates(const std::vector<std::string>& resourceIds) {
+    std::unordered_set<std::string> seen;
+    std::vector<blockmodels::ResourceLocation> pending;
+    for (const std::string& id : resourceIds) {
+        auto rl = blockmodels::ResourceLocation::Parse(id);
+        if (!rl.has_value()) continue;
+        const std::string key = CanonicalResourceKey(rl.value());
+        if (blockstateByResource_.count(key) || !seen.insert(key).second) continue;
+        pending.push_back(std::move(rl.value()));
+    }
+
+    std::vector<std::optional<BlockstateDefinition>> parsed(pending.size());
+    oneapi::tbb::parallel_for(size_t(0), pending.size(), [&](size_t i) {
+        auto textRes = jsonutil::ReadFileText(ResolveBlockstatePath(pending[i]));
+        if (!textRes.Ok()) return;
+        auto parsedRes = ParseBlockstateJsonText(textRes.value.value(), CanonicalResourceKey(pending[i]));
+        if (parsedRes.Ok()) parsed[i] = std::move(parsedRes.value);
+    });
+
+    size_t added = 0;
+    for (size_t i = 0; i < pending.size(); ++i) {
+        if (!parsed[i].has_value()) continue;
+        blockstateByResource_[CanonicalResourceKey(pending[i])] = std::move(parsed[i].value());
+        ++added;
+    }
+    return added;
+}
+
 std::string JsonBlockStateLoader::CanonicalResourceKey(const blockmodels::ResourceLocation& rl) {
     return rl.ToString();
 }
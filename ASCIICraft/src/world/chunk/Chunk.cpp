@@ -17,6 +17,7 @@ Chunk::Chunk(const ChunkCoord& coord)
     : coord(coord)
     , generated(false)
     , dirty(true)
+    , lit(false)
     , hasOpaqueMesh(false)
     , hasOpaqueNoCullMesh(false) {
     
@@ -71,7 +72,7 @@ void Chunk::ApplyMeshData(ChunkMeshData&& data, ASCIIgL::TextureArray* blockText
     if (data.HasOpaque()) {
         opaqueMesh = std::make_unique<ASCIIgL::Mesh>(
             std::move(data.opaqueVertices),
-            ASCIIgL::VertFormats::PosUVLayer(),
+            ASCIIgL::VertFormats::PosUVLayerLight(),
             std::move(data.opaqueIndices),
             blockTextures
         );
@@ -81,7 +82,7 @@ void Chunk::ApplyMeshData(ChunkMeshData&& data, ASCIIgL::TextureArray* blockText
     if (data.HasTransparent()) {
         transparentMesh = std::make_unique<ASCIIgL::Mesh>(
             std::move(data.transparentVertices),
-            ASCIIgL::VertFormats::PosUVLayer(),
+            ASCIIgL::VertFormats::PosUVLayerLight(),
             std::move(data.transparentIndices),
             blockTextures
         );
@@ -91,13 +92,26 @@ void Chunk::ApplyMeshData(ChunkMeshData&& data, ASCIIgL::TextureArray* blockText
     if (data.HasOpaqueNoCull()) {
         opaqueNoCullMesh = std::make_unique<ASCIIgL::Mesh>(
             std::move(data.opaqueNoCullVertices),
-            ASCIIgL::VertFormats::PosUVLayer(),
+            ASCIIgL::VertFormats::PosUVLayerLight(),
             std::move(data.opaqueNoCullIndices),
             blockTextures
         );
         hasOpaqueNoCullMesh = (opaqueNoCullMesh != nullptr);
     }
 
+    // Chunk geometry is only ever drawn: keep it on the GPU alone, suballocated from the shared
+    // slabs. If the GPU copy is lost the callback schedules a normal remesh (which replaces these
+    // meshes) instead of rebuilding inline.
+    for (ASCIIgL::Mesh* mesh : {opaqueMesh.get(), transparentMesh.get(), opaqueNoCullMesh.get()}) {
+        if (!mesh) continue;
+        mesh->SetPooled(true);
+        mesh->SetResidency(ASCIIgL::MeshResidency::DiscardAfterUpload);
+        mesh->SetRebuildCallback([this](std::vector<std::byte>&, std::vector<int>&) {
+            dirty = true;
+            return false;
+        });
+    }
+
     SetDirty(false);
 }
 
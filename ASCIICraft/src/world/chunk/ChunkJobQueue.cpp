@@ -43,6 +43,9 @@ void ChunkJobQueue::EnqueueTerrainGen(Chunk* chunk) {
         } else {
             std::fill(blocks, blocks + Chunk::VOLUME, 0u);
         }
+        // Group here so the main thread applies one bulk write per target chunk.
+        GroupPlacementsByChunk(result.crossChunkBlocks, result.crossChunkGroups);
+        result.crossChunkBlocks.clear();
         completedTerrainQueue_.push(CompletedTerrainResult{ coord, std::move(result) });
     });
 }
@@ -65,21 +68,43 @@ void ChunkJobQueue::EnqueueMeshGen(Chunk* chunk) {
         }
     }
 
+    // Light of the chunk and its lit neighbors (index 6 = the chunk itself); unlit ones stay empty.
+    auto lightCopies = std::make_shared<std::array<std::optional<worldlight::ChunkLight>, 7>>();
+    for (int i = 0; i < 6; ++i) {
+        Chunk* neighbor = chunk->GetNeighbor(i);
+        if (neighbor && neighbor->IsLit()) (*lightCopies)[i] = neighbor->GetLight();
+    }
+    if (chunk->IsLit()) (*lightCopies)[6] = chunk->GetLight();
+
     auto* modelLib = registry_.ctx().find<blockmodels::BlockModelLibrary>();
     if (!modelLib) {
         ASCIIgL::Logger::Warning("EnqueueMeshGen: BlockModelLibrary not found in context.");
         return;
     }
 
-    taskGroup_.run([this, coord, chunkCopy, neighborCopies, bsr, modelLib]() {
+    taskGroup_.run([this, coord, chunkCopy, neighborCopies, lightCopies, bsr, modelLib]() {
         std::array<const uint32_t*, 6> ptrs{};
-        for (int i = 0; i < 6; ++i)
+        std::array<const worldlight::ChunkLight*, 6> lightPtrs{};
+        for (int i = 0; i < 6; ++i) {
             ptrs[i] = (*neighborCopies)[i].empty() ? nullptr : (*neighborCopies)[i].data();
-        ChunkMeshData data = BuildChunkMeshData(coord, chunkCopy->data(), ptrs, bsr, modelLib);
+            lightPtrs[i] = (*lightCopies)[i] ? &*(*lightCopies)[i] : nullptr;
+        }
+        const worldlight::ChunkLight* light = (*lightCopies)[6] ? &*(*lightCopies)[6] : nullptr;
+        ChunkMeshData data = BuildChunkMeshData(coord, chunkCopy->data(), ptrs, bsr, modelLib, light, lightPtrs);
         completedMeshQueue_.push(CompletedMeshResult{ coord, std::move(data) });
     });
 }
 
+void ChunkJobQueue::EnqueueLight(std::shared_ptr<worldlight::LightJob> job) {
+    if (!job) return;
+    auto* bsr = registry_.ctx().find<blockstate::BlockStateRegistry>();
+    if (!bsr) return;
+    taskGroup_.run([this, job = std::move(job), bsr]() {
+        worldlight::RunLightJob(*job, *bsr);
+        completedLightQueue_.push(CompletedLightResult{ job });
+    });
+}
+
 void ChunkJobQueue::DrainCompletedTerrainResultsInto(std::vector<CompletedTerrainResult>& out) {
     out.clear();
     CompletedTerrainResult result;
@@ -99,6 +124,14 @@ void ChunkJobQueue::DrainCompletedMeshResultsInto(std::vector<CompletedMeshResul
     }
 }
 
+void ChunkJobQueue::DrainCompletedLightResultsInto(std::vector<CompletedLightResult>& out) {
+    out.clear();
+    CompletedLightResult result;
+    while (completedLightQueue_.try_pop(result)) {
+        out.push_back(std::move(result));
+    }
+}
+
 void ChunkJobQueue::EnqueueUnload(ChunkCoord coord, std::shared_ptr<Chunk> chunk, std::optional<MetaBucket> meta, bool closeRegionAfterSave, std::shared_ptr<RegionFile> region) {
     if (!chunk || !region) return;
     UnloadSaveCallback cb = unloadSaveCallback_;
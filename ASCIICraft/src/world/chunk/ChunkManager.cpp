@@ -24,6 +24,7 @@
 #include <ASCIICraft/world/block/state/FaceDir.hpp>
 #include <ASCIICraft/world/chunk/ChunkUtil.hpp>
 #include <ASCIICraft/world/query/BlockRaycast.hpp>
+#include <ASCIICraft/world/query/VoxelAccessor.hpp>
 
 ChunkManager::ChunkManager(
     entt::registry& registry,
@@ -136,13 +137,15 @@ void ChunkManager::LoadChunk(const ChunkCoord& coord) {
             ApplyEditsToChunk(chunkPtr, it->second.edits);
             crossChunkEdits.erase(it);
         }
+        QueueChunkRelight(coord);
     } else {
         // Enqueue terrain gen; keep metadata/edits in crossChunkEdits to apply when terrain result is drained
+        // Pending edits are newer than the saved ones, so they win on the same position.
         std::vector<CrossChunkEdit> mergedEdits = std::move(cachedMetaBucket->edits);
+        NormalizeEdits(mergedEdits);
         auto it = crossChunkEdits.find(coord);
         if (it != crossChunkEdits.end()) {
-            for (auto& e : it->second.edits)
-                mergedEdits.push_back(std::move(e));
+            MergeEdits(mergedEdits, it->second.edits);
             crossChunkEdits.erase(it);
         }
         crossChunkEdits[coord].edits = std::move(mergedEdits);
@@ -245,11 +248,23 @@ void ChunkManager::UnloadChunk(const ChunkCoord& coord) {
         }
     }
 
+    if (lightJobInFlight_) {
+        lightInvalidated_.insert(coord);
+    }
+
     std::shared_ptr<RegionFile> region = GetOrCreateRegion(rp);
     loadedChunks.erase(itChunk);
     chunkJobQueue->EnqueueUnload(coord, std::move(chunkToUnload), std::move(meta), closeRegionAfterSave, std::move(region));
 }
 
+const Chunk* ChunkManager::FindChunk(const ChunkCoord& coord) const {
+    auto it = loadedChunks.find(coord);
+    if (it != loadedChunks.end()) {
+        return it->second.get();
+    }
+    return nullptr;
+}
+
 bool ChunkManager::IsChunkLoaded(const ChunkCoord& coord) const {
     return loadedChunks.find(coord) != loadedChunks.end();
 }
@@ -340,7 +355,7 @@ void ChunkManager::LoadChunksInRadius(const ChunkCoord& playerChunk, unsigned in
 
         for (const ChunkCoord& coord : newlyLoadedChunks) {
             Chunk* c = GetChunk(coord);
-            if (c && c->IsGenerated() && !c->HasMesh() && AllNeighborsGenerated(coord))
+            if (c && c->IsGenerated() && c->IsLit() && !c->HasMesh() && AllNeighborsGenerated(coord))
                 chunkJobQueue->EnqueueMeshGen(c);
         }
     }
@@ -495,18 +510,18 @@ void ChunkManager::ApplyDrainedTerrainResults() {
             ApplyEditsToChunk(c, metaIt->second.edits);
             crossChunkEdits.erase(metaIt);
         }
-        for (const auto& placement : r.result.crossChunkBlocks) {
-            if (placement.pos.ToChunkCoord() == r.coord) {
-                glm::ivec3 local = placement.pos.ToLocalChunkPos();
-                c->SetBlockState(local.x, local.y, local.z, placement.stateId);
+        // Placements were grouped per target chunk by the terrain job.
+        for (const ChunkEditGroup& group : r.result.crossChunkGroups) {
+            if (group.chunk == r.coord) {
+                ApplyEditsToChunk(c, group.edits);
             } else {
-                SetBlockState(placement.pos.x, placement.pos.y, placement.pos.z, placement.stateId);
+                ApplyChunkEditGroup(group);
             }
         }
         c->SetGenerated(true);
         UpdateChunkNeighbors(r.coord);
-        if (AllNeighborsGenerated(r.coord))
-            chunkJobQueue->EnqueueMeshGen(c);
+        // Meshed once its light arrives (EnqueueMeshForDirtyChunks).
+        QueueChunkRelight(r.coord);
     }
 }
 
@@ -527,6 +542,7 @@ void ChunkManager::ApplyDrainedMeshResults() {
 void ChunkManager::DrainAndApplyJobResults() {
     PROFILE_SCOPE("Chunk.DrainAndApplyJobResults");
     ApplyDrainedTerrainResults();
+    ApplyDrainedLightResults();
     ApplyDrainedMeshResults();
 }
 
@@ -544,12 +560,14 @@ void ChunkManager::RebuildChunkMeshImmediate(Chunk* c) {
 
     std::array<std::vector<uint32_t>, 6> neighborBlocks;
     std::array<const uint32_t*, 6> ptrs{};
+    std::array<const worldlight::ChunkLight*, 6> lightPtrs{};
     for (int i = 0; i < 6; ++i) {
         Chunk* neighbor = c->GetNeighbor(i);
         if (neighbor) {
             neighborBlocks[i].resize(Chunk::VOLUME);
             std::memcpy(neighborBlocks[i].data(), neighbor->GetBlockData(), Chunk::VOLUME * sizeof(uint32_t));
             ptrs[i] = neighborBlocks[i].data();
+            lightPtrs[i] = neighbor->IsLit() ? &neighbor->GetLight() : nullptr;
         } else {
             ptrs[i] = nullptr;
         }
@@ -561,7 +579,8 @@ void ChunkManager::RebuildChunkMeshImmediate(Chunk* c) {
         return;
     }
 
-    ChunkMeshData data = BuildChunkMeshData(coord, chunkBlocks.data(), ptrs, bsr, modelLib);
+    const worldlight::ChunkLight* light = c->IsLit() ? &c->GetLight() : nullptr;
+    ChunkMeshData data = BuildChunkMeshData(coord, chunkBlocks.data(), ptrs, bsr, modelLib, light, lightPtrs);
     c->ApplyMeshData(std::move(data), texArray);
 }
 
@@ -576,7 +595,7 @@ void ChunkManager::EnqueueMeshForDirtyChunks() {
     eligible.reserve(loadedChunks.size());
     for (const auto& pair : loadedChunks) {
         Chunk* chunk = pair.second.get();
-        if (chunk && chunk->IsDirty() && chunk->IsGenerated() && AllNeighborsGenerated(pair.first))
+        if (chunk && chunk->IsDirty() && chunk->IsGenerated() && chunk->IsLit() && AllNeighborsGenerated(pair.first))
             eligible.push_back({pair.first, chunk});
     }
     if (eligible.empty()) return;
@@ -680,7 +699,7 @@ void ChunkManager::SetBlockState(int x, int y, int z, uint32_t stateId) {
             crossChunkEdits.insert({chunkCoord, metaBucket});
             metaTimeTracker.push(chunkCoord);
         } else {
-            it->second.edits.push_back(crossChunkEdit);
+            UpsertEdit(it->second.edits, crossChunkEdit);
             it->second.lastTouched = util::NowSeconds();
         }
     } else {
@@ -688,9 +707,137 @@ void ChunkManager::SetBlockState(int x, int y, int z, uint32_t stateId) {
         chunk->SetDirty(true);
 
         BlockUpdateNeighboursDirty(chunkCoord, localPos);
+        RecordBlockChange(x, y, z);
+    }
+}
+
+size_t ChunkManager::SetBlockStates(std::vector<WorldBlockPlacement>& writes) {
+    const auto chunkOf = [](const WorldBlockPlacement& w) { return w.pos.ToChunkCoord(); };
+    std::stable_sort(writes.begin(), writes.end(), [&](const WorldBlockPlacement& a, const WorldBlockPlacement& b) {
+        const ChunkCoord ca = chunkOf(a);
+        const ChunkCoord cb = chunkOf(b);
+        if (ca.x != cb.x) return ca.x < cb.x;
+        if (ca.y != cb.y) return ca.y < cb.y;
+        return ca.z < cb.z;
+    });
+
+    size_t chunksWritten = 0;
+    for (size_t begin = 0; begin < writes.size();) {
+        const ChunkCoord chunkCoord = chunkOf(writes[begin]);
+        size_t end = begin + 1;
+        while (end < writes.size() && chunkOf(writes[end]) == chunkCoord) {
+            ++end;
+        }
+
+        Chunk* chunk = GetChunk(chunkCoord);
+        if (!chunk || !chunk->IsGenerated()) {
+            // Deferred into crossChunkEdits, same as a single write.
+            for (size_t i = begin; i < end; ++i) {
+                SetBlockState(writes[i].pos, writes[i].stateId);
+            }
+            begin = end;
+            continue;
+        }
+
+        uint8_t boundaryFaces = 0;
+        for (size_t i = begin; i < end; ++i) {
+            const WorldCoord& pos = writes[i].pos;
+            const glm::ivec3 localPos = pos.ToLocalChunkPos();
+            chunk->SetBlockState(localPos.x, localPos.y, localPos.z, writes[i].stateId);
+            for (FaceDir face : kAllFaceDirs) {
+                if (chunkutil::IsOnChunkFaceBoundary(localPos, face)) {
+                    boundaryFaces |= static_cast<uint8_t>(1u << FaceDirToIndex(face));
+                }
+            }
+            RecordBlockChange(pos.x, pos.y, pos.z);
+        }
+
+        chunk->SetDirty(true);
+        for (FaceDir face : kAllFaceDirs) {
+            if (boundaryFaces & (1u << FaceDirToIndex(face))) {
+                if (Chunk* neighbor = GetChunk(NeighborChunkCoord(chunkCoord, face))) {
+                    neighbor->SetDirty(true);
+                }
+            }
+        }
+        ++chunksWritten;
+        begin = end;
+    }
+    return chunksWritten;
+}
+
+size_t ChunkManager::ApplyChunkEditGroups(const std::vector<ChunkEditGroup>& groups) {
+    size_t chunksWritten = 0;
+    for (const ChunkEditGroup& group : groups) {
+        if (ApplyChunkEditGroup(group)) {
+            ++chunksWritten;
+        }
+    }
+    return chunksWritten;
+}
+
+bool ChunkManager::ApplyChunkEditGroup(const ChunkEditGroup& group) {
+    if (group.edits.empty()) return false;
+
+    Chunk* chunk = GetChunk(group.chunk);
+    if (!chunk || !chunk->IsGenerated()) {
+        auto it = crossChunkEdits.find(group.chunk);
+        if (it == crossChunkEdits.end()) {
+            MetaBucket metaBucket;
+            metaBucket.edits = group.edits;
+            crossChunkEdits.insert({group.chunk, std::move(metaBucket)});
+            metaTimeTracker.push(group.chunk);
+        } else {
+            MergeEdits(it->second.edits, group.edits);
+            it->second.lastTouched = util::NowSeconds();
+        }
+        return false;
+    }
+
+    const glm::ivec3 origin = group.chunk.ToVec3() * sizes::CHUNK_SIZE;
+    uint8_t boundaryFaces = 0;
+    for (const CrossChunkEdit& edit : group.edits) {
+        glm::ivec3 localPos;
+        edit.UnpackPos(localPos.x, localPos.y, localPos.z);
+        chunk->SetBlockState(localPos.x, localPos.y, localPos.z, edit.stateId);
+        for (FaceDir face : kAllFaceDirs) {
+            if (chunkutil::IsOnChunkFaceBoundary(localPos, face)) {
+                boundaryFaces |= static_cast<uint8_t>(1u << FaceDirToIndex(face));
+            }
+        }
+        RecordBlockChange(origin.x + localPos.x, origin.y + localPos.y, origin.z + localPos.z);
+    }
+
+    chunk->SetDirty(true);
+    for (FaceDir face : kAllFaceDirs) {
+        if (boundaryFaces & (1u << FaceDirToIndex(face))) {
+            if (Chunk* neighbor = GetChunk(NeighborChunkCoord(group.chunk, face))) {
+                neighbor->SetDirty(true);
+            }
+        }
+    }
+    return true;
+}
+
+void ChunkManager::RecordBlockChange(int x, int y, int z) {
+    lightEdits_.emplace_back(x, y, z);
+    if (blockChanges_.size() < MAX_TRACKED_BLOCK_CHANGES) {
+        blockChanges_.emplace_back(x, y, z);
+    } else {
+        blockChangesOverflowed_ = true;
     }
 }
 
+void ChunkManager::TakeBlockChanges(std::vector<WorldCoord>& out, bool& overflowed) {
+    out.clear();
+    overflowed = blockChangesOverflowed_;
+    if (!overflowed) {
+        out.swap(blockChanges_);
+    }
+    blockChanges_.clear();
+    blockChangesOverflowed_ = false;
+}
+
 void ChunkManager::Update() {
     PROFILE_SCOPE("Chunk.Update");
 
@@ -702,6 +849,10 @@ void ChunkManager::Update() {
         PROFILE_SCOPE("Chunk.Update.UpdateChunkLoading");
         UpdateChunkLoading();
     }
+    {
+        PROFILE_SCOPE("Chunk.Update.EnqueueLightJob");
+        EnqueueLightJob();
+    }
     {
         PROFILE_SCOPE("Chunk.Update.EnqueueMeshForDirtyChunks");
         EnqueueMeshForDirtyChunks();
@@ -741,14 +892,23 @@ void ChunkManager::RenderChunks() {
         return;
     }
 
+    if (blockUniforms_.material != mat.get()) {
+        blockUniforms_.material = mat.get();
+        blockUniforms_.mvp = mat->GetUniformHandle("mvp");
+        blockUniforms_.cameraPos = mat->GetUniformHandle("cameraPos");
+        blockUniforms_.fogParams = mat->GetUniformHandle("fogParams");
+        blockUniforms_.fogColor = mat->GetUniformHandle("fogColor");
+        blockUniforms_.waterAnimPhase = mat->GetUniformHandle("waterAnimPhase");
+    }
+
     // --- MVP setup ---
     glm::mat4 mvp = cam->proj * cam->view * glm::mat4(1.0f);
-    mat->SetMatrix4("mvp", mvp);
+    mat->Set(blockUniforms_.mvp, mvp);
 
     // --- Fog (from ChunkManagerFogParams; start/end tied to render distance) ---
-    mat->SetFloat3("cameraPos", pos);
-    mat->SetFloat4("fogParams", glm::vec4(fogParams_.fogStart, fogParams_.fogEnd, 0.0f, 0.0f));
-    mat->SetFloat3("fogColor", fogParams_.fogColor);
+    mat->Set(blockUniforms_.cameraPos, pos);
+    mat->Set(blockUniforms_.fogParams, glm::vec4(fogParams_.fogStart, fogParams_.fogEnd, 0.0f, 0.0f));
+    mat->Set(blockUniforms_.fogColor, fogParams_.fogColor);
 
     // --- Water animation phase (continuous, used by terrain PS) ---
     {
@@ -758,9 +918,7 @@ void ChunkManager::RenderChunks() {
         if (waterParams_.animPhase > 1000.0f) {
             waterParams_.animPhase = waterParams_.animPhase - floor(waterParams_.animPhase);
         }
-        if (mat->HasUniform("waterAnimPhase")) {
-            mat->SetFloat("waterAnimPhase", waterParams_.animPhase);
-        }
+        mat->Set(blockUniforms_.waterAnimPhase, waterParams_.animPhase);  // no-op if the shader lacks it
     }
 
     // --- Prepare renderer draw-calls ---
@@ -829,8 +987,9 @@ std::optional<worldquery::BlockRayHit> ChunkManager::RaycastView(
     float reach
 ) const {
     const auto* bsr = registry.ctx().find<blockstate::BlockStateRegistry>();
+    const worldquery::VoxelAccessor voxels(this);
     return worldquery::RaycastBlocks(
-        [this](int x, int y, int z) { return GetBlockState(x, y, z); },
+        voxels,
         bsr,
         headPos,
         lookDir,
@@ -0,0 +1,133 @@
+#include <ASCIICraft/world/chunk/ChunkManager.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <ASCIIgL/util/Profiler.hpp>
+
+#include <ASCIICraft/world/block/state/FaceDir.hpp>
+#include <ASCIICraft/world/chunk/Chunk.hpp>
+#include <ASCIICraft/world/light/LightEngine.hpp>
+
+void ChunkManager::QueueChunkRelight(const ChunkCoord& coord) {
+    lightRelightQueue_.push_back(coord);
+}
+
+void ChunkManager::EnqueueLightJob() {
+    if (lightJobInFlight_) return;
+    if (lightRelightQueue_.empty() && lightEdits_.empty() && lightSpills_.empty()) return;
+    PROFILE_SCOPE("Chunk.EnqueueLightJob");
+
+    auto job = std::make_shared<worldlight::LightJob>();
+    std::unordered_map<ChunkCoord, size_t> sectionIndex;
+
+    // Copies a chunk into the job once. Chunks without light only join to be relit.
+    const auto addSection = [&](const ChunkCoord& coord, bool relight) {
+        Chunk* c = GetChunk(coord);
+        if (!c || !c->IsGenerated() || (!relight && !c->IsLit())) return false;
+        const auto [it, inserted] = sectionIndex.emplace(coord, job->sections.size());
+        if (!inserted) {
+            job->sections[it->second].relight |= relight;
+            return true;
+        }
+        worldlight::LightSection& section = job->sections.emplace_back();
+        section.coord = coord;
+        section.blocks.assign(c->GetBlockData(), c->GetBlockData() + Chunk::VOLUME);
+        section.light = c->GetLight();
+        section.lit = c->IsLit();
+        section.relight = relight;
+        return true;
+    };
+    const auto addWithNeighbors = [&](const ChunkCoord& coord, bool relight) {
+        if (!addSection(coord, relight)) return false;
+        for (FaceDir face : kAllFaceDirs) {
+            addSection(NeighborChunkCoord(coord, face), false);
+        }
+        return true;
+    };
+    const auto isRelit = [&](const ChunkCoord& coord) {
+        const auto it = sectionIndex.find(coord);
+        return it != sectionIndex.end() && job->sections[it->second].relight;
+    };
+
+    // Relights first, so this job's edits and spills can tell which chunks they are already covered by.
+    size_t relights = 0;
+    size_t consumed = 0;
+    for (; consumed < lightRelightQueue_.size() && relights < MAX_LIGHT_RELIGHTS_PER_JOB; ++consumed) {
+        const ChunkCoord& coord = lightRelightQueue_[consumed];
+        const Chunk* c = GetChunk(coord);
+        if (!c || !c->IsGenerated() || c->IsLit() || isRelit(coord)) continue;
+        addSection(coord, true);
+        ++relights;
+    }
+    lightRelightQueue_.erase(lightRelightQueue_.begin(), lightRelightQueue_.begin() + static_cast<std::ptrdiff_t>(consumed));
+    for (size_t i = 0, n = job->sections.size(); i < n; ++i) {
+        if (!job->sections[i].relight) continue;
+        const ChunkCoord coord = job->sections[i].coord;
+        for (FaceDir face : kAllFaceDirs) {
+            addSection(NeighborChunkCoord(coord, face), false);
+        }
+    }
+
+    // Edits and spills only matter in lit chunks; an unlit one computes everything when it is relit.
+    for (const WorldCoord& pos : lightEdits_) {
+        const ChunkCoord coord = pos.ToChunkCoord();
+        if (isRelit(coord)) continue;
+        if (addWithNeighbors(coord, false)) {
+            job->edits.push_back(pos);
+        }
+    }
+    lightEdits_.clear();
+    for (const worldlight::LightSpill& spill : lightSpills_) {
+        const ChunkCoord coord = spill.pos.ToChunkCoord();
+        if (isRelit(coord)) continue;
+        if (addWithNeighbors(coord, false)) {
+            job->spillsIn.push_back(spill);
+        }
+    }
+    lightSpills_.clear();
+
+    if (job->sections.empty()) return;
+
+    // The top face of a chunk with no lit chunk above it sees open sky.
+    for (worldlight::LightSection& section : job->sections) {
+        const Chunk* above = GetChunk(NeighborChunkCoord(section.coord, FaceDir::Top));
+        section.skyAbove = !above || !above->IsLit();
+    }
+
+    lightJobInFlight_ = true;
+    chunkJobQueue->EnqueueLight(std::move(job));
+}
+
+void ChunkManager::ApplyDrainedLightResults() {
+    chunkJobQueue->DrainCompletedLightResultsInto(drainLightBuffer_);
+    for (CompletedLightResult& r : drainLightBuffer_) {
+        worldlight::LightJob& job = *r.job;
+        for (const worldlight::LightSection& section : job.sections) {
+            if (!section.relight && !section.changed) continue;
+            if (lightInvalidated_.count(section.coord)) continue;
+            Chunk* c = GetChunk(section.coord);
+            if (!c || !c->IsGenerated()) continue;
+
+            c->SetLight(section.light);
+            if (section.relight) c->SetLit(true);
+            c->SetDirty(true);
+
+            // Neighbour meshes sample this chunk's border cells.
+            const uint8_t faces = section.relight ? uint8_t((1u << kFaceCount) - 1) : section.borderFaces;
+            for (FaceDir face : kAllFaceDirs) {
+                if (faces & (1u << FaceDirToIndex(face))) {
+                    if (Chunk* neighbor = GetChunk(NeighborChunkCoord(section.coord, face))) {
+                        neighbor->SetDirty(true);
+                    }
+                }
+            }
+        }
+        lightSpills_.insert(lightSpills_.end(), job.spillsOut.begin(), job.spillsOut.end());
+        lightInvalidated_.clear();
+        lightJobInFlight_ = false;
+    }
+}
@@ -20,6 +20,21 @@ namespace {
 static std::mutex g_missingModelWarnMutex;
 static std::unordered_set<uint32_t> g_missingModelWarnedStateIds;
 
+constexpr float kUnlitPackedLight = float(worldlight::MAX_LIGHT << 4);    // full sky, no block light
+
+float PackedLightAt(
+    int x, int y, int z,
+    const worldlight::ChunkLight* chunkLight,
+    const std::array<const worldlight::ChunkLight*, 6>& neighborLight
+) {
+    FaceDir across;
+    const worldlight::ChunkLight* light = chunkLight;
+    if (chunkutil::TryWrapCrossChunkLocal(x, y, z, across)) {
+        light = neighborLight[FaceDirToIndex(across)];
+    }
+    return light ? float(light->GetPacked(chunkutil::GetBlockIndex(x, y, z))) : kUnlitPackedLight;
+}
+
 } // namespace
 
 ChunkMeshData BuildChunkMeshData(
@@ -27,12 +42,15 @@ ChunkMeshData BuildChunkMeshData(
     const uint32_t* chunkBlocks,
     const std::array<const uint32_t*, 6>& neighborBlocks,
     const blockstate::BlockStateRegistry* bsr,
-    const blockmodels::BlockModelLibrary* modelLibrary
+    const blockmodels::BlockModelLibrary* modelLibrary,
+    const worldlight::ChunkLight* chunkLight,
+    const std::array<const worldlight::ChunkLight*, 6>& neighborLight
 ) {
     ChunkMeshData out;
     if (!chunkBlocks || !bsr || !modelLibrary) return out;
 
     std::vector<bool> visibleFaces;
+    std::array<float, 7> faceLight;
     for (int x = 0; x < sizes::CHUNK_SIZE; ++x) {
         for (int y = 0; y < sizes::CHUNK_SIZE; ++y) {
             for (int z = 0; z < sizes::CHUNK_SIZE; ++z) {
@@ -69,19 +87,27 @@ ChunkMeshData BuildChunkMeshData(
                     model->computeVisibleFaces(x, y, z, state, chunkBlocks, neighborBlocks, *bsr, visibleFaces);
                 }
 
+                // A face shows the light of the cell it looks into; faces without a direction use the
+                // block's own cell.
+                for (int f = 0; f < kFaceCount; ++f) {
+                    const glm::ivec3 offset = FaceDirNeighborOffset(FaceDirFromIndex(f));
+                    faceLight[f] = PackedLightAt(x + offset.x, y + offset.y, z + offset.z, chunkLight, neighborLight);
+                }
+                faceLight[kFaceCount] = PackedLightAt(x, y, z, chunkLight, neighborLight);
+
                 if (blockIsTranslucent) {
-                    blockmodels::AppendRenderLayer(
+                    blockmodels::AppendRenderLayerLit(
                         out.transparentVertices, out.transparentIndices,
-                        model->transparent, worldOffset, visibleFaces);
+                        model->transparent, worldOffset, visibleFaces, faceLight);
                 } else {
                     auto& opaqueVerts = model->opaqueNoCull ? out.opaqueNoCullVertices : out.opaqueVertices;
                     auto& opaqueIndices = model->opaqueNoCull ? out.opaqueNoCullIndices : out.opaqueIndices;
-                    blockmodels::AppendRenderLayer(
-                        opaqueVerts, opaqueIndices, model->opaque, worldOffset, visibleFaces);
+                    blockmodels::AppendRenderLayerLit(
+                        opaqueVerts, opaqueIndices, model->opaque, worldOffset, visibleFaces, faceLight);
 
                     if (!model->transparent.faces.empty()) {
-                        blockmodels::AppendRenderLayer(
-                            opaqueVerts, opaqueIndices, model->transparent, worldOffset, visibleFaces);
+                        blockmodels::AppendRenderLayerLit(
+                            opaqueVerts, opaqueIndices, model->transparent, worldOffset, visibleFaces, faceLight);
                     }
                 }
             }
@@ -0,0 +1,395 @@
+#include <ASCIICraft/world/light/LightEngine.hpp>
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+
+#include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
+#include <ASCIICraft/world/block/state/FaceDir.hpp>
+#include <ASCIICraft/world/chunk/ChunkUtil.hpp>
+
+namespace worldlight {
+
+namespace {
+
+constexpr int kSize = sizes::CHUNK_SIZE;
+static_assert(kSize == 16, "cell index math assumes 16-block chunks");
+
+constexpr int kTop = static_cast<int>(FaceDir::Top);
+constexpr int kBottom = static_cast<int>(FaceDir::Bottom);
+constexpr int kAllFacesMask = (1 << kFaceCount) - 1;
+
+// Per FaceDir (Top, Bottom, North, South, East, West): index step inside a chunk, and the step that
+// lands on the opposite border of the neighbour chunk.
+constexpr int kStep[kFaceCount] = {kSize, -kSize, -kSize * kSize, kSize * kSize, 1, -1};
+constexpr int kWrap[kFaceCount] = {
+    -(kSize - 1) * kSize, (kSize - 1) * kSize,
+    (kSize - 1) * kSize * kSize, -(kSize - 1) * kSize * kSize,
+    -(kSize - 1), kSize - 1,
+};
+
+int CellX(int index) { return index & (kSize - 1); }
+int CellY(int index) { return (index >> 4) & (kSize - 1); }
+int CellZ(int index) { return index >> 8; }
+
+bool OnFace(int index, int face) {
+    switch (face) {
+        case 0: return CellY(index) == kSize - 1;
+        case 1: return CellY(index) == 0;
+        case 2: return CellZ(index) == 0;
+        case 3: return CellZ(index) == kSize - 1;
+        case 4: return CellX(index) == kSize - 1;
+        default: return CellX(index) == 0;
+    }
+}
+
+uint8_t BorderMask(int index) {
+    uint8_t mask = 0;
+    for (int face = 0; face < kFaceCount; ++face) {
+        if (OnFace(index, face)) mask |= static_cast<uint8_t>(1u << face);
+    }
+    return mask;
+}
+
+/// Calls fn(index) for the 16 x 16 cells on one border face of a chunk.
+template <typename Fn>
+void ForEachFaceCell(int face, Fn&& fn) {
+    for (int a = 0; a < kSize; ++a) {
+        for (int b = 0; b < kSize; ++b) {
+            switch (face) {
+                case 0: fn(chunkutil::GetBlockIndex(a, kSize - 1, b)); break;
+                case 1: fn(chunkutil::GetBlockIndex(a, 0, b)); break;
+                case 2: fn(chunkutil::GetBlockIndex(a, b, 0)); break;
+                case 3: fn(chunkutil::GetBlockIndex(a, b, kSize - 1)); break;
+                case 4: fn(chunkutil::GetBlockIndex(kSize - 1, a, b)); break;
+                default: fn(chunkutil::GetBlockIndex(0, a, b)); break;
+            }
+        }
+    }
+}
+
+/// Level a cell with \p filter receives from a neighbour at \p level.
+uint8_t Attenuate(uint8_t level, uint8_t filter, LightChannel channel, bool down) {
+    if (filter >= MAX_LIGHT) return 0;
+    if (channel == LightChannel::Sky && down && level == MAX_LIGHT && filter == 0) return MAX_LIGHT;
+    const int attenuated = static_cast<int>(level) - std::max(1, static_cast<int>(filter));
+    return static_cast<uint8_t>(std::max(0, attenuated));
+}
+
+struct Cell {
+    int32_t section;
+    int32_t index;
+};
+
+struct Removal {
+    Cell cell;
+    uint8_t level;      // light the cell had before it was cleared
+};
+
+class LightPropagator {
+public:
+    LightPropagator(LightJob& job, const blockstate::BlockStateRegistry& bsr)
+        : m_job(job), m_bsr(bsr) {
+        m_sectionIndex.reserve(job.sections.size());
+        for (size_t i = 0; i < job.sections.size(); ++i) {
+            m_sectionIndex.emplace(job.sections[i].coord, static_cast<int32_t>(i));
+        }
+        m_neighbors.resize(job.sections.size());
+        for (size_t i = 0; i < job.sections.size(); ++i) {
+            for (int face = 0; face < kFaceCount; ++face) {
+                const auto it = m_sectionIndex.find(NeighborChunkCoord(job.sections[i].coord, FaceDirFromIndex(face)));
+                m_neighbors[i][face] = it != m_sectionIndex.end() ? it->second : -1;
+            }
+        }
+    }
+
+    void Run() {
+        SeedRelitSections();
+        PullFromNeighbors();
+        ReconcileSkyBelow();
+        SeedEdits();
+        SeedSpills();
+        for (const LightChannel channel : {LightChannel::Sky, LightChannel::Block}) {
+            RemovePass(channel);
+            AddPass(channel);
+        }
+    }
+
+private:
+    LightSection& SectionOf(const Cell& c) { return m_job.sections[c.section]; }
+
+    uint8_t Get(const Cell& c, LightChannel channel) { return SectionOf(c).light.Get(channel, c.index); }
+
+    void Set(const Cell& c, LightChannel channel, uint8_t level) {
+        LightSection& section = SectionOf(c);
+        section.light.Set(channel, c.index, level);
+        section.changed = true;
+        section.borderFaces |= BorderMask(c.index);
+    }
+
+    const blockstate::BlockState& StateOf(const Cell& c) {
+        return m_bsr.GetState(SectionOf(c).blocks[static_cast<size_t>(c.index)]);
+    }
+    uint8_t Filter(const Cell& c) { return std::min(StateOf(c).lightFilter, MAX_LIGHT); }
+    uint8_t Emission(const Cell& c) { return std::min(StateOf(c).lightEmission, MAX_LIGHT); }
+
+    /// Light a cell gets regardless of its neighbours: its emission, or open sky on the top face of
+    /// a chunk with nothing lit above it.
+    uint8_t Intrinsic(const Cell& c, LightChannel channel) {
+        if (channel == LightChannel::Block) return Emission(c);
+        const LightSection& section = SectionOf(c);
+        if (!section.skyAbove || m_neighbors[c.section][kTop] >= 0 || !OnFace(c.index, kTop)) return 0;
+        return Attenuate(MAX_LIGHT, Filter(c), LightChannel::Sky, true);
+    }
+
+    bool FindCell(const WorldCoord& pos, Cell& out) const {
+        const auto it = m_sectionIndex.find(pos.ToChunkCoord());
+        if (it == m_sectionIndex.end()) return false;
+        const glm::ivec3 local = pos.ToLocalChunkPos();
+        out = {it->second, chunkutil::GetBlockIndex(local.x, local.y, local.z)};
+        return true;
+    }
+
+    /// Neighbour of \p from across \p face. False when its chunk was not copied; \p outside is then
+    /// its world position.
+    bool Step(const Cell& from, int face, Cell& to, WorldCoord& outside) const {
+        if (!OnFace(from.index, face)) {
+            to = {from.section, from.index + kStep[face]};
+            return true;
+        }
+        const int32_t neighbor = m_neighbors[from.section][face];
+        if (neighbor >= 0) {
+            to = {neighbor, from.index + kWrap[face]};
+            return true;
+        }
+        const ChunkCoord& coord = m_job.sections[from.section].coord;
+        const glm::ivec3 offset = FaceDirNeighborOffset(FaceDirFromIndex(face));
+        outside = WorldCoord(coord.x * kSize + CellX(from.index) + offset.x,
+                             coord.y * kSize + CellY(from.index) + offset.y,
+                             coord.z * kSize + CellZ(from.index) + offset.z);
+        return false;
+    }
+
+    /// Sky 15 above every column's heightmap (when the column is open above), emitters at their level.
+    void SeedRelitSections() {
+        std::vector<int32_t> order;
+        for (size_t i = 0; i < m_job.sections.size(); ++i) {
+            if (m_job.sections[i].relight) order.push_back(static_cast<int32_t>(i));
+        }
+        // Top-down, so a relit chunk sees the sky its relit upper neighbour already let through.
+        std::sort(order.begin(), order.end(), [&](int32_t a, int32_t b) {
+            return m_job.sections[a].coord.y > m_job.sections[b].coord.y;
+        });
+
+        for (const int32_t s : order) {
+            LightSection& section = m_job.sections[s];
+            section.light.Clear();
+            section.changed = true;
+            section.borderFaces = kAllFacesMask;
+
+            const int32_t above = m_neighbors[s][kTop];
+            for (int z = 0; z < kSize; ++z) {
+                for (int x = 0; x < kSize; ++x) {
+                    // Heightmap: the highest cell in the column that dims sky light.
+                    int height = -1;
+                    for (int y = kSize - 1; y >= 0; --y) {
+                        if (Filter({s, chunkutil::GetBlockIndex(x, y, z)}) != 0) {
+                            height = y;
+                            break;
+                        }
+                    }
+                    // A missing chunk above counts as open sky; when it loads, its relight takes the
+                    // light back (ReconcileSkyBelow).
+                    const bool open = above < 0
+                        ? section.skyAbove
+                        : m_job.sections[above].light.GetSky(chunkutil::GetBlockIndex(x, 0, z)) == MAX_LIGHT;
+                    if (!open) continue;
+                    for (int y = height + 1; y < kSize; ++y) {
+                        const Cell c{s, chunkutil::GetBlockIndex(x, y, z)};
+                        section.light.Set(LightChannel::Sky, c.index, MAX_LIGHT);
+                        m_additions[0].push_back(c);
+                    }
+                    // The topmost dimming cell still takes what falls onto it (leaves, water).
+                    if (height >= 0) {
+                        const Cell c{s, chunkutil::GetBlockIndex(x, height, z)};
+                        if (const uint8_t level = Attenuate(MAX_LIGHT, Filter(c), LightChannel::Sky, true)) {
+                            section.light.Set(LightChannel::Sky, c.index, level);
+                            m_additions[0].push_back(c);
+                        }
+                    }
+                }
+            }
+
+            for (int32_t i = 0; i < ChunkLight::VOLUME; ++i) {
+                const Cell c{s, i};
+                if (const uint8_t emission = Emission(c)) {
+                    section.light.Set(LightChannel::Block, i, emission);
+                    m_additions[1].push_back(c);
+                }
+            }
+        }
+    }
+
+    /// Queues the lit neighbours' border cells so their light flows into relit chunks.
+    void PullFromNeighbors() {
+        for (size_t s = 0; s < m_job.sections.size(); ++s) {
+            if (!m_job.sections[s].relight) continue;
+            for (int face = 0; face < kFaceCount; ++face) {
+                const int32_t n = m_neighbors[s][face];
+                if (n < 0 || m_job.sections[n].relight) continue;
+                ForEachFaceCell(face ^ 1, [&](int index) {
+                    const Cell c{n, index};
+                    if (Get(c, LightChannel::Sky) > 1) m_additions[0].push_back(c);
+                    if (Get(c, LightChannel::Block) > 1) m_additions[1].push_back(c);
+                });
+            }
+        }
+    }
+
+    /// A chunk lit while the one above it was missing assumed open sky; take back the sky light its
+    /// top cells got that way wherever the relit chunk above does not hand down as much.
+    void ReconcileSkyBelow() {
+        for (size_t s = 0; s < m_job.sections.size(); ++s) {
+            if (!m_job.sections[s].relight) continue;
+            const int32_t below = m_neighbors[s][kBottom];
+            if (below < 0 || m_job.sections[below].relight) continue;
+            for (int z = 0; z < kSize; ++z) {
+                for (int x = 0; x < kSize; ++x) {
+                    const Cell bottom{static_cast<int32_t>(s), chunkutil::GetBlockIndex(x, 0, z)};
+                    const Cell top{below, chunkutil::GetBlockIndex(x, kSize - 1, z)};
+                    const uint8_t level = Get(top, LightChannel::Sky);
+                    if (level == 0) continue;
+                    const uint8_t filter = Filter(top);
+                    const uint8_t fromSky = Attenuate(MAX_LIGHT, filter, LightChannel::Sky, true);
+                    const uint8_t fromAbove = Attenuate(Get(bottom, LightChannel::Sky), filter, LightChannel::Sky, true);
+                    if (level == fromSky && fromAbove < level) {
+                        Set(top, LightChannel::Sky, 0);
+                        m_removals[0].push_back({top, level});
+                    }
+                }
+            }
+        }
+    }
+
+    /// Clears the edited cell in both channels and lets its neighbours (and its own emission or open
+    /// sky) refill it.
+    void SeedEdits() {
+        for (const WorldCoord& pos : m_job.edits) {
+            Cell c;
+            if (!FindCell(pos, c) || SectionOf(c).relight) continue;
+            for (const LightChannel channel : {LightChannel::Sky, LightChannel::Block}) {
+                const int ch = static_cast<int>(channel);
+                if (const uint8_t level = Get(c, channel)) {
+                    Set(c, channel, 0);
+                    m_removals[ch].push_back({c, level});
+                }
+                for (int face = 0; face < kFaceCount; ++face) {
+                    Cell n;
+                    WorldCoord outside;
+                    if (Step(c, face, n, outside)) m_additions[ch].push_back(n);
+                }
+                if (const uint8_t intrinsic = Intrinsic(c, channel)) {
+                    Set(c, channel, intrinsic);
+                    m_additions[ch].push_back(c);
+                }
+            }
+        }
+    }
+
+    void SeedSpills() {
+        for (const LightSpill& spill : m_job.spillsIn) {
+            Cell c;
+            if (!FindCell(spill.pos, c)) continue;
+            if (spill.remove) {
+                RemoveStep(c, spill.level, spill.channel, spill.fromAbove);
+            } else {
+                const uint8_t level = Attenuate(spill.level, Filter(c), spill.channel, spill.fromAbove);
+                if (level > Get(c, spill.channel)) {
+                    Set(c, spill.channel, level);
+                    m_additions[static_cast<int>(spill.channel)].push_back(c);
+                }
+            }
+        }
+    }
+
+    /// Neighbour \p n of a cell that lost \p level: clear it if that cell was its source, otherwise
+    /// keep it as a source for the refill.
+    void RemoveStep(const Cell& n, uint8_t level, LightChannel channel, bool down) {
+        const int ch = static_cast<int>(channel);
+        const uint8_t current = Get(n, channel);
+        if (current == 0) return;
+        const bool litByRemoved = current < level
+            || (channel == LightChannel::Sky && down && level == MAX_LIGHT && current == MAX_LIGHT);
+        if (!litByRemoved) {
+            m_additions[ch].push_back(n);
+            return;
+        }
+        Set(n, channel, 0);
+        m_removals[ch].push_back({n, current});
+        if (const uint8_t intrinsic = Intrinsic(n, channel)) {
+            Set(n, channel, intrinsic);
+            m_additions[ch].push_back(n);
+        }
+    }
+
+    void RemovePass(LightChannel channel) {
+        auto& queue = m_removals[static_cast<int>(channel)];
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const Removal r = queue[head];
+            ++m_job.cellsVisited;
+            for (int face = 0; face < kFaceCount; ++face) {
+                const bool down = face == kBottom;
+                Cell n;
+                WorldCoord outside;
+                if (!Step(r.cell, face, n, outside)) {
+                    m_job.spillsOut.push_back({outside, r.level, channel, true, down});
+                    continue;
+                }
+                RemoveStep(n, r.level, channel, down);
+            }
+        }
+        queue.clear();
+    }
+
+    void AddPass(LightChannel channel) {
+        auto& queue = m_additions[static_cast<int>(channel)];
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const Cell c = queue[head];
+            ++m_job.cellsVisited;
+            const uint8_t level = Get(c, channel);
+            if (level <= 1) continue;
+            for (int face = 0; face < kFaceCount; ++face) {
+                const bool down = face == kBottom;
+                Cell n;
+                WorldCoord outside;
+                if (!Step(c, face, n, outside)) {
+                    m_job.spillsOut.push_back({outside, level, channel, false, down});
+                    continue;
+                }
+                const uint8_t offered = Attenuate(level, Filter(n), channel, down);
+                if (offered > Get(n, channel)) {
+                    Set(n, channel, offered);
+                    queue.push_back(n);
+                }
+            }
+        }
+        queue.clear();
+    }
+
+    LightJob& m_job;
+    const blockstate::BlockStateRegistry& m_bsr;
+    std::unordered_map<ChunkCoord, int32_t> m_sectionIndex;
+    std::vector<std::array<int32_t, kFaceCount>> m_neighbors;
+    std::vector<Removal> m_removals[2];     // per LightChannel
+    std::vector<Cell> m_additions[2];
+};
+
+} // namespace
+
+void RunLightJob(LightJob& job, const blockstate::BlockStateRegistry& bsr) {
+    job.spillsOut.clear();
+    job.cellsVisited = 0;
+    LightPropagator(job, bsr).Run();
+}
+
+} // namespace worldlight
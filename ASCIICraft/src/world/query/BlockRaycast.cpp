@@ -4,10 +4,12 @@
 #include <ASCIICraft/world/block/state/BlockState.hpp>
 #include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
 #include <ASCIICraft/world/query/BlockQueries.hpp>
+#include <ASCIICraft/world/query/VoxelAccessor.hpp>
 
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <type_traits>
 
 #include <glm/common.hpp>
 #include <glm/geometric.hpp>
@@ -146,14 +148,20 @@ std::optional<RayAabbHit> RayAabb(
     return RayAabbHit{tEnter, enterFace};
 }
 
+template <typename StateGetter>
 std::optional<BlockRayHit> RaycastBlocks(
-    const BlockStateGetter& getState,
+    const StateGetter& getState,
     const blockstate::BlockStateRegistry* bsr,
     const glm::vec3& origin,
     const glm::vec3& dirIn,
     float reach
 ) {
-    if (reach <= 0.0f || !getState) {
+    if constexpr (std::is_constructible_v<bool, const StateGetter&>) {
+        if (!getState) {
+            return std::nullopt;
+        }
+    }
+    if (reach <= 0.0f) {
         return std::nullopt;
     }
 
@@ -244,4 +252,9 @@ std::optional<BlockRayHit> RaycastBlocks(
     return std::nullopt;
 }
 
+template std::optional<BlockRayHit> RaycastBlocks<VoxelAccessor>(
+    const VoxelAccessor&, const blockstate::BlockStateRegistry*, const glm::vec3&, const glm::vec3&, float);
+template std::optional<BlockRayHit> RaycastBlocks<BlockStateGetter>(
+    const BlockStateGetter&, const blockstate::BlockStateRegistry*, const glm::vec3&, const glm::vec3&, float);
+
 } // namespace worldquery
@@ -0,0 +1,30 @@
+#include <ASCIICraft/world/query/VoxelAccessor.hpp>
+
+#include <ASCIICraft/world/World.hpp>
+#include <ASCIICraft/world/chunk/Chunk.hpp>
+#include <ASCIICraft/world/chunk/ChunkManager.hpp>
+
+namespace worldquery {
+
+VoxelAccessor::VoxelAccessor(const ChunkManager* chunkManager)
+    : m_chunkManager(chunkManager) {}
+
+VoxelAccessor::VoxelAccessor(const World* world)
+    : m_chunkManager(world ? world->GetChunkManager() : nullptr) {}
+
+void VoxelAccessor::Bind(Slot& slot, int cx, int cy, int cz) const {
+    slot.cx = cx;
+    slot.cy = cy;
+    slot.cz = cz;
+    slot.blocks = nullptr;
+    if (!m_chunkManager) {
+        return;
+    }
+
+    ++m_chunkLookups;
+    if (const Chunk* chunk = m_chunkManager->FindChunk(ChunkCoord(cx, cy, cz))) {
+        slot.blocks = chunk->GetBlockData();
+    }
+}
+
+} // namespace worldquery
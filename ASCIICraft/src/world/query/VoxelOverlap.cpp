@@ -4,6 +4,7 @@
 #include <ASCIICraft/world/block/CollisionAabb.hpp>
 #include <ASCIICraft/world/block/state/BlockState.hpp>
 #include <ASCIICraft/world/block/state/BlockStateRegistry.hpp>
+#include <ASCIICraft/world/query/VoxelAccessor.hpp>
 
 namespace worldquery {
 
@@ -41,6 +42,33 @@ bool EntityOverlapsStateCollision(
     return blockstate::AabbsOverlap(entityMin, entityMax, cellMin, cellMax);
 }
 
+template <typename StateGetter>
+bool OverlapsSolidForPhysicsImpl(
+    const StateGetter &getState,
+    const blockstate::BlockStateRegistry *bsr,
+    const glm::vec3 &center,
+    const glm::vec3 &halfExtents
+) {
+    const glm::vec3 entityMin = center - halfExtents;
+    const glm::vec3 entityMax = center + halfExtents;
+
+    const glm::ivec3 imin = glm::floor(entityMin);
+    const glm::ivec3 imax = glm::floor(entityMax);
+
+    // x innermost to walk Chunk's x + y*16 + z*256 layout in order (the answer is order-independent).
+    for (int z = imin.z; z <= imax.z; ++z) {
+        for (int y = imin.y; y <= imax.y; ++y) {
+            for (int x = imin.x; x <= imax.x; ++x) {
+                const uint32_t stateId = getState(x, y, z);
+                if (EntityOverlapsStateCollision(bsr, stateId, x, y, z, entityMin, entityMax)) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
 } // namespace
 
 void EnrichHitWithTypeId(const blockstate::BlockStateRegistry *bsr, VoxelOverlapHit &hit) {
@@ -75,10 +103,11 @@ std::optional<VoxelOverlapHit> QueryVoxelOverlap(
     const glm::ivec3 imin = glm::floor(min);
     const glm::ivec3 imax = glm::floor(max);
 
+    const VoxelAccessor voxels(&world);
     for (int x = imin.x; x <= imax.x; ++x) {
         for (int y = imin.y; y <= imax.y; ++y) {
             for (int z = imin.z; z <= imax.z; ++z) {
-                const uint32_t stateId = world.GetBlockState(x, y, z);
+                const uint32_t stateId = voxels.GetBlockState(x, y, z);
                 const bool matches = filter ? filter(stateId) : blockquery::IsNonAir(stateId);
                 if (matches) {
                     return VoxelOverlapHit{{x, y, z}, stateId, 0};
@@ -99,24 +128,26 @@ bool OverlapsSolidForPhysics(
     if (colliderDisabled || !world) {
         return false;
     }
+    const VoxelAccessor voxels(world);
+    return OverlapsSolidForPhysicsImpl(voxels, bsr, center, halfExtents);
+}
 
-    const glm::vec3 entityMin = center - halfExtents;
-    const glm::vec3 entityMax = center + halfExtents;
-
-    const glm::ivec3 imin = glm::floor(entityMin);
-    const glm::ivec3 imax = glm::floor(entityMax);
+bool OverlapsSolidForPhysics(
+    const VoxelAccessor &voxels,
+    const blockstate::BlockStateRegistry *bsr,
+    const glm::vec3 &center,
+    const glm::vec3 &halfExtents
+) {
+    return OverlapsSolidForPhysicsImpl(voxels, bsr, center, halfExtents);
+}
 
-    for (int x = imin.x; x <= imax.x; ++x) {
-        for (int y = imin.y; y <= imax.y; ++y) {
-            for (int z = imin.z; z <= imax.z; ++z) {
-                const uint32_t stateId = world->GetBlockState(x, y, z);
-                if (EntityOverlapsStateCollision(bsr, stateId, x, y, z, entityMin, entityMax)) {
-                    return true;
-                }
-            }
-        }
-    }
-    return false;
+bool OverlapsSolidForPhysics(
+    const BlockStateGetter &getState,
+    const blockstate::BlockStateRegistry *bsr,
+    const glm::vec3 &center,
+    const glm::vec3 &halfExtents
+) {
+    return OverlapsSolidForPhysicsImpl(getState, bsr, center, halfExtents);
 }
 
 } // namespace worldquery
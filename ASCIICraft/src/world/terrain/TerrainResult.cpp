@@ -0,0 +1,40 @@
+#include <ASCIICraft/world/terrain/TerrainResult.hpp>
+
+#include <algorithm>
+
+void GroupPlacementsByChunk(const std::vector<WorldBlockPlacement>& placements, std::vector<ChunkEditGroup>& out) {
+    out.clear();
+    if (placements.empty()) return;
+
+    struct Keyed {
+        ChunkCoord chunk;
+        size_t index;
+    };
+    std::vector<Keyed> order;
+    order.reserve(placements.size());
+    for (size_t i = 0; i < placements.size(); ++i) {
+        order.push_back({placements[i].pos.ToChunkCoord(), i});
+    }
+    // Stable, so placements keep their emission order inside a chunk and NormalizeEdits keeps the last.
+    std::stable_sort(order.begin(), order.end(), [](const Keyed& a, const Keyed& b) {
+        if (a.chunk.x != b.chunk.x) return a.chunk.x < b.chunk.x;
+        if (a.chunk.y != b.chunk.y) return a.chunk.y < b.chunk.y;
+        return a.chunk.z < b.chunk.z;
+    });
+
+    for (size_t i = 0; i < order.size(); ++i) {
+        if (out.empty() || out.back().chunk != order[i].chunk) {
+            out.push_back(ChunkEditGroup{order[i].chunk, {}});
+        }
+        const WorldBlockPlacement& placement = placements[order[i].index];
+        const glm::ivec3 local = placement.pos.ToLocalChunkPos();
+        CrossChunkEdit edit;
+        edit.PackPos(local.x, local.y, local.z);
+        edit.stateId = placement.stateId;
+        out.back().edits.push_back(edit);
+    }
+
+    for (ChunkEditGroup& group : out) {
+        NormalizeEdits(group.edits);
+    }
+}
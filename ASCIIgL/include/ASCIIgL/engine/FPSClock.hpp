@@ -21,12 +21,18 @@ public:
     FPSClock& operator=(FPSClock&&) = delete;
 
     void Initialize(unsigned int fpsCap = 60, double fpsWindowSec = 1.0);
+    /// 0 disables the cap (frames run back-to-back, e.g. for replay benchmarks).
     void SetFPSCap(unsigned int fpsCap);
     unsigned int GetFPSCap() const;
     double GetFPS() const;
     void StartFPSClock();
     void EndFPSClock();
     float GetDeltaTime();
+    /// Seconds between Start/EndFPSClock of the last frame, before the FPS-cap sleep.
+    double GetFrameWorkTime() const;
+    /// Makes GetDeltaTime() return \a dt until cleared (capture replay); FPS sampling still uses wall time.
+    void SetDeltaTimeOverride(float dt);
+    void ClearDeltaTimeOverride();
 
 private:
     FPSClock() = default;
@@ -36,8 +42,11 @@ private:
     double _fpsWindowSec = 1.0f;
     double _fps = 0.0f;
     double _currDeltaSum = 0.0f;
+    double _frameWorkTime = 0.0;
     std::deque<double> _frameTimes = {};
     unsigned int _fpsCap = 60;
+    bool _hasDeltaOverride = false;
+    float _deltaOverride = 0.0f;
 
     void CapFPS();
     void FPSSampleCalculate(const double currentDeltaTime);
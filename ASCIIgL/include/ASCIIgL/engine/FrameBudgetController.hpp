@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ASCIIgL {
+
+/// Picks a render-scale tier from measured frame cost so the frame stays inside a time budget.
+/// Feed it FPSClock::GetFrameWorkTime() once per frame and pass GetRenderScale() to
+/// Renderer::SetRenderScale(). Hysteresis: a tier drops only after \ref Config::downshiftFrames
+/// consecutive over-budget frames and rises only after \ref Config::upshiftFrames consecutive
+/// frames with headroom, so a single hitch (chunk upload, GC of meshes) does not flip tiers.
+class FrameBudgetController {
+public:
+    struct Config {
+        /// Target CPU+GPU work per frame in milliseconds (excludes the FPS-cap sleep).
+        double budgetMs = 1000.0 / 120.0;
+        /// Render scales from best quality to cheapest; each in (0, 1].
+        std::vector<float> tiers = { 1.0f, 0.75f, 0.5f };
+        /// Consecutive frames over budget before dropping one tier.
+        int downshiftFrames = 10;
+        /// Consecutive frames under budget * upshiftHeadroom before raising one tier.
+        int upshiftFrames = 120;
+        /// Fraction of the budget a frame must stay under to count toward an upshift.
+        double upshiftHeadroom = 0.7;
+        /// Exponential smoothing factor for the frame-time average (0..1, higher = more reactive).
+        double smoothing = 0.1;
+    };
+
+    FrameBudgetController() = default;
+    explicit FrameBudgetController(Config config);
+
+    void SetConfig(Config config);
+    const Config& GetConfig() const { return _config; }
+
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const { return _enabled; }
+
+    /// Records one frame's work time in seconds. Returns true if the tier changed.
+    bool Update(double frameWorkSec);
+
+    size_t GetTier() const { return _tier; }
+    size_t GetTierCount() const { return _config.tiers.size(); }
+    /// Render scale of the current tier (1.0 when disabled or no tiers are configured).
+    float GetRenderScale() const;
+    double GetSmoothedFrameMs() const { return _smoothedMs; }
+    size_t GetTierChangeCount() const { return _tierChanges; }
+
+private:
+    void ChangeTier(size_t newTier, double lastMs);
+
+    Config _config;
+    bool _enabled = true;
+    size_t _tier = 0;
+    double _smoothedMs = 0.0;
+    bool _hasSample = false;
+    int _overBudgetRun = 0;
+    int _headroomRun = 0;
+    size_t _tierChanges = 0;
+};
+
+} // namespace ASCIIgL
@@ -4,6 +4,7 @@
 
 #include <vector>
 #include <cstddef>
+#include <functional>
 
 namespace ASCIIgL {
 
@@ -12,12 +13,25 @@ class Renderer;
 class Texture;
 class TextureArray;
 
+/// What happens to a mesh's CPU-side vertex/index data once the renderer has created its GPU buffers.
+enum class MeshResidency {
+	Retain,              // keep the vectors (collision, picking, CPU rebuilds); the default
+	DiscardAfterUpload   // free them after upload; GPU loss is recovered through the rebuild callback
+};
+
 class Mesh // this class represents a mesh with generic vertex data and a vertex format descriptor
 {
 	friend class Renderer;
+public:
+	/// Refills \a vertices / \a indices after the CPU copy was discarded and the GPU buffers were lost.
+	/// Return false if the data cannot be produced right now (e.g. the owner schedules a remesh instead);
+	/// the mesh is then skipped until it can.
+	using RebuildCallback = std::function<bool(std::vector<std::byte>& vertices, std::vector<int>& indices)>;
+
 private:
-	std::vector<std::byte> vertexData;  // Raw vertex data as bytes
-	std::vector<int> indices;
+	// mutable: the renderer drops and restores them under the residency policy (like gpuBufferCache)
+	mutable std::vector<std::byte> vertexData;  // Raw vertex data as bytes
+	mutable std::vector<int> indices;
 	VertFormat format;                // Describes the vertex layout
 	Texture* texture; // single texture pointer (not owned by Mesh)
 	TextureArray* textureArray = nullptr; // TextureArray pointer (not owned by Mesh)
@@ -26,6 +40,21 @@ private:
 	// This allows Renderer to cache buffers without Mesh knowing about DirectX
 	mutable void* gpuBufferCache = nullptr;
 
+	// Sizes survive a discard so counts stay valid without the CPU copy.
+	size_t vertexDataSize = 0;
+	size_t indexCount = 0;
+	MeshResidency residency = MeshResidency::Retain;
+	RebuildCallback rebuildCallback;
+	bool pooled = false;
+
+	void OnDataAssigned();
+	/// Drops the CPU vectors (renderer only, after a successful upload under DiscardAfterUpload).
+	void DiscardCpuData() const;
+	/// As DiscardCpuData, but hands the vectors to the caller (deferred pooled uploads) instead of freeing them.
+	void TakeCpuData(std::vector<std::byte>& outVertices, std::vector<int>& outIndices) const;
+	/// Restores the CPU vectors via the rebuild callback; false if there is none or it declined.
+	bool RebuildCpuData() const;
+
 public:
 
 	// Constructor with indices (Texture)
@@ -33,7 +62,7 @@ public:
 		: vertexData(std::move(inVertexData))
 		, indices(std::move(inIndices))
 		, format(inFormat)
-		, texture(inTex) {}
+		, texture(inTex) { OnDataAssigned(); }
 
 	// Constructor with indices (TextureArray)
 	Mesh(std::vector<std::byte>&& inVertexData, const VertFormat& inFormat, std::vector<int>&& inIndices, TextureArray* inTexArray)
@@ -41,46 +70,66 @@ public:
 		, indices(std::move(inIndices))
 		, format(inFormat)
 		, texture(nullptr)
-		, textureArray(inTexArray) {}
+		, textureArray(inTexArray) { OnDataAssigned(); }
 
 	// Constructor without indices (Texture)
 	Mesh(std::vector<std::byte>&& inVertexData, const VertFormat& inFormat, Texture* inTex)
 		: vertexData(std::move(inVertexData))
 		, format(inFormat)
-		, texture(inTex) {}
+		, texture(inTex) { OnDataAssigned(); }
 
 	// Constructor without indices (TextureArray)
 	Mesh(std::vector<std::byte>&& inVertexData, const VertFormat& inFormat, TextureArray* inTexArray)
 		: vertexData(std::move(inVertexData))
 		, format(inFormat)
 		, texture(nullptr)
-		, textureArray(inTexArray) {}
+		, textureArray(inTexArray) { OnDataAssigned(); }
 
 	// Constructor with indices (no texture)
 	Mesh(std::vector<std::byte>&& inVertexData, const VertFormat& inFormat, std::vector<int>&& inIndices)
 		: vertexData(std::move(inVertexData))
 		, indices(std::move(inIndices))
 		, format(inFormat)
-		, texture(nullptr) {}
+		, texture(nullptr) { OnDataAssigned(); }
 
 	// Constructor without indices (no texture)
 	Mesh(std::vector<std::byte>&& inVertexData, const VertFormat& inFormat)
     : vertexData(std::move(inVertexData))
     , format(inFormat)
-    , texture(nullptr) {}
+    , texture(nullptr) { OnDataAssigned(); }
 
 	~Mesh();
 
-	// Immutable access to mesh data
+	// Owns its GPU cache and is counted in the resident-byte totals; never copied.
+	Mesh(const Mesh&) = delete;
+	Mesh& operator=(const Mesh&) = delete;
+
+	// Immutable access to mesh data. Empty once discarded (see MeshResidency); counts stay valid.
 	const std::vector<std::byte>& GetVertices() const { return vertexData; }  // Full vector with size
 	const std::vector<int>& GetIndices() const { return indices; }
 	const VertFormat& GetVertFormat() const { return format; }
 	const Texture* GetTexture() const { return texture; }
 	const TextureArray* GetTextureArray() const { return textureArray; }
-	size_t GetVertexCount() const { return vertexData.size() / format.GetStride(); }
-	size_t GetIndexCount() const { return indices.size(); }
-	size_t GetVertexDataSize() const { return vertexData.size(); }
-	bool IsIndexed() const { return !indices.empty(); }
+	size_t GetVertexCount() const { return vertexDataSize / format.GetStride(); }
+	size_t GetIndexCount() const { return indexCount; }
+	size_t GetVertexDataSize() const { return vertexDataSize; }
+	bool IsIndexed() const { return indexCount > 0; }
+
+	// Residency
+	void SetResidency(MeshResidency policy) { residency = policy; }
+	MeshResidency GetResidency() const { return residency; }
+	void SetRebuildCallback(RebuildCallback callback) { rebuildCallback = std::move(callback); }
+	/// Pooled meshes are suballocated from the renderer's shared vertex/index slabs instead of getting
+	/// their own buffers; meant for many small meshes with a common format (chunk geometry).
+	void SetPooled(bool enabled) { pooled = enabled; }
+	bool IsPooled() const { return pooled; }
+	/// True while the vertex/index vectors are held in system memory.
+	bool HasCpuData() const { return !vertexData.empty() || vertexDataSize == 0; }
+	/// Bytes this mesh currently holds in system memory (vector capacities).
+	size_t GetCpuBytes() const { return vertexData.capacity() + indices.capacity() * sizeof(int); }
+
+	/// Sum of GetCpuBytes over all live meshes.
+	static size_t GetTotalCpuBytes();
 
 	void ReleaseGpuCache();
 };
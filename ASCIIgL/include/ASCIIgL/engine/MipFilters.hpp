@@ -9,7 +9,10 @@ namespace MipFilters {
 
 using MipFilterFn = std::function<void(const uint8_t* srcData, int srcW, int srcH, uint8_t* dstData, int dstW, int dstH)>;
 
+// 2x2 average. Exact halvings run an SSE2/AVX2 kernel picked at runtime (see GetSimdLevel);
+// BoxFilterScalar is the reference the vector paths match bit for bit.
 void BoxFilter(const uint8_t* srcData, int srcW, int srcH, uint8_t* dstData, int dstW, int dstH);
+void BoxFilterScalar(const uint8_t* srcData, int srcW, int srcH, uint8_t* dstData, int dstW, int dstH);
 
 // Pixel-art tuned downsampling (RGBA8):
 // - Mode2x2: picks the most frequent exact RGBA color in the 2x2 block (crisp, preserves flats).
@@ -20,8 +20,10 @@ struct MonochromeMapping {
 };
 
 // Apply monochrome mapping in-place to an RGBA8 buffer (width*height*4 bytes).
-// Uses the same luminance/gradient logic as ColorUtil.hlsl.
+// Uses the same luminance/gradient logic as ColorUtil.hlsl. Runs a table-driven SSE2/AVX2 kernel
+// when available (see GetSimdLevel); results stay within 1 LSB of the scalar reference below.
 void ApplyMonochromeMappingRGBA8(uint8_t* rgbaData, int width, int height, const MonochromeMapping& mapping);
+void ApplyMonochromeMappingRGBA8Scalar(uint8_t* rgbaData, int width, int height, const MonochromeMapping& mapping);
 
 } // namespace ASCIIgL
 
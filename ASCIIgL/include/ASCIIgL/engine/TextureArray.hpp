@@ -1,6 +1,7 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cstddef>
 #include <string>
 #include <vector>
 #include <memory>
@@ -15,6 +16,17 @@ namespace ASCIIgL {
 // Used for block textures to avoid atlas bleeding issues
 class TextureArray {
 public:
+    // Load-time residency, not streaming: the finest level is clamped once to maxTileSize (texels; a
+    // tile never covers more screen texels than the render target is wide, so finer data is never
+    // sampled) and then halved until the whole array fits budgetBytes. 0 disables either limit.
+    // Packs already at or below the limit (the shipped 16px tiles) keep every level; for those the
+    // saving is the CPU release after upload.
+    struct ResidencyPolicy {
+        int maxTileSize = 0;
+        size_t budgetBytes = 0;
+        bool releaseCpuAfterUpload = false;   // drop CPU copies once the renderer has uploaded them
+    };
+
     // Load from existing atlas image (splits into tiles)
     // atlasPath: path to terrain2.png or similar atlas
     // tileSize: size of each tile (e.g., 16 for 16x16 tiles)
@@ -53,6 +65,26 @@ public:
     // Generate CPU mipmaps for all layers
     void GenerateMipmapsCPU(int maxLevels = -1, MipFilters::MipFilterFn filter = nullptr);
 
+    // Drops (or downsamples to) levels finer than the policy allows; GetTileSize() reports the new
+    // finest level. Call after loading and before the first bind.
+    void ApplyResidency(const ResidencyPolicy& policy);
+    const ResidencyPolicy& GetResidencyPolicy() const;
+
+    // CPU pixel residency, driven from the loading thread by TextureLibrary::UpdateResidency (never by
+    // the renderer). Sizes stay valid while released; GetLayerData() returns nullptr until a reload.
+    void SetGpuResident(bool resident);
+    // Frees the CPU pixels; refused (false) for arrays that cannot ReloadCpuData().
+    bool ReleaseCpuData();
+    // Decodes the source images again with the same mono mapping, mip generation and residency.
+    bool ReloadCpuData();
+    bool CanReloadCpuData() const;
+    bool HasCpuData() const;
+
+    // Bytes currently held in CPU memory / on the GPU (0 before upload; the full chain down to 1x1
+    // when the GPU generates mips). Both are counters, safe to read from any thread.
+    size_t GetCpuBytes() const;
+    size_t GetGpuBytes() const;
+
     static int GetLayerFromAtlasXY(int x, int y, int atlasSize);
     
 private:
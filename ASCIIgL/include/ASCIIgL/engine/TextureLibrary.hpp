@@ -2,7 +2,9 @@
 
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <ASCIIgL/engine/Texture.hpp>
 #include <ASCIIgL/engine/TextureArray.hpp>
@@ -10,12 +12,26 @@
 
 namespace ASCIIgL {
 
+// Loads may run concurrently (parallel startup); the maps are guarded, decoding is not serialized.
 class TextureLibrary {
 public:
     static TextureLibrary& GetInst() {
         static TextureLibrary inst;
         return inst;
     }
+
+    // Per-array resident memory, for the startup/frame logs.
+    struct TextureArrayResidency {
+        std::string name;
+        int tileSize = 0;       // finest resident level
+        int layerCount = 0;
+        size_t cpuBytes = 0;
+        size_t gpuBytes = 0;
+    };
+
+    // Applied to every TextureArray loaded afterwards (see TextureArray::ResidencyPolicy).
+    void SetTextureArrayResidency(const TextureArray::ResidencyPolicy& policy);
+
     // Load a TextureArray from a single atlas image.
     std::shared_ptr<TextureArray> LoadTextureArray(
         const std::string& path, int tileSize, const std::string& savedName,
@@ -34,10 +50,17 @@ public:
     bool HasTextureArray(const std::string& savedName) const;
     bool HasTexture(const std::string& savedName) const;
 
-    // Direct accessors for iteration over internal maps.
+    // Direct accessors for iteration over internal maps. Not synchronized: call once loading is done.
     const std::unordered_map<std::string, std::shared_ptr<TextureArray>>& GetTextureArrays() const;
     const std::unordered_map<std::string, std::shared_ptr<Texture>>& GetTextures() const;
 
+    // Sorted by name.
+    std::vector<TextureArrayResidency> GetTextureArrayResidency() const;
+
+    // Once per frame on the loading (simulation) thread: releases CPU pixels of arrays the renderer has
+    // uploaded (when the policy asks for it) and reloads them for arrays whose GPU copy is gone.
+    void UpdateResidency();
+
     void RemoveTextureArray(const std::string& savedName);
     void RemoveTexture(const std::string& savedName);
     void ClearTextureArrays();
@@ -45,6 +68,8 @@ public:
 
 private:
     TextureLibrary() = default;
+    mutable std::mutex _mutex;
+    TextureArray::ResidencyPolicy _arrayResidency;
     std::unordered_map<std::string, std::shared_ptr<TextureArray>> _textureArrays;
     std::unordered_map<std::string, std::shared_ptr<Texture>> _textures;
 };
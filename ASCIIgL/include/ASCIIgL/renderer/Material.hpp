@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <string>
 #include <memory>
 #include <vector>
@@ -70,17 +73,42 @@ public:
     // Generic setter (uses variant)
     void SetUniform(const std::string& name, const UniformValue& value);
 
+    // =========================================================================
+    // Handle-based Setters (per-frame hot path)
+    // =========================================================================
+
+    // Resolve a uniform once (e.g. when a system first sees the material) and keep the handle;
+    // Set(handle, value) then writes straight into the CPU staging block with no name lookup.
+    // Invalid handles are ignored. The renderer uploads only the registers that changed.
+    UniformHandle GetUniformHandle(const std::string& name) const;
+
+    void Set(UniformHandle handle, float value)            { WriteStaging(handle, &value, sizeof(value)); }
+    void Set(UniformHandle handle, const glm::vec2& value)  { WriteStaging(handle, &value, sizeof(value)); }
+    void Set(UniformHandle handle, const glm::vec3& value)  { WriteStaging(handle, &value, sizeof(value)); }
+    void Set(UniformHandle handle, const glm::vec4& value)  { WriteStaging(handle, &value, sizeof(value)); }
+    void Set(UniformHandle handle, int value)               { WriteStaging(handle, &value, sizeof(value)); }
+    void Set(UniformHandle handle, const glm::ivec2& value) { WriteStaging(handle, &value, sizeof(value)); }
+    void Set(UniformHandle handle, const glm::ivec3& value) { WriteStaging(handle, &value, sizeof(value)); }
+    void Set(UniformHandle handle, const glm::ivec4& value) { WriteStaging(handle, &value, sizeof(value)); }
+    void Set(UniformHandle handle, const glm::mat3& value)  { WriteStaging(handle, &value, sizeof(value)); }
+    void Set(UniformHandle handle, const glm::mat4& value)  { WriteStaging(handle, &value, sizeof(value)); }
+
     // =========================================================================
     // Uniform Getters
     // =========================================================================
     
+    // Reads back from the staging block, so values written through handles are visible too.
     template<typename T>
     T GetUniform(const std::string& name) const {
-        auto it = _uniformValues.find(name);
-        if (it != _uniformValues.end()) {
-            return std::get<T>(it->second);
+        T value{};
+        const UniformDescriptor* desc = GetUniformDescriptor(name);
+        if (desc) {
+            const std::size_t copySize = std::min<std::size_t>(desc->size, sizeof(T));
+            if (desc->offset + copySize <= _constantBufferData.size()) {
+                std::memcpy(&value, _constantBufferData.data() + desc->offset, copySize);
+            }
         }
-        return T{};
+        return value;
     }
     
     bool HasUniform(const std::string& name) const;
@@ -130,6 +158,7 @@ public:
 
     /// Rebuild packed constant-buffer bytes from current base uniforms.
     /// Useful before applying per-draw overrides to avoid stale values.
+    /// Only name-set uniforms survive; values written through handles are cleared.
     void ResetConstantBufferData();
 
     void UpdateConstantBufferData();
@@ -139,13 +168,18 @@ private:
     Material();
 
     void SetUniformInternal(const std::string& name, const UniformValue& value);
+    void WriteStaging(UniformHandle handle, const void* data, std::size_t size);
+    /// Writes \a value at \a desc's offset in \a buffer (bounds-checked); shared with the renderer's packet snapshots.
+    static void WriteUniformOverride(std::vector<std::byte>& buffer, const UniformDescriptor& desc, const UniformValue& value);
 
     std::shared_ptr<ShaderProgram> _program;
     
-    // Uniform storage
+    // Uniform storage. _constantBufferData is the CPU staging block: every setter writes through
+    // to it immediately. _uniformValues remembers name-set values so they can be repacked when the
+    // program (and so the layout) changes.
     std::unordered_map<std::string, UniformValue> _uniformValues;
     std::vector<std::byte> _constantBufferData;  // Packed data for GPU upload
-    bool _uniformsDirty = true;                  // true when _uniformValues changed and packing is needed
+    bool _uniformsDirty = true;                  // true when _uniformValues must be repacked (layout changed)
     
     // Texture slots
     std::vector<TextureSlot> _textureSlots;
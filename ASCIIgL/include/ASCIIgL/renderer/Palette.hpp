@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -30,6 +31,19 @@ struct PaletteEntry {
     PaletteEntry(int r, int g, int b);
 };
 
+class Palette;
+
+// How a palette is clustered from texture samples (k-means in Oklab).
+struct PaletteBuildOptions {
+    size_t maxSamples = 16384;          // reservoir size; bounds cost regardless of pack size (0 = keep all)
+    int maxIterations = 10;             // Lloyd iterations, or mini-batch steps when miniBatchSize > 0
+    float convergenceShift = 1e-6f;     // stop once no center moves more than this (squared Oklab distance)
+    size_t miniBatchSize = 0;           // > 0: mini-batch k-means on this many samples per step
+    bool deterministic = true;          // fixed seed: same textures give the same palette
+    uint32_t seed = 0x9E3779B9u;
+    const Palette* warmStart = nullptr; // seed centers from an existing palette instead of k-means++
+};
+
 class Palette {
 public:
     static constexpr unsigned int COLOR_COUNT = 16;
@@ -42,7 +56,8 @@ public:
     Palette(
         const std::vector<std::pair<float, std::shared_ptr<Texture>>>& textures,
         const std::vector<WeightedTextureArray>& textureArrays,
-        bool sortByLuminance = true
+        bool sortByLuminance = true,
+        const PaletteBuildOptions& options = PaletteBuildOptions{}
     );
 
     Palette(std::array<PaletteEntry, 16> customEntries);
@@ -83,7 +98,8 @@ public:
     MonochromePalette(std::array<PaletteEntry, 16> customEntries);
     MonochromePalette(
         const std::vector<std::pair<float, std::shared_ptr<Texture>>>& textures,
-        const std::vector<WeightedTextureArray>& textureArrays
+        const std::vector<WeightedTextureArray>& textureArrays,
+        const PaletteBuildOptions& options = PaletteBuildOptions{}
     );
 
     float GetDarkL() const { return _darkL; }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -50,10 +51,57 @@ public:
         bool          depthTest       = true;     // false = HUD/overlay: no occlusion test; writes near depth for SSAA
         float         sortKey         = 0.0f;     // used for transparent sorting (e.g. depth or layer)
         std::vector<UniformOverride> overrides;   // per-draw uniform overrides
+
+        // Instanced variant: when instanceCount > 0 the mesh is drawn instanceCount times, with
+        // instanceData (instanceCount * instanceStride bytes) as the per-instance stream. The
+        // material's VertFormat must declare matching per-instance elements. Copied on submit.
+        const void*   instanceData    = nullptr;
+        uint32_t      instanceCount   = 0;
+        uint32_t      instanceStride  = 0;
+    };
+
+    /// Draw-queue counters for one executed frame (see GetDrawStats).
+    struct DrawStats {
+        uint32_t draws           = 0;
+        uint32_t batches         = 0;  // runs of consecutive draws sharing material, texture and GPU state
+        uint32_t materialBinds   = 0;
+        uint32_t stateChanges    = 0;  // material binds + rasterizer/depth/blend changes
+        uint32_t constantUploads = 0;
+        uint32_t meshBufferBinds = 0;  // vertex/index buffer binds (pooled meshes share them)
+        uint32_t instancedDraws  = 0;  // draws that used the per-instance stream (also counted in draws)
+        uint32_t instances       = 0;  // instances drawn by them
+        size_t   instanceBytes   = 0;  // per-instance data uploaded for the frame
+        size_t   constantBytes   = 0;  // constant-buffer bytes actually copied (dirty registers only)
+        size_t   overrideBytes   = 0;  // uniform override arena bytes used
+        size_t   bytesAllocated  = 0;  // queue heap growth while recording (0 once warmed up)
+    };
+
+    /// Mesh geometry held in system memory (CPU copies) versus GPU buffers (see MeshResidency).
+    struct MeshMemoryStats {
+        size_t cpuBytes = 0;
+        size_t gpuBytes = 0;
+        size_t gpuMeshes = 0;
+    };
+
+    /// Shared vertex/index slabs used by pooled meshes (Mesh::SetPooled), summed over all slabs.
+    struct MeshArenaStats {
+        uint32_t slabs = 0;
+        uint32_t meshes = 0;
+        size_t vertexBytesUsed = 0;
+        size_t vertexBytesCapacity = 0;
+        size_t indexBytesUsed = 0;
+        size_t indexBytesCapacity = 0;
+        uint32_t freeBlocks = 0;
+        float vertexFragmentation = 0.0f;   // worst slab, 1 - largest free block / free space
+        float indexFragmentation = 0.0f;
     };
 
     /// Opaque GPU mesh cache; storage defined in engine implementation.
     struct GPUMeshCache;
+    /// One frame of recorded draws plus material snapshots (see src/renderer/RendererImpl.hpp).
+    struct DrawPacket;
+    struct QueuedDraw;
+    struct RecordedMaterial;
     /// Implementation state (see src/renderer/RendererImpl.hpp).
     struct Impl;
 
@@ -81,15 +129,35 @@ public:
     // =========================================================================
     // GPU frame lifecycle
     // =========================================================================
-    /// Clears internal draw queues and begins the GPU render pass for this frame.
+    /// Clears and binds the render target for this frame.
     void BeginGpuFrame();
-    /// Enqueue a draw call; actual GPU draws are issued during FlushDraws().
+    /// Enqueue a draw call into the record packet; actual GPU draws are issued during FlushDraws().
     void SubmitDraw(const DrawCall& call);
+    /// As above, but takes the overrides from \a overrides instead of call.overrides, so hot
+    /// callers can reuse one buffer. Overrides are copied into the packet's per-frame arena.
+    void SubmitDraw(const DrawCall& call, const UniformOverride* overrides, size_t overrideCount);
     /// Execute queued draws in two passes: opaque then transparent.
+    /// When not pipelined this first publishes the draws recorded since the last flush.
     void FlushDraws();
+    /// Counters from the most recently executed frame.
+    DrawStats GetDrawStats() const;
     /// End the GPU render pass for this frame (resolve + download).
     void EndGpuFrame();
 
+    // =========================================================================
+    // Pipelined submission
+    // =========================================================================
+    /// Draws are recorded into one packet and executed from the other. When pipelined, FlushDraws()
+    /// only executes the published packet, so recording frame N+1 (SubmitDraw, on the simulation
+    /// thread) may overlap BeginGpuFrame..EndGpuFrame of frame N (on a render thread).
+    /// Change only while no frame is executing.
+    void SetPipelinedSubmission(bool enabled);
+    bool GetPipelinedSubmission() const;
+    /// Seals the record packet (snapshots uniforms/textures of every material it references) and
+    /// makes it the packet FlushDraws() executes; recording continues into the other packet.
+    /// Pipelined mode: call once per frame while the render thread is idle.
+    void PublishRecordedDraws();
+
     // =========================================================================
     // Queued drawing
     // =========================================================================
@@ -132,6 +200,12 @@ public:
     void SetMaxAnisotropy(int level);
     int GetMaxAnisotropy() const;
 
+    /// Fraction of the render target (per axis) the scene is drawn into, clamped to [0.25, 1].
+    /// Below 1 the resolve resamples that sub-rect onto the fixed cell grid, trading detail for
+    /// fill cost; with SSAA on, 0.5 is plain 1x rendering. Default 1. See FrameBudgetController.
+    void SetRenderScale(float scale);
+    float GetRenderScale() const;
+
     // =========================================================================
     // Utility
     // =========================================================================
@@ -140,9 +214,14 @@ public:
     // =========================================================================
     // GPU resource helpers
     // =========================================================================
-    /// Called by resource destructors.
+    /// Called by resource destructors. Freed once every packet that may reference it has executed.
     void ReleaseMeshCache(void* cachePtr);
+    MeshMemoryStats GetMeshMemoryStats() const;
+    /// Occupancy and fragmentation of the shared slabs behind pooled meshes.
+    MeshArenaStats GetMeshArenaStats() const;
     void InvalidateCachedTexture(const Texture* tex);
+    /// True once the render thread holds a GPU copy of \a texArray; safe from any thread.
+    bool HasTextureArraySRV(const TextureArray* texArray) const;
     /// Returns nullptr if using the default shader program.
     ShaderProgram* GetBoundShaderProgram() const;
 
@@ -195,6 +274,8 @@ private:
     bool InitializeBlueNoiseTexture();
     bool InitializeDownsampleShader();
     void RunDownsamplePass();
+    bool InitializeRescaleShader();
+    void RunRescalePass();
 
 #ifdef _WIN32
     /// D3D device for shader compilation; nullptr if not initialized.
@@ -219,10 +300,20 @@ private:
     // Draw-call execution
     // -------------------------------------------------------------------------
     GPUMeshCache* GetOrCreateMeshCache(const Mesh* mesh);
-    void DrawMesh(const Mesh* mesh);
-    void SortOpaqueDraws();
-    void SortTransparentDraws();
-    void ExecuteDrawList(const std::vector<DrawCall>& list, const DrawGpuState& passState);
+    /// Suballocates \a mesh from a shared slab and queues its data for upload; nullptr if no slab could be created.
+    GPUMeshCache* CreatePooledMeshCache(const Mesh* mesh);
+    /// Render thread: writes the packet's pooled mesh data into the slabs before its draws run.
+    void UploadPendingMeshes(DrawPacket& packet);
+    /// Binds the mesh buffers (skipped when already bound) and draws; returns the number of IA binds issued.
+    uint32_t DrawMesh(const GPUMeshCache* cache, unsigned int stride);
+    /// As DrawMesh, with the draw's slice of the instance buffer bound to slot 1 (DrawIndexedInstanced).
+    uint32_t DrawMeshInstanced(const GPUMeshCache* cache, unsigned int stride, const QueuedDraw& draw);
+    /// Render thread: copies the packet's instance arena into the shared dynamic instance buffer.
+    bool UploadInstanceData(DrawPacket& packet);
+    void SortDrawPacket(DrawPacket& packet);
+    void ExecuteDrawList(DrawPacket& packet, bool transparent, const DrawGpuState& passState);
+    void SealDrawPacket(DrawPacket& packet);
+    void ReleaseDrawPacket(DrawPacket& packet);
     void ApplyDrawState(const DrawGpuState& desired);
     void InvalidateBoundState();
 
@@ -235,13 +326,17 @@ private:
     // -------------------------------------------------------------------------
     void BindShaderProgram(ShaderProgram* program);
     void UnbindShaderProgram();
-    void BindMaterial(Material* material);
-    void UploadMaterialConstants(Material* material);
+    /// Binds program and texture slots (\a meshTexture, if set, replaces t0). Returns false if the
+    /// program is invalid or a texture could not be uploaded; such a slot is left unbound.
+    bool BindMaterial(const RecordedMaterial& material, const Texture* meshTexture);
+    /// Uploads the registers that differ from the material's GPU buffer and binds it; returns bytes copied.
+    size_t UploadMaterialConstants(const RecordedMaterial& material);
 
     bool CreateTextureFromASCIIgLTexture(const Texture* tex, ID3D11ShaderResourceView** srv);
     bool CreateTextureArraySRV(const TextureArray* texArray, ID3D11ShaderResourceView** srv);
-    void BindTexture(const Texture* tex, int slot = 0, SamplerType type = SamplerType::Default);
-    void BindTextureArray(const TextureArray* texArray, int slot = 0, SamplerType type = SamplerType::Default);
+    /// Both return false (and leave the slot unbound) when no SRV could be created.
+    bool BindTexture(const Texture* tex, int slot = 0, SamplerType type = SamplerType::Default);
+    bool BindTextureArray(const TextureArray* texArray, int slot = 0, SamplerType type = SamplerType::Default);
     void UnbindTexture(int slot = 0);
     void UnbindTextureArray(int slot = 0);
 
@@ -47,6 +47,24 @@ struct UniformDescriptor {
     static uint32_t GetTypeAlignment(UniformType type);
 };
 
+/// A uniform resolved once against a program's layout (see Material::GetUniformHandle), so hot
+/// paths can write it by offset instead of hashing/comparing its name every frame.
+/// Only valid for materials using the layout it was resolved from.
+struct UniformHandle {
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    UniformType type = UniformType::Float;
+    bool valid = false;
+
+    UniformHandle() = default;
+    explicit UniformHandle(const UniformDescriptor* desc)
+        : offset(desc ? desc->offset : 0), size(desc ? desc->size : 0),
+          type(desc ? desc->type : UniformType::Float), valid(desc != nullptr) {}
+
+    bool IsValid() const { return valid; }
+    explicit operator bool() const { return valid; }
+};
+
 class UniformBufferLayout {
 public:
     class Builder {
@@ -57,12 +57,13 @@ enum class VertexElementSemantic {
 class VertexElement {
 public:
     VertexElement(VertexElementSemantic semantic, VertexElementType type, 
-                  uint32_t offset, uint32_t semanticIndex = 0);
+                  uint32_t offset, uint32_t semanticIndex = 0, bool perInstance = false);
 
     VertexElementSemantic GetSemantic() const { return _semantic; }
     VertexElementType GetType() const { return _type; }
-    uint32_t GetOffset() const { return _offset; }
+    uint32_t GetOffset() const { return _offset; }  // within the vertex, or within the instance if per-instance
     uint32_t GetSemanticIndex() const { return _semanticIndex; }
+    bool IsPerInstance() const { return _perInstance; }
     uint32_t GetSize() const;  // Size in bytes
 
     // Comparison for caching
@@ -74,6 +75,7 @@ private:
     VertexElementType _type;
     uint32_t _offset;
     uint32_t _semanticIndex;
+    bool _perInstance;
 };
 
 // =========================================================================
@@ -97,18 +99,25 @@ public:
         Builder& AddInt3(VertexElementSemantic semantic, uint32_t semanticIndex = 0);
         Builder& AddInt4(VertexElementSemantic semantic, uint32_t semanticIndex = 0);
         Builder& AddUByte4Normalized(VertexElementSemantic semantic, uint32_t semanticIndex = 0);
+
+        // Per-instance elements: read from the second vertex stream (input slot 1), advancing once
+        // per instance. Laid out in their own struct, independent of the per-vertex offsets.
+        Builder& AddInstance(VertexElementSemantic semantic, VertexElementType type, uint32_t semanticIndex = 0);
         
         VertFormat Build() const;
 
     private:
         std::vector<VertexElement> _elements;
         uint32_t _currentOffset = 0;
+        uint32_t _currentInstanceOffset = 0;
     };
 
     VertFormat() = default;
 
     const std::vector<VertexElement>& GetElements() const { return _elements; }
-    uint32_t GetStride() const { return _stride; }
+    uint32_t GetStride() const { return _stride; }                  // per-vertex elements only
+    uint32_t GetInstanceStride() const { return _instanceStride; }  // 0 unless the format has per-instance elements
+    bool HasInstanceElements() const { return _instanceStride > 0; }
     bool IsEmpty() const { return _elements.empty(); }
 
     // Comparison for caching
@@ -123,6 +132,7 @@ private:
     
     std::vector<VertexElement> _elements;
     uint32_t _stride = 0;
+    uint32_t _instanceStride = 0;
 };
 
 // =========================================================================
@@ -156,6 +166,13 @@ namespace VertFormats {
     
     // Position (XYZ) + TexCoord (UV) + Layer Index - For Texture2DArray rendering
     const VertFormat& PosUVLayer();
+
+    // PosUVLayer + packed light (sky * 16 + block) -> TEXCOORD1 - Lit voxel terrain
+    const VertFormat& PosUVLayerLight();
+
+    // PosUVLayer per vertex + InstanceTransformTintLayer per instance:
+    // model matrix columns -> TEXCOORD4..7, tint -> COLOR0, layer -> TEXCOORD8
+    const VertFormat& PosUVLayerInstanced();
 }
 
 // =========================================================================
@@ -238,6 +255,25 @@ struct PosUVLayer {
     void SetLayer(float layer) { data[5] = layer; }
 };
 
+// PosUVLayerLight vertex: PosUVLayer + Light (7 floats = 28 bytes) - For lit voxel terrain
+// Light packs the two 0-15 light levels as sky * 16 + block.
+struct PosUVLayerLight {
+    float data[7];
+
+    float X() const { return data[0]; }
+    float Y() const { return data[1]; }
+    float Z() const { return data[2]; }
+    float Layer() const { return data[5]; }
+    float Light() const { return data[6]; }
+
+    glm::vec3 GetXYZ() const { return glm::vec3(data[0], data[1], data[2]); }
+    glm::vec3 GetUVLayer() const { return glm::vec3(data[3], data[4], data[5]); }
+
+    void SetXYZ(const glm::vec3 v) { data[0] = v.x; data[1] = v.y; data[2] = v.z; }
+    void SetUVLayer(const glm::vec3 v) { data[3] = v.x; data[4] = v.y; data[5] = v.z; }
+    void SetLight(float light) { data[6] = light; }
+};
+
 struct PosColor {
     float data[4]; // XYZ + RGBA (packed UByte4Normalized)
 
@@ -273,6 +309,25 @@ struct PosColor {
     }
 };
 
+// Per-instance data for VertFormats::PosUVLayerInstanced (21 floats = 84 bytes)
+struct InstanceTransformTintLayer {
+    float data[21]; // model (column-major 4x4) + RGBA tint + layer
+
+    glm::vec4 GetTint() const { return glm::vec4(data[16], data[17], data[18], data[19]); }
+    float Layer() const { return data[20]; }
+
+    void SetModel(const glm::mat4& m) {
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                data[c * 4 + r] = m[c][r];
+            }
+        }
+    }
+    void SetTint(const glm::vec4& t) { data[16] = t.x; data[17] = t.y; data[18] = t.z; data[19] = t.w; }
+    /// Texture-array layer replacing the vertex layer; negative keeps the mesh's own layer.
+    void SetLayer(float layer) { data[20] = layer; }
+};
+
 } // namespace VertStructs
 
 } // namespace ASCIIgL
@@ -7,6 +7,7 @@
 
 #include <ASCIIgL/renderer/Palette.hpp>
 #include <ASCIIgL/renderer/screen/ScreenTypes.hpp>
+#include <ASCIIgL/renderer/screen/ScreenDirtyTiles.hpp>
 
 #include <glm/glm.hpp>
 
@@ -27,6 +28,7 @@ private:
     std::wstring _title;
     float _fontSize = 0.0f;
     std::unique_ptr<Palette> _palette;
+    ScreenDirtyTiles _dirtyTiles;
 
     Screen();
     ~Screen();
@@ -44,7 +46,14 @@ public:
 
     void RenderTabTitle();
     void ClearPixelBuffer();
+    /// Hashes the pixel buffer per tile (terminal mode) and hands the frame plus its dirty tiles to the backend.
     void OutputBuffer();
+    /// Forces the next OutputBuffer() to rewrite every cell. Called automatically when the terminal
+    /// backend sees the console resize; call it after anything else that overwrites the console.
+    void InvalidateOutput();
+    /// Fraction of cells in tiles that changed during the last OutputBuffer() (1 = full redraw, 0 = idle).
+    float GetChangedCellRatio() const;
+    const ScreenDirtyTiles& GetDirtyTiles() const { return _dirtyTiles; }
     void PlotPixel(const glm::vec2& p, wchar_t character, unsigned short Colour);
     void PlotPixel(const glm::vec2& p, const ScreenPixel& charCol);
     void PlotPixel(int x, int y, wchar_t character, unsigned short Colour);
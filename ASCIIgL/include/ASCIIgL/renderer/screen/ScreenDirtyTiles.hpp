@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <ASCIIgL/renderer/screen/ScreenTypes.hpp>
+
+namespace ASCIIgL {
+
+/// Frame-to-frame change tracking for the ScreenPixel buffer.
+/// The grid is split into TILE_SIZE x TILE_SIZE tiles; each Update() hashes every tile and
+/// compares it with the previous frame's hash. Backends use the dirty flags (or the merged
+/// rectangles from BuildDirtyRects) to write only the cells that actually changed.
+class ScreenDirtyTiles {
+public:
+    static constexpr int TILE_SIZE = 8;
+
+    /// Reallocates tile storage for a width x height cell grid and marks every tile dirty.
+    void Resize(unsigned int width, unsigned int height);
+    /// Hashes the current frame and marks tiles whose hash differs from the previous frame.
+    void Update(const ScreenPixel* pixels);
+    /// Forces the next Update() to report every tile as dirty (e.g. after the console was resized).
+    void InvalidateAll();
+
+    bool AnyDirty() const { return _dirtyTileCount > 0; }
+    size_t GetDirtyTileCount() const { return _dirtyTileCount; }
+    size_t GetTileCount() const { return _dirtyFlags.size(); }
+    int GetTilesX() const { return _tilesX; }
+    int GetTilesY() const { return _tilesY; }
+    unsigned int GetWidth() const { return _width; }
+    unsigned int GetHeight() const { return _height; }
+
+    /// One byte per tile (row-major, GetTilesX() per row); non-zero = changed this frame.
+    const std::vector<uint8_t>& GetDirtyFlags() const { return _dirtyFlags; }
+
+    /// Fraction of cells covered by tiles that changed in the last Update() (0 = idle frame, 1 = full redraw).
+    float GetChangedCellRatio() const { return _changedCellRatio; }
+
+    /// Merges dirty tiles into inclusive cell rectangles: horizontal runs per tile row, then
+    /// runs with the same span on consecutive tile rows. flags must be laid out like GetDirtyFlags().
+    void BuildDirtyRects(const std::vector<uint8_t>& flags, std::vector<ScreenRect>& outRects) const;
+
+private:
+    unsigned int _width = 0;
+    unsigned int _height = 0;
+    int _tilesX = 0;
+    int _tilesY = 0;
+
+    std::vector<uint64_t> _tileHashes;
+    std::vector<uint8_t> _dirtyFlags;
+    size_t _dirtyTileCount = 0;
+    float _changedCellRatio = 1.0f;
+    bool _forceFull = true;
+
+    uint64_t HashTile(const ScreenPixel* pixels, int tx, int ty) const;
+    size_t TileCellCount(int tx, int ty) const;
+};
+
+} // namespace ASCIIgL
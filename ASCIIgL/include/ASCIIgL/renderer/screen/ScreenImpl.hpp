@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <ASCIIgL/renderer/Palette.hpp>
 #include <ASCIIgL/renderer/screen/ScreenTypes.hpp>
+#include <ASCIIgL/renderer/screen/ScreenDirtyTiles.hpp>
 #include <glm/glm.hpp>
 
 namespace ASCIIgL {
@@ -17,7 +18,12 @@ public:
 
     virtual int Initialize(unsigned int width, unsigned int height, float fontSize, const Palette& palette) = 0;
     virtual void ClearPixelBuffer() = 0;
-    virtual void OutputBuffer() = 0;
+    /// Present the pixel buffer. dirtyTiles holds this frame's changed tiles (computed by Screen);
+    /// backends that can write sub-rectangles should only write those.
+    virtual void OutputBuffer(const ScreenDirtyTiles& dirtyTiles) = 0;
+    /// True once after the output surface was resized (its contents can no longer be trusted);
+    /// Screen then forces a full redraw. Default: never.
+    virtual bool ConsumeOutputInvalidated() { return false; }
     virtual void RenderTabTitle() = 0;
     virtual void PlotPixel(const glm::vec2& p, wchar_t character, unsigned short Colour) = 0;
     virtual void PlotPixel(const glm::vec2& p, const ScreenPixel& charCol) = 0;
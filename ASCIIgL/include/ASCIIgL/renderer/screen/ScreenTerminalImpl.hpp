@@ -3,6 +3,7 @@
 #include <ASCIIgL/renderer/screen/ScreenImpl.hpp>
 #include <vector>
 #include <string>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -28,14 +29,27 @@ private:
     // so it runs on its own thread while the game thread starts the next frame.
     // OutputBuffer() copies _pixelBuffer into _presentBuffer (overwriting any frame the
     // presenter hasn't picked up yet, i.e. frames are dropped rather than blocking).
+    // Dirty tile flags are OR-ed into _pendingDirtyTiles so a dropped frame's changes are
+    // still written; the presenter only writes the rectangles covering dirty tiles.
     std::thread _presenterThread;
     std::mutex _presentMutex;
     std::condition_variable _presentCV;
     std::vector<CHAR_INFO> _presentBuffer; // pending frame, guarded by _presentMutex
     std::vector<CHAR_INFO> _writeBuffer;   // presenter-owned during WriteConsoleOutputW
+    std::vector<uint8_t> _pendingDirtyTiles; // guarded by _presentMutex
+    std::vector<uint8_t> _writeDirtyTiles;   // presenter-owned
+    std::vector<ScreenRect> _writeRects;     // presenter-owned
+    const ScreenDirtyTiles* _dirtyTileLayout = nullptr; // Screen-owned; layout only (tile grid size)
     bool _framePending = false;
     bool _presenterExit = false;
 
+    // Console size last seen by ConsumeOutputInvalidated(); polled at most every RESIZE_POLL_INTERVAL
+    // so idle frames stay free of console RPCs.
+    static constexpr std::chrono::milliseconds RESIZE_POLL_INTERVAL{250};
+    std::chrono::steady_clock::time_point _lastResizePoll{};
+    COORD _lastConsoleSize = {0, 0};
+    SMALL_RECT _lastConsoleWindow = {0, 0, 0, 0};
+
     void PresenterLoop();
     void StopPresenter();
 
@@ -50,7 +64,8 @@ public:
 
     int Initialize(unsigned int width, unsigned int height, float fontSize, const Palette& palette) override;
     void ClearPixelBuffer() override;
-    void OutputBuffer() override;
+    void OutputBuffer(const ScreenDirtyTiles& dirtyTiles) override;
+    bool ConsumeOutputInvalidated() override;
     void RenderTabTitle() override;
     void PlotPixel(const glm::vec2& p, wchar_t character, unsigned short Colour) override;
     void PlotPixel(const glm::vec2& p, const ScreenPixel& charCol) override;
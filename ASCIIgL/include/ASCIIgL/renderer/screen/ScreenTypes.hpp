@@ -11,4 +11,12 @@ struct ScreenPixel {
     uint16_t attributes = 0;
 };
 
+/// Inclusive cell rectangle (same convention as Win32 SMALL_RECT).
+struct ScreenRect {
+    int left = 0;
+    int top = 0;
+    int right = 0;
+    int bottom = 0;
+};
+
 } // namespace ASCIIgL
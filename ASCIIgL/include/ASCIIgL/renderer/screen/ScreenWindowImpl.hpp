@@ -29,7 +29,7 @@ public:
 
     int Initialize(unsigned int width, unsigned int height, float fontSize, const Palette& palette) override;
     void ClearPixelBuffer() override;
-    void OutputBuffer() override;
+    void OutputBuffer(const ScreenDirtyTiles& dirtyTiles) override;
     void RenderTabTitle() override;
     void PlotPixel(const glm::vec2& p, wchar_t character, unsigned short Colour) override;
     void PlotPixel(const glm::vec2& p, const ScreenPixel& charCol) override;
@@ -0,0 +1,33 @@
+#pragma once
+
+namespace ASCIIgL {
+
+/// Instruction-set tiers the load-time pixel kernels (mip filters, monochrome mapping) are written for.
+enum class SimdLevel {
+    Scalar = 0,
+    SSE2 = 1,
+    AVX2 = 2,
+};
+
+/// What the running CPU (and OS, for the AVX register state) supports. Detected once via CPUID.
+struct CpuFeatures {
+    bool sse2 = false;
+    bool avx2 = false;
+
+    static const CpuFeatures& Get();
+};
+
+/// Highest tier that is both compiled into this binary and supported by the CPU, capped by
+/// SetSimdLevelLimit. Kernels dispatch on this per call.
+///
+/// ASCIIgL itself is built with /arch:AVX2 (-mavx2) and GLM_FORCE_SIMD_AVX2, so the library as a
+/// whole requires an AVX2 CPU; the SSE2 and scalar tiers are the references the AVX2 kernels are
+/// checked against (asserted in debug builds) and what SetSimdLevelLimit selects for comparisons.
+SimdLevel GetSimdLevel();
+
+/// Caps GetSimdLevel (e.g. SimdLevel::Scalar to compare against the reference path). Thread-safe.
+void SetSimdLevelLimit(SimdLevel limit);
+
+const char* ToString(SimdLevel level);
+
+} // namespace ASCIIgL
@@ -1,85 +1,180 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
-#include <typeindex>
-#include <typeinfo>
-#include <unordered_map>
+#include <mutex>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace ASCIIgL {
 
+namespace detail {
+
+/// Next dense event type id (0, 1, 2...). One counter for the whole program.
+std::size_t NextEventTypeId();
+
+/// Id of event type \p T, assigned on first use and stable for the rest of the run.
+template<typename T>
+std::size_t EventTypeId() {
+    static const std::size_t id = NextEventTypeId();
+    return id;
+}
+
+} // namespace detail
+
+/// Per-frame event queues, one typed vector per event type.
+///
+/// Buffers sit in a flat vector indexed by a dense per-type id, so emit and view are an index, not
+/// a hash lookup. endFrame only visits the buffers that received events.
+///
+/// Single buffering (default): view sees this frame's events and endFrame drops them.
+/// Double buffering: endFrame swaps instead, so viewPrevious returns the last frame's events
+/// without copying them.
+///
+/// emit/view/endFrame belong to the main thread. Worker jobs use emitConcurrent, which stages
+/// events under a lock; they show up in view after flushConcurrent or the next endFrame.
 class EventBus {
 public:
+    enum class Buffering { Single, Double };
+
+    explicit EventBus(Buffering buffering = Buffering::Single) : m_buffering(buffering) {}
+
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
     template<typename T>
     void emit(T&& event) {
         using U = std::decay_t<T>;
-        auto& vec = getOrCreateBuffer<U>();
-        vec.emplace_back(std::forward<T>(event));
+        Buffer<U>& buf = getOrCreateBuffer<U>(m_buffers);
+        if (!buf.touched) {
+            buf.touched = true;
+            m_touched.push_back(&buf);
+        }
+        buf.current.emplace_back(std::forward<T>(event));
+    }
+
+    /// Thread-safe emit for worker jobs (see class comment for when the events become visible).
+    template<typename T>
+    void emitConcurrent(T&& event) {
+        using U = std::decay_t<T>;
+        std::lock_guard<std::mutex> lock(m_stagedMutex);
+        Buffer<U>& buf = getOrCreateBuffer<U>(m_staged);
+        if (!buf.touched) {
+            buf.touched = true;
+            m_stagedTouched.push_back(detail::EventTypeId<U>());
+        }
+        buf.current.emplace_back(std::forward<T>(event));
+        m_hasStaged.store(true, std::memory_order_release);
     }
 
     template<typename T>
     std::vector<T>& view() {
-        auto it = m_currentFrameEvents.find(std::type_index(typeid(T)));
-        if (it == m_currentFrameEvents.end()) {
-            static std::vector<T> empty;
-            return empty;
+        if (Buffer<T>* buf = findBuffer<T>()) {
+            return buf->current;
         }
-        return static_cast<Buffer<T>*>(it->second.get())->data;
+        static std::vector<T> empty;
+        return empty;
     }
 
     template<typename T>
     const std::vector<T>& view() const {
-        auto it = m_currentFrameEvents.find(std::type_index(typeid(T)));
-        if (it == m_currentFrameEvents.end()) {
-            static std::vector<T> empty;
-            return empty;
+        if (const Buffer<T>* buf = findBuffer<T>()) {
+            return buf->current;
         }
-        return static_cast<const Buffer<T>*>(it->second.get())->data;
+        static const std::vector<T> empty;
+        return empty;
     }
 
-    void clear() {
-        for (auto& [type, buffer] : m_currentFrameEvents) {
-            (void)type;
-            buffer->clear();
+    /// Last frame's events (double buffering only; always empty with single buffering).
+    template<typename T>
+    const std::vector<T>& viewPrevious() const {
+        if (const Buffer<T>* buf = findBuffer<T>()) {
+            return buf->previous;
         }
+        static const std::vector<T> empty;
+        return empty;
     }
 
-    void endFrame() {
-        clear();
-    }
+    /// Drops this frame's events (and, double buffered, last frame's too).
+    void clear();
+
+    /// Ends the frame: single buffering clears, double buffering rotates current into previous.
+    /// Staged concurrent events are then moved into the new frame.
+    void endFrame();
+
+    /// Moves events staged by emitConcurrent into the current frame (main thread).
+    void flushConcurrent();
+
+    Buffering getBuffering() const { return m_buffering; }
 
 private:
     struct IBuffer {
+        bool touched = false;   // listed in m_touched (or m_stagedTouched) this frame
+
         virtual ~IBuffer() = default;
-        virtual void clear() = 0;
+        virtual void clearCurrent() = 0;
+        virtual void clearPrevious() = 0;
+        virtual void rotate() = 0;                          // previous must be empty
+        virtual std::unique_ptr<IBuffer> makeEmpty() const = 0;
+        /// Appends current into \p dst's current (same type), leaving this one empty.
+        virtual void drainInto(IBuffer& dst) = 0;
     };
 
     template<typename T>
-    struct Buffer : IBuffer {
-        std::vector<T> data;
-        void clear() override { data.clear(); }
-    };
+    struct Buffer final : IBuffer {
+        std::vector<T> current;
+        std::vector<T> previous;
 
-    using BufferPtr = std::unique_ptr<IBuffer>;
-    using BufferMap = std::unordered_map<std::type_index, BufferPtr>;
+        void clearCurrent() override { current.clear(); }
+        void clearPrevious() override { previous.clear(); }
+        void rotate() override { current.swap(previous); }
+        std::unique_ptr<IBuffer> makeEmpty() const override { return std::make_unique<Buffer<T>>(); }
+        void drainInto(IBuffer& dst) override {
+            auto& target = static_cast<Buffer<T>&>(dst).current;
+            if (target.empty()) {
+                target.swap(current);
+            } else {
+                target.insert(target.end(), std::make_move_iterator(current.begin()),
+                              std::make_move_iterator(current.end()));
+                current.clear();
+            }
+        }
+    };
 
-    BufferMap m_currentFrameEvents;
+    using BufferList = std::vector<std::unique_ptr<IBuffer>>;
 
     template<typename T>
-    std::vector<T>& getOrCreateBuffer() {
-        auto key = std::type_index(typeid(T));
-        auto it = m_currentFrameEvents.find(key);
-
-        if (it == m_currentFrameEvents.end()) {
-            auto buf = std::make_unique<Buffer<T>>();
-            auto* raw = buf.get();
-            m_currentFrameEvents.emplace(key, std::move(buf));
-            return raw->data;
+    static Buffer<T>& getOrCreateBuffer(BufferList& list) {
+        const std::size_t id = detail::EventTypeId<T>();
+        if (id >= list.size()) {
+            list.resize(id + 1);
+        }
+        auto& slot = list[id];
+        if (!slot) {
+            slot = std::make_unique<Buffer<T>>();
         }
+        return static_cast<Buffer<T>&>(*slot);
+    }
 
-        return static_cast<Buffer<T>*>(it->second.get())->data;
+    template<typename T>
+    Buffer<T>* findBuffer() const {
+        const std::size_t id = detail::EventTypeId<T>();
+        return id < m_buffers.size() ? static_cast<Buffer<T>*>(m_buffers[id].get()) : nullptr;
     }
+
+    IBuffer& getOrCreateBufferFor(std::size_t id, const IBuffer& prototype);
+
+    Buffering m_buffering;
+    BufferList m_buffers;                   // indexed by detail::EventTypeId
+    std::vector<IBuffer*> m_touched;        // received events this frame
+    std::vector<IBuffer*> m_stale;          // previous is non-empty (double buffering)
+
+    std::mutex m_stagedMutex;
+    BufferList m_staged;                    // emitConcurrent targets, same indexing
+    std::vector<std::size_t> m_stagedTouched;   // ids of staged buffers holding events
+    std::atomic<bool> m_hasStaged{false};
 };
 
 } // namespace ASCIIgL
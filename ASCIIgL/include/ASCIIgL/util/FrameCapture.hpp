@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <ASCIIgL/renderer/screen/ScreenTypes.hpp>
+
+namespace ASCIIgL {
+
+/// One recorded frame: the camera/player state that produced it plus the resolved ScreenPixel grid.
+/// Replays either play the camera path back through the full pipeline, or push \ref pixels
+/// straight through Screen output.
+struct CapturedFrame {
+    float deltaTime = 0.0f;
+    glm::vec3 playerPos{0.0f};
+    glm::vec3 cameraPos{0.0f};
+    float cameraYaw = 0.0f;
+    float cameraPitch = 0.0f;
+    float cameraFov = 0.0f;
+    std::vector<ScreenPixel> pixels;
+};
+
+/// Binary capture file layout (little-endian):
+///   header: "AGLC" magic, uint32 version, uint32 width, uint32 height
+///   frame:  float dt, 3x float playerPos, 3x float cameraPos, float yaw, float pitch, float fov,
+///           uint32 cellCount, cellCount x (uint16 glyph, uint16 attributes)
+/// Glyphs are stored as 16-bit code units so captures are portable across wchar_t sizes.
+namespace FrameCapture {
+constexpr uint32_t MAGIC = 0x434C4741; // "AGLC"
+constexpr uint32_t VERSION = 1;
+}
+
+class FrameCaptureWriter {
+public:
+    bool Open(const std::string& path, unsigned int width, unsigned int height);
+    bool WriteFrame(const CapturedFrame& frame);
+    void Close();
+    bool IsOpen() const { return _file.is_open(); }
+    size_t GetFrameCount() const { return _frameCount; }
+
+private:
+    std::ofstream _file;
+    unsigned int _width = 0;
+    unsigned int _height = 0;
+    size_t _frameCount = 0;
+    std::vector<uint16_t> _scratch;
+};
+
+class FrameCaptureReader {
+public:
+    bool Open(const std::string& path);
+    /// Reads the next frame into \a out. Returns false at end of file or on a truncated frame.
+    bool ReadFrame(CapturedFrame& out);
+    void Close();
+    bool IsOpen() const { return _file.is_open(); }
+    unsigned int GetWidth() const { return _width; }
+    unsigned int GetHeight() const { return _height; }
+
+private:
+    std::ifstream _file;
+    unsigned int _width = 0;
+    unsigned int _height = 0;
+    std::vector<uint16_t> _scratch;
+};
+
+} // namespace ASCIIgL
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace ASCIIgL {
+
+/// Runs the back half of the frame loop (GPU execution + presentation) on a dedicated thread,
+/// one frame behind the caller. The queue holds a single frame: the caller records frame N+1
+/// while frame N executes, then WaitIdle() before handing N+1 over with Submit(). The point
+/// between the two is the only time per-frame state shared with the stage (e.g. Renderer draw
+/// packets) may be swapped.
+class FramePipeline {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Stage = std::function<void(uint64_t frameIndex)>;
+
+    FramePipeline() = default;
+    ~FramePipeline();
+
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+
+    void Start(Stage stage);
+    /// Finishes the in-flight frame (if any) and joins the thread. Safe to call repeatedly.
+    void Stop();
+    bool IsRunning() const;
+
+    /// Blocks until the in-flight frame has executed. Returns the time spent waiting in ms.
+    double WaitIdle();
+    /// Queues a frame whose simulation started at \a simulationStart. Call after WaitIdle().
+    void Submit(uint64_t frameIndex, Clock::time_point simulationStart);
+
+    /// Stage time of the last completed frame.
+    double GetLastExecuteMs() const;
+    /// Simulation start to end of presentation for the last completed frame.
+    double GetLastLatencyMs() const;
+
+private:
+    void ThreadLoop();
+
+    Stage _stage;
+    std::thread _thread;
+    mutable std::mutex _mutex;
+    std::condition_variable _workCv;
+    std::condition_variable _idleCv;
+
+    bool _running = false;
+    bool _stop = false;
+    bool _pending = false;
+    bool _busy = false;
+    uint64_t _frameIndex = 0;
+    Clock::time_point _simulationStart{};
+
+    double _lastExecuteMs = 0.0;
+    double _lastLatencyMs = 0.0;
+};
+
+} // namespace ASCIIgL
@@ -2,6 +2,22 @@
 
 #include <tracy/Tracy.hpp>
 
+#include <ASCIIgL/util/StageTimings.hpp>
+#include <ASCIIgL/util/StartupTimeline.hpp>
+
 #define PROFILE_SCOPE(name) ZoneScopedN(name)
 #define PROFILE_FRAME_MARK() FrameMark
 #define PROFILE_SCOPE_DEBUG(name) ZoneScopedN(name)
+#define PROFILE_PLOT(name, value) TracyPlot(name, value)
+
+// Tracy zone plus a StageTimings sample (recorded only while StageTimings is enabled, e.g. during replay).
+#define ASCIIGL_PROFILE_CONCAT_INNER(a, b) a##b
+#define ASCIIGL_PROFILE_CONCAT(a, b) ASCIIGL_PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_STAGE(name) \
+    ZoneScopedN(name); \
+    ASCIIgL::ScopedStageTimer ASCIIGL_PROFILE_CONCAT(_asciigl_stage_timer_, __LINE__)(name)
+
+// Tracy zone plus a StartupTimeline span (always recorded; used for one-off startup tasks).
+#define PROFILE_STARTUP(name) \
+    ZoneScopedN(name); \
+    ASCIIgL::ScopedStartupTask ASCIIGL_PROFILE_CONCAT(_asciigl_startup_task_, __LINE__)(name)
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+namespace ASCIIgL {
+
+/// First-fit free-list allocator over an abstract [0, capacity) range of units (vertices, indices,
+/// bytes...). It only hands out offsets; the caller owns the storage it indexes, which may be a GPU
+/// buffer or plain system memory. Freed ranges are coalesced with their neighbours.
+class RangeAllocator {
+public:
+    static constexpr uint32_t kInvalidOffset = UINT32_MAX;
+
+    struct Stats {
+        uint32_t capacity = 0;
+        uint32_t used = 0;
+        uint32_t freeBlocks = 0;
+        uint32_t largestFree = 0;
+        uint32_t allocations = 0;
+        /// 0 = all free space is one block; approaches 1 as it splinters (1 - largestFree / free).
+        float Fragmentation() const {
+            const uint32_t freeUnits = capacity - used;
+            return freeUnits > 0 ? 1.0f - static_cast<float>(largestFree) / static_cast<float>(freeUnits) : 0.0f;
+        }
+    };
+
+    explicit RangeAllocator(uint32_t capacity = 0) { Reset(capacity); }
+
+    /// Forgets every allocation; the whole range becomes one free block.
+    void Reset(uint32_t capacity);
+
+    /// Returns the offset of \p count contiguous units, or kInvalidOffset if no free block is large enough.
+    uint32_t Allocate(uint32_t count);
+    /// Returns a range obtained from Allocate (same offset and count).
+    void Free(uint32_t offset, uint32_t count);
+
+    uint32_t GetCapacity() const { return _capacity; }
+    uint32_t GetUsed() const { return _used; }
+    Stats GetStats() const;
+
+private:
+    std::map<uint32_t, uint32_t> _free;   // offset -> count, ordered so neighbours can merge
+    uint32_t _capacity = 0;
+    uint32_t _used = 0;
+    uint32_t _allocations = 0;
+};
+
+} // namespace ASCIIgL
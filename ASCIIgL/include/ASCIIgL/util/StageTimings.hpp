@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ASCIIgL {
+
+/// CPU wall-clock samples per named stage, keyed by the same names as PROFILE_SCOPE zones.
+/// Disabled by default; replay/benchmark runs enable it and print a summary at the end so
+/// renderer changes can be compared without a Tracy capture. Main-thread only.
+class StageTimings {
+public:
+    struct Summary {
+        std::string name;
+        size_t count = 0;
+        double meanMs = 0.0;
+        double p50Ms = 0.0;
+        double p95Ms = 0.0;
+        double maxMs = 0.0;
+        double totalMs = 0.0;
+    };
+
+    static StageTimings& GetInst() {
+        static StageTimings instance;
+        return instance;
+    }
+
+    void SetEnabled(bool enabled) { _enabled = enabled; }
+    bool IsEnabled() const { return _enabled; }
+
+    void Record(const char* name, double ms);
+    void Reset();
+
+    /// Per-stage statistics in first-recorded order.
+    std::vector<Summary> Summarize() const;
+    /// Plain-text table of Summarize(), one stage per line.
+    std::string FormatReport() const;
+
+private:
+    StageTimings() = default;
+    StageTimings(const StageTimings&) = delete;
+    StageTimings& operator=(const StageTimings&) = delete;
+
+    bool _enabled = false;
+    std::vector<std::string> _order;
+    std::unordered_map<std::string, std::vector<double>> _samples;
+};
+
+/// Records the lifetime of the scope into StageTimings when it is enabled.
+class ScopedStageTimer {
+public:
+    explicit ScopedStageTimer(const char* name)
+        : _name(StageTimings::GetInst().IsEnabled() ? name : nullptr) {
+        if (_name) _start = std::chrono::steady_clock::now();
+    }
+    ~ScopedStageTimer() {
+        if (!_name) return;
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - _start;
+        StageTimings::GetInst().Record(_name, elapsed.count());
+    }
+
+    ScopedStageTimer(const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+private:
+    const char* _name;
+    std::chrono::steady_clock::time_point _start{};
+};
+
+} // namespace ASCIIgL
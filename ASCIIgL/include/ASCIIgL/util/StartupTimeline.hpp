@@ -0,0 +1,71 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ASCIIgL {
+
+/// Wall-clock spans of named startup tasks, recorded from any thread. Complements the Tracy zones
+/// opened by PROFILE_STARTUP so a cold/warm start can be compared from the log alone: Begin() sets
+/// the origin, tasks record their [start, end) relative to it, FormatReport() prints a timeline.
+class StartupTimeline {
+public:
+    struct Span {
+        std::string name;
+        double startMs = 0.0;
+        double endMs = 0.0;
+        int thread = -1;          // TBB worker slot (0 = main/external thread)
+    };
+
+    static StartupTimeline& GetInst() {
+        static StartupTimeline instance;
+        return instance;
+    }
+
+    /// Clears previous spans and resets the origin to now.
+    void Begin();
+    /// Closes the timeline; total wall time is measured from Begin().
+    void End();
+
+    void Record(const char* name, std::chrono::steady_clock::time_point start,
+                std::chrono::steady_clock::time_point end);
+
+    std::vector<Span> GetSpans() const;
+    double GetTotalMs() const;
+
+    /// Spans sorted by start, with a proportional bar per task, plus the summed task time
+    /// versus wall time (> 1x means the overlap paid off).
+    std::string FormatReport() const;
+
+private:
+    StartupTimeline() = default;
+    StartupTimeline(const StartupTimeline&) = delete;
+    StartupTimeline& operator=(const StartupTimeline&) = delete;
+
+    mutable std::mutex _mutex;
+    std::chrono::steady_clock::time_point _origin = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point _end{};
+    bool _ended = false;
+    std::vector<Span> _spans;
+};
+
+/// Records the lifetime of the scope into StartupTimeline.
+class ScopedStartupTask {
+public:
+    explicit ScopedStartupTask(const char* name)
+        : _name(name), _start(std::chrono::steady_clock::now()) {}
+    ~ScopedStartupTask() {
+        StartupTimeline::GetInst().Record(_name, _start, std::chrono::steady_clock::now());
+    }
+
+    ScopedStartupTask(const ScopedStartupTask&) = delete;
+    ScopedStartupTask& operator=(const ScopedStartupTask&) = delete;
+
+private:
+    const char* _name;
+    std::chrono::steady_clock::time_point _start;
+};
+
+} // namespace ASCIIgL
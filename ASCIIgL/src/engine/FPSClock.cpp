@@ -8,11 +8,14 @@ void FPSClock::StartFPSClock() {
 
 void FPSClock::EndFPSClock() {
     _fpsClock.EndClock();
+    _frameWorkTime = _fpsClock.GetDeltaTime();
     FPSSampleCalculate(_fpsClock.GetDeltaTime());
     CapFPS();
 }
 
 void FPSClock::CapFPS() {
+    if (_fpsCap == 0) return;
+
     const float inverseFrameCap = (1.0f / _fpsCap);
 
     if (_fpsClock.GetDeltaTime() < inverseFrameCap) {
@@ -38,13 +41,27 @@ void FPSClock::FPSSampleCalculate(const double currentDeltaTime) {
 }
 
 float FPSClock::GetDeltaTime() {
+    if (_hasDeltaOverride) return _deltaOverride;
 	return _fpsClock.GetDeltaTime();
 }
 
+double FPSClock::GetFrameWorkTime() const {
+    return _frameWorkTime;
+}
+
+void FPSClock::SetDeltaTimeOverride(float dt) {
+    _hasDeltaOverride = true;
+    _deltaOverride = dt;
+}
+
+void FPSClock::ClearDeltaTimeOverride() {
+    _hasDeltaOverride = false;
+}
+
 void FPSClock::Initialize(unsigned int fpsCap, double fpsWindowSec) {
     _fpsCap = fpsCap;
     _fpsWindowSec = fpsWindowSec;
-    _fpsClock.SetDeltaTime(1.0f / static_cast<float>(fpsCap));
+    _fpsClock.SetDeltaTime(fpsCap > 0 ? 1.0f / static_cast<float>(fpsCap) : 0.0f);
 }
 
 void FPSClock::SetFPSCap(unsigned int fpsCap) {
@@ -0,0 +1,101 @@
+#include <ASCIIgL/engine/FrameBudgetController.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#include <ASCIIgL/util/Logger.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
+
+namespace ASCIIgL {
+
+FrameBudgetController::FrameBudgetController(Config config) {
+    SetConfig(std::move(config));
+}
+
+void FrameBudgetController::SetConfig(Config config) {
+    for (float& scale : config.tiers) {
+        scale = std::clamp(scale, 0.05f, 1.0f);
+    }
+    config.downshiftFrames = std::max(1, config.downshiftFrames);
+    config.upshiftFrames = std::max(1, config.upshiftFrames);
+    config.smoothing = std::clamp(config.smoothing, 0.01, 1.0);
+
+    _config = std::move(config);
+    _tier = 0;
+    _hasSample = false;
+    _overBudgetRun = 0;
+    _headroomRun = 0;
+}
+
+void FrameBudgetController::SetEnabled(bool enabled) {
+    _enabled = enabled;
+    _overBudgetRun = 0;
+    _headroomRun = 0;
+}
+
+float FrameBudgetController::GetRenderScale() const {
+    if (!_enabled || _config.tiers.empty()) return 1.0f;
+    return _config.tiers[_tier];
+}
+
+bool FrameBudgetController::Update(double frameWorkSec) {
+    if (!_enabled || _config.tiers.size() < 2) return false;
+
+    const double frameMs = frameWorkSec * 1000.0;
+    if (!_hasSample) {
+        _smoothedMs = frameMs;
+        _hasSample = true;
+    } else {
+        _smoothedMs += (frameMs - _smoothedMs) * _config.smoothing;
+    }
+    PROFILE_PLOT("FrameBudget.SmoothedMs", _smoothedMs);
+
+    // Runs are counted on raw frame times; the smoothed average must agree before acting so
+    // that an isolated spike inside an otherwise cheap run does not trigger a change.
+    if (frameMs > _config.budgetMs) {
+        ++_overBudgetRun;
+    } else {
+        _overBudgetRun = 0;
+    }
+    if (frameMs < _config.budgetMs * _config.upshiftHeadroom) {
+        ++_headroomRun;
+    } else {
+        _headroomRun = 0;
+    }
+
+    if (_overBudgetRun >= _config.downshiftFrames && _smoothedMs > _config.budgetMs &&
+        _tier + 1 < _config.tiers.size()) {
+        ChangeTier(_tier + 1, frameMs);
+        return true;
+    }
+    if (_headroomRun >= _config.upshiftFrames && _smoothedMs < _config.budgetMs * _config.upshiftHeadroom &&
+        _tier > 0) {
+        ChangeTier(_tier - 1, frameMs);
+        return true;
+    }
+    return false;
+}
+
+void FrameBudgetController::ChangeTier(size_t newTier, double lastMs) {
+    const size_t oldTier = _tier;
+    const int run = newTier > oldTier ? _overBudgetRun : _headroomRun;
+
+    char msg[256];
+    std::snprintf(msg, sizeof(msg),
+                  "[FrameBudget] tier %zu (scale %.2f) -> tier %zu (scale %.2f): avg %.2f ms, last %.2f ms, "
+                  "budget %.2f ms, %d consecutive %s frames",
+                  oldTier, _config.tiers[oldTier], newTier, _config.tiers[newTier],
+                  _smoothedMs, lastMs, _config.budgetMs, run,
+                  newTier > oldTier ? "over-budget" : "headroom");
+    Logger::Info(msg);
+
+    _tier = newTier;
+    ++_tierChanges;
+    _overBudgetRun = 0;
+    _headroomRun = 0;
+    // Restart the average from the budget edge so the new tier is judged on its own frames.
+    _smoothedMs = _config.budgetMs * (newTier > oldTier ? 1.0 : _config.upshiftHeadroom);
+}
+
+} // namespace ASCIIgL
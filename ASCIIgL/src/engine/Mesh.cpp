@@ -1,12 +1,66 @@
 #include <ASCIIgL/engine/Mesh.hpp>
 #include <ASCIIgL/renderer/Renderer.hpp>
+#include <ASCIIgL/util/Logger.hpp>
+
+#include <atomic>
 
 namespace ASCIIgL {
 
+namespace {
+// Meshes are built on the main thread but worker-side tools may create them too.
+std::atomic<size_t> g_cpuMeshBytes{0};
+} // namespace
+
+void Mesh::OnDataAssigned() {
+    vertexDataSize = vertexData.size();
+    indexCount = indices.size();
+    g_cpuMeshBytes.fetch_add(GetCpuBytes(), std::memory_order_relaxed);
+}
+
+void Mesh::DiscardCpuData() const {
+    g_cpuMeshBytes.fetch_sub(GetCpuBytes(), std::memory_order_relaxed);
+    std::vector<std::byte>().swap(vertexData);
+    std::vector<int>().swap(indices);
+}
+
+void Mesh::TakeCpuData(std::vector<std::byte>& outVertices, std::vector<int>& outIndices) const {
+    g_cpuMeshBytes.fetch_sub(GetCpuBytes(), std::memory_order_relaxed);
+    outVertices = std::move(vertexData);
+    outIndices = std::move(indices);
+    std::vector<std::byte>().swap(vertexData);
+    std::vector<int>().swap(indices);
+}
+
+bool Mesh::RebuildCpuData() const {
+    if (!rebuildCallback) {
+        return false;
+    }
+    std::vector<std::byte> vertices;
+    std::vector<int> rebuiltIndices;
+    if (!rebuildCallback(vertices, rebuiltIndices)) {
+        return false;
+    }
+    if (vertices.size() != vertexDataSize || rebuiltIndices.size() != indexCount) {
+        // Counts are part of the mesh's identity (draw ranges, stats); a different shape is a new mesh.
+        Logger::Warning("Mesh rebuild callback returned different vertex/index counts; ignoring it");
+        return false;
+    }
+    vertexData = std::move(vertices);
+    indices = std::move(rebuiltIndices);
+    g_cpuMeshBytes.fetch_add(GetCpuBytes(), std::memory_order_relaxed);
+    return true;
+}
+
+size_t Mesh::GetTotalCpuBytes() {
+    return g_cpuMeshBytes.load(std::memory_order_relaxed);
+}
+
 Mesh::~Mesh()
 {
-    // Cleanup GPU buffer cache if it exists
-    if (gpuBufferCache && Renderer::GetInst().IsInitialized()) {
+    g_cpuMeshBytes.fetch_sub(GetCpuBytes(), std::memory_order_relaxed);
+
+    // Cleanup GPU buffer cache if it exists (freed at once if the renderer was already shut down)
+    if (gpuBufferCache) {
         Renderer::GetInst().ReleaseMeshCache(gpuBufferCache);
         gpuBufferCache = nullptr;
     }
@@ -16,7 +70,7 @@ Mesh::~Mesh()
 }
 
 void Mesh::ReleaseGpuCache() {
-    if (gpuBufferCache && Renderer::GetInst().IsInitialized()) {
+    if (gpuBufferCache) {
         Renderer::GetInst().ReleaseMeshCache(gpuBufferCache);
         gpuBufferCache = nullptr;
     }
@@ -1,8 +1,17 @@
 #include <ASCIIgL/engine/MipFilters.hpp>
+#include <ASCIIgL/util/CpuFeatures.hpp>
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(__AVX2__)
+#include <immintrin.h>
+#define ASCIIGL_MIP_SSE2 1
+#endif
 
 namespace ASCIIgL {
 
@@ -18,9 +27,118 @@ static inline bool RGBAEqual(const uint8_t* a, const uint8_t* b) {
     return a[0] == b[0] && a[1] == b[1] && a[2] == b[2] && a[3] == b[3];
 }
 
+// Exact 2x2 average of one destination pixel whose source block lies fully inside the image.
+static inline void BoxFilterPixel(const uint8_t* row0, const uint8_t* row1, uint8_t* dst) {
+    for (int c = 0; c < 4; ++c) {
+        dst[c] = static_cast<uint8_t>((row0[c] + row0[4 + c] + row1[c] + row1[4 + c]) / 4);
+    }
+}
+
+#if defined(ASCIIGL_MIP_SSE2)
+// Rows are summed in 16-bit lanes, then adjacent pixels are paired by interleaving 64-bit halves,
+// so each output is (p00 + p10 + p01 + p11) >> 2 -- bit-identical to the scalar truncating divide.
+static void BoxFilterRowsSSE2(const uint8_t* srcData, int srcW, uint8_t* dstData, int dstW, int dstH) {
+    const __m128i zero = _mm_setzero_si128();
+    const auto pairSum = [&](const uint8_t* r0, const uint8_t* r1) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r0));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r1));
+        const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+        const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+        const __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+        return _mm_srli_epi16(sum, 2);
+    };
+
+    for (int y = 0; y < dstH; ++y) {
+        const uint8_t* row0 = srcData + static_cast<size_t>(y) * 2 * srcW * 4;
+        const uint8_t* row1 = row0 + static_cast<size_t>(srcW) * 4;
+        uint8_t* out = dstData + static_cast<size_t>(y) * dstW * 4;
+
+        int x = 0;
+        for (; x + 4 <= dstW; x += 4) {
+            const __m128i first = pairSum(row0 + x * 8, row1 + x * 8);
+            const __m128i second = pairSum(row0 + x * 8 + 16, row1 + x * 8 + 16);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x * 4), _mm_packus_epi16(first, second));
+        }
+        for (; x < dstW; ++x) {
+            BoxFilterPixel(row0 + x * 8, row1 + x * 8, out + x * 4);
+        }
+    }
+}
+#endif
+
+#if defined(__AVX2__)
+// Same pairing as the SSE2 path per 128-bit lane; the final permute undoes the lane interleave of packus.
+static void BoxFilterRowsAVX2(const uint8_t* srcData, int srcW, uint8_t* dstData, int dstW, int dstH) {
+    const __m256i zero = _mm256_setzero_si256();
+    const auto pairSum = [&](const uint8_t* r0, const uint8_t* r1) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(r0));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(r1));
+        const __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+        const __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+        const __m256i sum = _mm256_add_epi16(_mm256_unpacklo_epi64(lo, hi), _mm256_unpackhi_epi64(lo, hi));
+        return _mm256_srli_epi16(sum, 2);
+    };
+
+    for (int y = 0; y < dstH; ++y) {
+        const uint8_t* row0 = srcData + static_cast<size_t>(y) * 2 * srcW * 4;
+        const uint8_t* row1 = row0 + static_cast<size_t>(srcW) * 4;
+        uint8_t* out = dstData + static_cast<size_t>(y) * dstW * 4;
+
+        int x = 0;
+        for (; x + 8 <= dstW; x += 8) {
+            const __m256i first = pairSum(row0 + x * 8, row1 + x * 8);
+            const __m256i second = pairSum(row0 + x * 8 + 32, row1 + x * 8 + 32);
+            const __m256i packed = _mm256_packus_epi16(first, second);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + x * 4),
+                                _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+        for (; x < dstW; ++x) {
+            BoxFilterPixel(row0 + x * 8, row1 + x * 8, out + x * 4);
+        }
+    }
+}
+#endif
+
 void BoxFilter(
     const uint8_t* srcData, int srcW, int srcH,
     uint8_t* dstData, int dstW, int dstH)
+{
+    // The vector paths need every 2x2 block inside the source; odd or 1-texel levels stay scalar.
+    bool vectorized = false;
+    if (srcW == dstW * 2 && srcH == dstH * 2) {
+        switch (GetSimdLevel()) {
+#if defined(__AVX2__)
+            case SimdLevel::AVX2:
+                BoxFilterRowsAVX2(srcData, srcW, dstData, dstW, dstH);
+                vectorized = true;
+                break;
+#endif
+#if defined(ASCIIGL_MIP_SSE2)
+            case SimdLevel::SSE2:
+                BoxFilterRowsSSE2(srcData, srcW, dstData, dstW, dstH);
+                vectorized = true;
+                break;
+#endif
+            default:
+                break;
+        }
+    }
+    if (!vectorized) {
+        BoxFilterScalar(srcData, srcW, srcH, dstData, dstW, dstH);
+        return;
+    }
+#ifndef NDEBUG
+    // Debug builds check every vector call against the reference, which it must match bit for bit.
+    std::vector<uint8_t> reference(static_cast<size_t>(dstW) * dstH * 4);
+    BoxFilterScalar(srcData, srcW, srcH, reference.data(), dstW, dstH);
+    assert(std::memcmp(reference.data(), dstData, reference.size()) == 0 &&
+           "SIMD box filter diverged from the scalar reference");
+#endif
+}
+
+void BoxFilterScalar(
+    const uint8_t* srcData, int srcW, int srcH,
+    uint8_t* dstData, int dstW, int dstH)
 {
     for (int y = 0; y < dstH; ++y) {
         for (int x = 0; x < dstW; ++x) {
@@ -4,9 +4,13 @@
 #include <ASCIIgL/engine/MipFilters.hpp>
 #include <ASCIIgL/engine/MonochromeMapping.hpp>
 #include <ASCIIgL/util/Logger.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
 
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+
+#include <oneapi/tbb/parallel_for.h>
 
 #define STB_IMAGE_IMPLEMENTATION_ALREADY_DONE
 #include <stb_image/stb_image.h>
@@ -32,6 +36,22 @@ public:
     };
     
     std::vector<Layer> layers;
+
+    ResidencyPolicy residency;
+
+    // Where the pixels came from, so a released array can decode them again.
+    std::string sourceAtlasPath;
+    int sourceTileSize = 0;
+    std::vector<std::string> sourceTilePaths;
+    std::vector<MonochromeMapping> sourcePerTileMono;
+    bool mipsGenerated = false;
+    int mipMaxLevels = -1;
+    MipFilters::MipFilterFn mipFilter;
+
+    // Read by the frame/residency logs on other threads; the layer vectors themselves are not.
+    std::atomic<size_t> cpuBytes{0};
+    std::atomic<size_t> gpuBytes{0};
+    std::atomic<bool> cpuReleased{false};
     
     // Load from atlas image
     bool LoadFromAtlas(const std::string& atlasPath, int tileSize, const MonochromeMapping& mono,
@@ -43,6 +63,10 @@ public:
     
     // Generate mipmaps for all layers
     void GenerateMipmapsCPU(int maxLevels, MipFilters::MipFilterFn filter);
+
+    void ApplyResidency(const ResidencyPolicy& policy);
+    size_t ComputeGpuBytes() const;
+    void RecountCpuBytes();
 };
 
 namespace {
@@ -76,6 +100,9 @@ bool TextureArray::Impl::LoadFromAtlas(const std::string& atlasPath, int inTileS
     
     tileSize = inTileSize;
     monoMapping = mono;
+    sourceAtlasPath = atlasPath;
+    sourceTileSize = inTileSize;
+    sourcePerTileMono = perTileMono;
     const int tilesX = atlasW / tileSize;
     const int tilesY = atlasH / tileSize;
     layerCount = tilesX * tilesY;
@@ -86,10 +113,12 @@ bool TextureArray::Impl::LoadFromAtlas(const std::string& atlasPath, int inTileS
     
     layers.resize(layerCount);
     
-    // Extract each tile as a layer
-    for (int ty = 0; ty < tilesY; ++ty) {
-        for (int tx = 0; tx < tilesX; ++tx) {
-            int layerIdx = ty * tilesX + tx;
+    // Extract each tile as a layer (tiles are independent; mono mapping dominates the cost).
+    {
+        PROFILE_SCOPE("TextureArray::ExtractTiles");
+        oneapi::tbb::parallel_for(0, layerCount, [&](int layerIdx) {
+            const int ty = layerIdx / tilesX;
+            const int tx = layerIdx % tilesX;
             Layer& layer = layers[layerIdx];
 
             // Create base mip level
@@ -98,7 +127,7 @@ bool TextureArray::Impl::LoadFromAtlas(const std::string& atlasPath, int inTileS
             mip0.width = tileSize;
             mip0.height = tileSize;
             mip0.data.resize(tileSize * tileSize * 4);
-            
+
             // Copy tile data
             for (int y = 0; y < tileSize; ++y) {
                 const int srcY = ty * tileSize + y;
@@ -112,7 +141,7 @@ bool TextureArray::Impl::LoadFromAtlas(const std::string& atlasPath, int inTileS
             if (tileMono.enabled) {
                 ApplyMonochromeMappingRGBA8(mip0.data.data(), tileSize, tileSize, tileMono);
             }
-        }
+        });
     }
     
     stbi_image_free(atlasData);
@@ -135,15 +164,57 @@ bool TextureArray::Impl::LoadFromFiles(const std::vector<std::string>& tilePaths
     
     layerCount = static_cast<int>(tilePaths.size());
     monoMapping = mono;
+    sourceTilePaths = tilePaths;
+    sourcePerTileMono = perTileMono;
     layers.resize(layerCount);
     tileSize = 0;
     
+    // Decode + mono-map every tile in parallel into its own layer, then validate sizes in order so
+    // errors name the same tile as a sequential load would. stb_image is reentrant apart from the
+    // flip flag (set above) and its failure-reason string, which we do not read.
+    struct TileInfo {
+        int width = 0;
+        int height = 0;
+        bool loaded = false;
+    };
+    std::vector<TileInfo> tileInfo(static_cast<size_t>(layerCount));
+
+    {
+        PROFILE_SCOPE("TextureArray::DecodeTiles");
+        oneapi::tbb::parallel_for(0, layerCount, [&](int i) {
+            int w, h, bpp;
+            stbi_uc* data = stbi_load(tilePaths[i].c_str(), &w, &h, &bpp, 4);
+            if (!data) return;
+
+            TileInfo& info = tileInfo[static_cast<size_t>(i)];
+            info.width = w;
+            info.height = h;
+            info.loaded = true;
+
+            Layer& layer = layers[i];
+            layer.mipChain.resize(1);
+            Layer::MipLevel& mip0 = layer.mipChain[0];
+            mip0.width = w;
+            mip0.height = h;
+            mip0.data.resize(static_cast<size_t>(w) * h * 4);
+            std::memcpy(mip0.data.data(), data, mip0.data.size());
+            stbi_image_free(data);
+
+            const MonochromeMapping& tileMono = ResolveTileMonochrome(i, mono, perTileMono);
+            if (tileMono.enabled) {
+                ApplyMonochromeMappingRGBA8(mip0.data.data(), w, h, tileMono);
+            }
+        });
+    }
+
     for (int i = 0; i < layerCount; ++i) {
-        int w, h, bpp;
-        stbi_uc* data = stbi_load(tilePaths[i].c_str(), &w, &h, &bpp, 4);
-        
-        if (!data) {
+        const TileInfo& info = tileInfo[static_cast<size_t>(i)];
+        const int w = info.width;
+        const int h = info.height;
+
+        if (!info.loaded) {
             Logger::Error("TEXTURE_ARRAY: Failed to load tile: " + tilePaths[i]);
+            layers.clear();
             return false;
         }
         
@@ -152,31 +223,16 @@ bool TextureArray::Impl::LoadFromFiles(const std::vector<std::string>& tilePaths
             if (w != h) {
                 Logger::Error("TEXTURE_ARRAY: Tile must be square: " + tilePaths[i] +
                               " (" + std::to_string(w) + "x" + std::to_string(h) + ")");
-                stbi_image_free(data);
+                layers.clear();
                 return false;
             }
         } else if (w != tileSize || h != tileSize) {
             Logger::Error("TEXTURE_ARRAY: All tiles must be same size. Mismatch in " + tilePaths[i] +
                           ": expected " + std::to_string(tileSize) + "x" + std::to_string(tileSize) +
                           ", got " + std::to_string(w) + "x" + std::to_string(h));
-            stbi_image_free(data);
+            layers.clear();
             return false;
         }
-        
-        Layer& layer = layers[i];
-        layer.mipChain.resize(1);
-        Layer::MipLevel& mip0 = layer.mipChain[0];
-        mip0.width = tileSize;
-        mip0.height = tileSize;
-        mip0.data.resize(tileSize * tileSize * 4);
-        std::memcpy(mip0.data.data(), data, tileSize * tileSize * 4);
-
-        const MonochromeMapping& tileMono = ResolveTileMonochrome(i, mono, perTileMono);
-        if (tileMono.enabled) {
-            ApplyMonochromeMappingRGBA8(mip0.data.data(), tileSize, tileSize, tileMono);
-        }
-        
-        stbi_image_free(data);
     }
     
     valid = true;
@@ -192,8 +248,10 @@ void TextureArray::Impl::GenerateMipmapsCPU(int maxLevels, MipFilters::MipFilter
     Logger::Debug("TEXTURE_ARRAY: Generating " + std::to_string(targetLevels) + " mip levels for " +
                   std::to_string(layerCount) + " layers");
     
-    for (Layer& layer : layers) {
-        if (layer.mipChain.empty()) continue;
+    PROFILE_SCOPE("TextureArray::GenerateMipmapsCPU");
+    oneapi::tbb::parallel_for(size_t(0), layers.size(), [&](size_t layerIdx) {
+        Layer& layer = layers[layerIdx];
+        if (layer.mipChain.empty()) return;
 
         const int baseW = layer.mipChain[0].width;
         const int baseH = layer.mipChain[0].height;
@@ -210,12 +268,105 @@ void TextureArray::Impl::GenerateMipmapsCPU(int maxLevels, MipFilters::MipFilter
             newMip.data = std::move(lvl.data);
             layer.mipChain.push_back(std::move(newMip));
         }
-    }
+    });
     
     hasCustomMipmaps = (targetLevels > 1);
+    mipsGenerated = true;
+    mipMaxLevels = maxLevels;
+    mipFilter = filter;
+    RecountCpuBytes();
     Logger::Debug("TEXTURE_ARRAY: Mipmap generation complete");
 }
 
+namespace {
+
+// Bytes of one layer's chain from a square base of \p size down to 1x1 (what GENERATE_MIPS allocates).
+size_t FullChainBytes(int size) {
+    size_t bytes = 0;
+    for (;;) {
+        bytes += static_cast<size_t>(size) * static_cast<size_t>(size) * 4;
+        if (size <= 1) break;
+        size = std::max(1, size / 2);
+    }
+    return bytes;
+}
+
+} // namespace
+
+void TextureArray::Impl::ApplyResidency(const ResidencyPolicy& policy) {
+    residency = policy;
+    if (!valid || layers.empty() || tileSize <= 0) return;
+
+    int target = tileSize;
+    if (policy.maxTileSize > 0) {
+        while (target > policy.maxTileSize && target > 1) target = std::max(1, target / 2);
+    }
+    if (policy.budgetBytes > 0) {
+        while (target > 1 && FullChainBytes(target) * static_cast<size_t>(layerCount) > policy.budgetBytes) {
+            target = std::max(1, target / 2);
+        }
+    }
+    if (target == tileSize) {
+        RecountCpuBytes();
+        return;
+    }
+
+    int dropLevels = 0;
+    for (int size = tileSize; size > target; size = std::max(1, size / 2)) ++dropLevels;
+
+    PROFILE_SCOPE("TextureArray::ApplyResidency");
+    oneapi::tbb::parallel_for(size_t(0), layers.size(), [&](size_t layerIdx) {
+        Layer& layer = layers[layerIdx];
+        if (layer.mipChain.empty()) return;
+
+        if (static_cast<int>(layer.mipChain.size()) > dropLevels) {
+            // The chain already holds the target level: discard the finer ones.
+            layer.mipChain.erase(layer.mipChain.begin(), layer.mipChain.begin() + dropLevels);
+            return;
+        }
+
+        // Only the base level exists (GPU-generated mips): box-filter it down to the target.
+        Layer::MipLevel& base = layer.mipChain[0];
+        auto built = MipChain::BuildRGBA8(std::move(base.data), base.width, base.height,
+                                          dropLevels + 1, MipFilters::BoxFilter);
+        Layer::MipLevel resident;
+        resident.width = built.back().width;
+        resident.height = built.back().height;
+        resident.data = std::move(built.back().data);
+        layer.mipChain.clear();
+        layer.mipChain.push_back(std::move(resident));
+    });
+
+    Logger::Info("TEXTURE_ARRAY: Residency clamps " + std::to_string(layerCount) + " layers from " +
+                 std::to_string(tileSize) + "px to " + std::to_string(target) + "px");
+    tileSize = target;
+    if (layers[0].mipChain.size() <= 1) {
+        hasCustomMipmaps = false;
+    }
+    RecountCpuBytes();
+}
+
+size_t TextureArray::Impl::ComputeGpuBytes() const {
+    if (!valid || layers.empty()) return 0;
+    if (!hasCustomMipmaps) return FullChainBytes(tileSize) * static_cast<size_t>(layerCount);
+
+    size_t bytes = 0;
+    for (const Layer::MipLevel& mip : layers[0].mipChain) {
+        bytes += static_cast<size_t>(mip.width) * static_cast<size_t>(mip.height) * 4;
+    }
+    return bytes * static_cast<size_t>(layerCount);
+}
+
+void TextureArray::Impl::RecountCpuBytes() {
+    size_t bytes = 0;
+    for (const Layer& layer : layers) {
+        for (const Layer::MipLevel& mip : layer.mipChain) {
+            bytes += mip.data.size();
+        }
+    }
+    cpuBytes.store(bytes, std::memory_order_relaxed);
+}
+
 // TextureArray public interface
 
 TextureArray::TextureArray(const std::string& atlasPath, int tileSize, const MonochromeMapping& mono,
@@ -223,6 +374,7 @@ TextureArray::TextureArray(const std::string& atlasPath, int tileSize, const Mon
     : pImpl(std::make_unique<Impl>())
 {
     pImpl->LoadFromAtlas(atlasPath, tileSize, mono, perTileMono);
+    pImpl->RecountCpuBytes();
 }
 
 TextureArray::TextureArray(const std::vector<std::string>& tilePaths, const MonochromeMapping& mono,
@@ -230,6 +382,7 @@ TextureArray::TextureArray(const std::vector<std::string>& tilePaths, const Mono
     : pImpl(std::make_unique<Impl>())
 {
     pImpl->LoadFromFiles(tilePaths, mono, perTileMono);
+    pImpl->RecountCpuBytes();
 }
 
 TextureArray::~TextureArray() = default;
@@ -263,6 +416,7 @@ const uint8_t* TextureArray::GetLayerData(int layer, int mipLevel) const {
     if (layer < 0 || layer >= pImpl->layerCount) return nullptr;
     const auto& chain = pImpl->layers[layer].mipChain;
     if (mipLevel < 0 || mipLevel >= static_cast<int>(chain.size())) return nullptr;
+    if (chain[mipLevel].data.empty()) return nullptr;
     return chain[mipLevel].data.data();
 }
 
@@ -270,6 +424,85 @@ void TextureArray::GenerateMipmapsCPU(int maxLevels, MipFilters::MipFilterFn fil
     pImpl->GenerateMipmapsCPU(maxLevels, filter);
 }
 
+void TextureArray::ApplyResidency(const ResidencyPolicy& policy) {
+    pImpl->ApplyResidency(policy);
+}
+
+const TextureArray::ResidencyPolicy& TextureArray::GetResidencyPolicy() const {
+    return pImpl->residency;
+}
+
+void TextureArray::SetGpuResident(bool resident) {
+    pImpl->gpuBytes.store(resident ? pImpl->ComputeGpuBytes() : 0, std::memory_order_relaxed);
+}
+
+bool TextureArray::ReleaseCpuData() {
+    if (!pImpl->valid || pImpl->cpuReleased.load(std::memory_order_acquire)) return false;
+    if (!CanReloadCpuData()) return false;
+
+    // Publish the release first: an upload that has not started yet sees it and bails out.
+    pImpl->cpuReleased.store(true, std::memory_order_release);
+    const size_t freed = pImpl->cpuBytes.load(std::memory_order_relaxed);
+    for (Impl::Layer& layer : pImpl->layers) {
+        for (Impl::Layer::MipLevel& mip : layer.mipChain) {
+            std::vector<uint8_t>().swap(mip.data);
+        }
+    }
+    pImpl->cpuBytes.store(0, std::memory_order_relaxed);
+    Logger::Debug("TEXTURE_ARRAY: Released " + std::to_string(freed / 1024) + " KiB of CPU pixels after upload");
+    return true;
+}
+
+bool TextureArray::ReloadCpuData() {
+    if (!pImpl->valid || !pImpl->cpuReleased.load(std::memory_order_acquire)) return false;
+    if (!CanReloadCpuData()) return false;
+
+    PROFILE_SCOPE("TextureArray::ReloadCpuData");
+    Impl fresh;
+    const bool loaded = pImpl->sourceTilePaths.empty()
+        ? fresh.LoadFromAtlas(pImpl->sourceAtlasPath, pImpl->sourceTileSize, pImpl->monoMapping, pImpl->sourcePerTileMono)
+        : fresh.LoadFromFiles(pImpl->sourceTilePaths, pImpl->monoMapping, pImpl->sourcePerTileMono);
+    if (!loaded) return false;
+    if (pImpl->mipsGenerated) fresh.GenerateMipmapsCPU(pImpl->mipMaxLevels, pImpl->mipFilter);
+    fresh.ApplyResidency(pImpl->residency);
+
+    // The files changed on disk since the first load; the GPU layout would no longer match.
+    if (fresh.layerCount != pImpl->layerCount || fresh.tileSize != pImpl->tileSize ||
+        fresh.layers[0].mipChain.size() != pImpl->layers[0].mipChain.size()) {
+        Logger::Error("TEXTURE_ARRAY: Reload no longer matches the resident layout");
+        return false;
+    }
+
+    for (size_t layerIdx = 0; layerIdx < pImpl->layers.size(); ++layerIdx) {
+        auto& chain = pImpl->layers[layerIdx].mipChain;
+        auto& freshChain = fresh.layers[layerIdx].mipChain;
+        for (size_t level = 0; level < chain.size(); ++level) {
+            chain[level].data = std::move(freshChain[level].data);
+        }
+    }
+    pImpl->RecountCpuBytes();
+    pImpl->cpuReleased.store(false, std::memory_order_release);
+    Logger::Debug("TEXTURE_ARRAY: Reloaded " + std::to_string(pImpl->cpuBytes.load(std::memory_order_relaxed) / 1024) +
+                  " KiB of CPU pixels");
+    return true;
+}
+
+bool TextureArray::CanReloadCpuData() const {
+    return !pImpl->sourceAtlasPath.empty() || !pImpl->sourceTilePaths.empty();
+}
+
+bool TextureArray::HasCpuData() const {
+    return pImpl->valid && !pImpl->cpuReleased.load(std::memory_order_acquire);
+}
+
+size_t TextureArray::GetCpuBytes() const {
+    return pImpl->cpuBytes.load(std::memory_order_relaxed);
+}
+
+size_t TextureArray::GetGpuBytes() const {
+    return pImpl->gpuBytes.load(std::memory_order_relaxed);
+}
+
 int TextureArray::GetLayerFromAtlasXY(int x, int y, int atlasSize) {
     return (y * atlasSize) + x;
 }
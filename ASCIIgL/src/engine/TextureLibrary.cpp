@@ -1,7 +1,10 @@
 #include <ASCIIgL/engine/TextureLibrary.hpp>
 
+#include <ASCIIgL/renderer/Renderer.hpp>
 #include <ASCIIgL/util/Logger.hpp>
 
+#include <algorithm>
+
 namespace ASCIIgL {
 
 std::shared_ptr<TextureArray> TextureLibrary::LoadTextureArray(
@@ -11,18 +14,25 @@ std::shared_ptr<TextureArray> TextureLibrary::LoadTextureArray(
     // Already loaded?
     std::string nameToSave = savedName.empty() ? path : savedName;
 
-    auto it = _textureArrays.find(nameToSave);
-    if (it != _textureArrays.end())
-        return it->second;
+    TextureArray::ResidencyPolicy residency;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _textureArrays.find(nameToSave);
+        if (it != _textureArrays.end())
+            return it->second;
+        residency = _arrayResidency;
+    }
 
     auto texArray = std::make_shared<TextureArray>(path, tileSize, mono, perTileMono);
     if (!texArray || !texArray->IsValid()) {
         Logger::Error("[TextureLibrary] Failed to load TextureArray: " + path);
         return nullptr;
     }
+    texArray->ApplyResidency(residency);
 
-    _textureArrays[nameToSave] = texArray;
-    return texArray;
+    std::lock_guard<std::mutex> lock(_mutex);
+    // A concurrent load of the same name may have won; keep the first so callers share one array.
+    return _textureArrays.emplace(nameToSave, texArray).first->second;
 }
 
 // Load from individual tile image files.
@@ -33,10 +43,15 @@ std::shared_ptr<TextureArray> TextureLibrary::LoadTextureArray(
     // Already loaded?
     std::string nameToSave = savedName.empty() ? (tilePaths.empty() ? std::string() : tilePaths.front()) : savedName;
 
-    if (!nameToSave.empty()) {
-        auto it = _textureArrays.find(nameToSave);
-        if (it != _textureArrays.end())
-            return it->second;
+    TextureArray::ResidencyPolicy residency;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!nameToSave.empty()) {
+            auto it = _textureArrays.find(nameToSave);
+            if (it != _textureArrays.end())
+                return it->second;
+        }
+        residency = _arrayResidency;
     }
 
     auto texArray = std::make_shared<TextureArray>(tilePaths, mono, perTileMono);
@@ -44,9 +59,11 @@ std::shared_ptr<TextureArray> TextureLibrary::LoadTextureArray(
         Logger::Error("[TextureLibrary] Failed to load TextureArray from file list (count=" + std::to_string(tilePaths.size()) + ")");
         return nullptr;
     }
+    texArray->ApplyResidency(residency);
 
     if (!nameToSave.empty()) {
-        _textureArrays[nameToSave] = texArray;
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _textureArrays.emplace(nameToSave, texArray).first->second;
     }
     return texArray;
 }
@@ -56,9 +73,9 @@ std::shared_ptr<Texture> TextureLibrary::LoadTexture(const std::string& path, co
     // If already loaded under this name, drop the old entry so we can reload.
     std::string nameToSave = savedName.empty() ? path : savedName;
 
-    auto it = _textures.find(nameToSave);
-    if (it != _textures.end()) {
-        _textures.erase(it);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _textures.erase(nameToSave);
     }
 
     auto tex = std::make_shared<Texture>(path, "NULL", mono);
@@ -67,29 +84,34 @@ std::shared_ptr<Texture> TextureLibrary::LoadTexture(const std::string& path, co
         return nullptr;
     }
 
+    std::lock_guard<std::mutex> lock(_mutex);
     _textures[nameToSave] = tex;
     return tex;
 }
 
 std::shared_ptr<TextureArray> TextureLibrary::GetTextureArray(const std::string& savedName) const
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     auto it = _textureArrays.find(savedName);
     return (it != _textureArrays.end()) ? it->second : nullptr;
 }
 
 std::shared_ptr<Texture> TextureLibrary::GetTexture(const std::string& savedName) const
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     auto it = _textures.find(savedName);
     return (it != _textures.end()) ? it->second : nullptr;
 }
 
 bool TextureLibrary::HasTextureArray(const std::string& savedName) const
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     return _textureArrays.find(savedName) != _textureArrays.end();
 }
 
 bool TextureLibrary::HasTexture(const std::string& savedName) const
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     return _textures.find(savedName) != _textures.end();
 }
 
@@ -101,23 +123,79 @@ const std::unordered_map<std::string, std::shared_ptr<Texture>>& TextureLibrary:
     return _textures;
 }
 
+void TextureLibrary::SetTextureArrayResidency(const TextureArray::ResidencyPolicy& policy)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _arrayResidency = policy;
+}
+
+std::vector<TextureLibrary::TextureArrayResidency> TextureLibrary::GetTextureArrayResidency() const
+{
+    std::vector<TextureArrayResidency> report;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        report.reserve(_textureArrays.size());
+        for (const auto& [name, texArray] : _textureArrays) {
+            if (!texArray) continue;
+            TextureArrayResidency entry;
+            entry.name = name;
+            entry.tileSize = texArray->GetTileSize();
+            entry.layerCount = texArray->GetLayerCount();
+            entry.cpuBytes = texArray->GetCpuBytes();
+            entry.gpuBytes = texArray->GetGpuBytes();
+            report.push_back(std::move(entry));
+        }
+    }
+    std::sort(report.begin(), report.end(),
+              [](const TextureArrayResidency& a, const TextureArrayResidency& b) { return a.name < b.name; });
+    return report;
+}
+
+void TextureLibrary::UpdateResidency()
+{
+    std::vector<std::shared_ptr<TextureArray>> arrays;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        arrays.reserve(_textureArrays.size());
+        for (const auto& [name, texArray] : _textureArrays) {
+            if (texArray) arrays.push_back(texArray);
+        }
+    }
+
+    for (const auto& texArray : arrays) {
+        const bool onGpu = Renderer::GetInst().HasTextureArraySRV(texArray.get());
+        texArray->SetGpuResident(onGpu);
+        if (onGpu) {
+            if (texArray->GetResidencyPolicy().releaseCpuAfterUpload && texArray->HasCpuData()) {
+                texArray->ReleaseCpuData();
+            }
+        } else if (!texArray->HasCpuData() && !texArray->ReloadCpuData()) {
+            Logger::Error("[TextureLibrary] Failed to reload released TextureArray pixels");
+        }
+    }
+}
+
 void TextureLibrary::RemoveTextureArray(const std::string& savedName)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     _textureArrays.erase(savedName);
 }
 
 void TextureLibrary::RemoveTexture(const std::string& savedName)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     _textures.erase(savedName);
 }
 
 void TextureLibrary::ClearTextureArrays()
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     _textureArrays.clear();
 }
 
 void TextureLibrary::ClearTextures()
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     _textures.clear();
 }
 
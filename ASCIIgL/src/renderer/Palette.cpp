@@ -7,13 +7,223 @@
 #include <limits>
 #include <vector>
 
+#include <random>
+
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/parallel_reduce.h>
+
 #include <ASCIIgL/util/Logger.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
 #include <ASCIIgL/renderer/PaletteUtil.hpp>
 #include <ASCIIgL/engine/Texture.hpp>
 #include <ASCIIgL/engine/TextureArray.hpp>
 
 namespace ASCIIgL {
 
+namespace {
+
+constexpr int kClusters = static_cast<int>(Palette::COLOR_COUNT);
+// Fixed grain so parallel_deterministic_reduce splits (and sums floats) the same way every run.
+constexpr size_t kClusterGrain = 1024;
+
+using Centers = std::array<glm::vec3, kClusters>;
+
+glm::vec3 ToOklab(const glm::ivec3& rgb) {
+    return PaletteUtil::Linear1ToOklab(PaletteUtil::sRGB255ToLinear1(rgb));
+}
+
+// Uniform in [0, 1) from the standard-specified mt19937_64 sequence, so seeded runs match across
+// standard libraries (unlike std::uniform_*_distribution).
+double NextUnit(std::mt19937_64& rng) {
+    return static_cast<double>(rng() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+int NearestCenter(const glm::vec3& sample, const Centers& centers, int count) {
+    float bestDist = std::numeric_limits<float>::max();
+    int bestK = 0;
+    for (int k = 0; k < count; ++k) {
+        const glm::vec3 d = sample - centers[k];
+        const float dist = glm::dot(d, d);
+        if (dist < bestDist) {
+            bestDist = dist;
+            bestK = k;
+        }
+    }
+    return bestK;
+}
+
+float MaxShift(const Centers& a, const Centers& b) {
+    float shift = 0.0f;
+    for (int k = 0; k < kClusters; ++k) {
+        const glm::vec3 d = a[k] - b[k];
+        shift = std::max(shift, glm::dot(d, d));
+    }
+    return shift;
+}
+
+// Algorithm R over every candidate pixel: keeps a uniform subset of at most `capacity` samples and
+// only pays the Oklab conversion for pixels that land in it.
+class SampleReservoir {
+public:
+    SampleReservoir(size_t capacity, std::mt19937_64& rng) : _capacity(capacity), _rng(rng) {
+        _samples.reserve(capacity > 0 ? std::min<size_t>(capacity, size_t(1) << 16) : 4096);
+    }
+
+    void Offer(const glm::ivec3& rgb) {
+        ++_seen;
+        if (_capacity == 0 || _samples.size() < _capacity) {
+            _samples.push_back(ToOklab(rgb));
+            return;
+        }
+        const uint64_t slot = _rng() % _seen;
+        if (slot < _capacity) {
+            _samples[static_cast<size_t>(slot)] = ToOklab(rgb);
+        }
+    }
+
+    const std::vector<glm::vec3>& Samples() const { return _samples; }
+    uint64_t Seen() const { return _seen; }
+
+private:
+    size_t _capacity;
+    std::mt19937_64& _rng;
+    std::vector<glm::vec3> _samples;
+    uint64_t _seen = 0;
+};
+
+// k-means++: each new center is drawn with probability proportional to its squared distance from
+// the nearest center chosen so far. Converges in far fewer Lloyd steps than evenly spaced picks.
+Centers SeedKMeansPlusPlus(const std::vector<glm::vec3>& samples, int count, std::mt19937_64& rng) {
+    Centers centers{};
+    const size_t n = samples.size();
+    centers[0] = samples[static_cast<size_t>(rng() % n)];
+
+    std::vector<float> dist2(n);
+    const auto updateDistances = [&](int k) {
+        oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<size_t>(0, n, kClusterGrain),
+            [&](const oneapi::tbb::blocked_range<size_t>& r) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    const glm::vec3 d = samples[i] - centers[k];
+                    dist2[i] = (k == 0) ? glm::dot(d, d) : std::min(dist2[i], glm::dot(d, d));
+                }
+            });
+    };
+    updateDistances(0);
+
+    for (int k = 1; k < count; ++k) {
+        double total = 0.0;
+        for (float d : dist2) total += d;
+
+        size_t pick = static_cast<size_t>(rng() % n);
+        if (total > 0.0) {
+            double target = NextUnit(rng) * total;
+            for (size_t i = 0; i < n; ++i) {
+                target -= dist2[i];
+                if (target <= 0.0) {
+                    pick = i;
+                    break;
+                }
+            }
+        }
+        centers[k] = samples[pick];
+        updateDistances(k);
+    }
+    return centers;
+}
+
+struct ClusterSums {
+    std::array<glm::vec3, kClusters> sum;
+    std::array<int, kClusters> count{};
+    size_t changed = 0;
+
+    ClusterSums() { sum.fill(glm::vec3(0.0f)); }
+};
+
+// Full-batch Lloyd: the assignment step is a TBB reduction of per-cluster sums. Returns iterations run.
+int RunLloyd(const std::vector<glm::vec3>& samples, Centers& centers, int count,
+             const PaletteBuildOptions& options, bool& converged)
+{
+    std::vector<int> assignment(samples.size(), -1);
+    for (int iter = 0; iter < options.maxIterations; ++iter) {
+        const ClusterSums sums = oneapi::tbb::parallel_deterministic_reduce(
+            oneapi::tbb::blocked_range<size_t>(0, samples.size(), kClusterGrain),
+            ClusterSums{},
+            [&](const oneapi::tbb::blocked_range<size_t>& r, ClusterSums acc) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    const int k = NearestCenter(samples[i], centers, count);
+                    if (assignment[i] != k) {
+                        assignment[i] = k;
+                        ++acc.changed;
+                    }
+                    acc.sum[k] += samples[i];
+                    ++acc.count[k];
+                }
+                return acc;
+            },
+            [](ClusterSums a, const ClusterSums& b) {
+                for (int k = 0; k < kClusters; ++k) {
+                    a.sum[k] += b.sum[k];
+                    a.count[k] += b.count[k];
+                }
+                a.changed += b.changed;
+                return a;
+            });
+
+        const Centers previous = centers;
+        for (int k = 0; k < count; ++k) {
+            if (sums.count[k] > 0) {
+                centers[k] = sums.sum[k] / static_cast<float>(sums.count[k]);
+            }
+        }
+
+        if (sums.changed == 0 || MaxShift(previous, centers) <= options.convergenceShift) {
+            converged = true;
+            return iter + 1;
+        }
+    }
+    return options.maxIterations;
+}
+
+// Mini-batch k-means (Sculley 2010): each step assigns a random batch in parallel, then moves every
+// hit center toward its samples with a per-center 1/n learning rate. Cost per step is independent of
+// the sample count, which keeps warm-started re-clustering at runtime cheap.
+int RunMiniBatch(const std::vector<glm::vec3>& samples, Centers& centers, int count,
+                 const PaletteBuildOptions& options, std::mt19937_64& rng, bool& converged)
+{
+    const size_t batchSize = std::min(options.miniBatchSize, samples.size());
+    std::vector<size_t> batch(batchSize);
+    std::vector<int> batchAssignment(batchSize);
+    std::array<float, kClusters> hits{};
+
+    for (int iter = 0; iter < options.maxIterations; ++iter) {
+        for (size_t& idx : batch) {
+            idx = static_cast<size_t>(rng() % samples.size());
+        }
+        oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<size_t>(0, batchSize, 256),
+            [&](const oneapi::tbb::blocked_range<size_t>& r) {
+                for (size_t j = r.begin(); j != r.end(); ++j) {
+                    batchAssignment[j] = NearestCenter(samples[batch[j]], centers, count);
+                }
+            });
+
+        const Centers previous = centers;
+        for (size_t j = 0; j < batchSize; ++j) {
+            const int k = batchAssignment[j];
+            hits[k] += 1.0f;
+            centers[k] += (samples[batch[j]] - centers[k]) * (1.0f / hits[k]);
+        }
+
+        if (MaxShift(previous, centers) <= options.convergenceShift) {
+            converged = true;
+            return iter + 1;
+        }
+    }
+    return options.maxIterations;
+}
+
+} // namespace
+
 PaletteEntry::PaletteEntry(const glm::ivec3& rgbVal)
     : rgb(rgbVal)
     , rgb16(rgbVal.r / 17, rgbVal.g / 17, rgbVal.b / 17)
@@ -61,11 +271,15 @@ Palette::Palette() {
 Palette::Palette(
     const std::vector<std::pair<float, std::shared_ptr<Texture>>>& textures,
     const std::vector<WeightedTextureArray>& textureArrays,
-    bool sortByLuminance)
+    bool sortByLuminance,
+    const PaletteBuildOptions& options)
 {
-    // Collect Oklab samples from given textures/arrays, using the float as a weight.
-    std::vector<glm::vec3> samples;
-    samples.reserve(4096);
+    PROFILE_SCOPE("Palette::Build");
+    std::mt19937_64 rng(options.deterministic ? options.seed : std::random_device{}());
+
+    // Collect Oklab samples from given textures/arrays, using the float as a weight. The strides
+    // bound each resource; the reservoir bounds the total so large packs do not grow the clustering.
+    SampleReservoir reservoir(options.maxSamples, rng);
 
     constexpr int BASE_SAMPLES_PER_RESOURCE = 256;
     constexpr uint8_t ALPHA_THRESHOLD = 16;
@@ -92,8 +306,7 @@ Palette::Palette(
                 const uint8_t* px = data + (static_cast<size_t>(y) * w + x) * 4;
                 uint8_t a = px[3];
                 if (a < ALPHA_THRESHOLD) continue;
-                glm::ivec3 rgb(px[0], px[1], px[2]);
-                samples.push_back(PaletteUtil::Linear1ToOklab(PaletteUtil::sRGB255ToLinear1(rgb)));
+                reservoir.Offer(glm::ivec3(px[0], px[1], px[2]));
             }
         }
     };
@@ -133,8 +346,7 @@ Palette::Palette(
                     const uint8_t* px = data + (static_cast<size_t>(y) * tileSize + x) * 4;
                     uint8_t a = px[3];
                     if (a < ALPHA_THRESHOLD) continue;
-                    glm::ivec3 rgb(px[0], px[1], px[2]);
-                    samples.push_back(PaletteUtil::Linear1ToOklab(PaletteUtil::sRGB255ToLinear1(rgb)));
+                    reservoir.Offer(glm::ivec3(px[0], px[1], px[2]));
                 }
             }
         }
@@ -147,64 +359,35 @@ Palette::Palette(
         sampleTextureArray(entry);
     }
 
-    constexpr int K = 16;
+    const std::vector<glm::vec3>& samples = reservoir.Samples();
+    constexpr int K = kClusters;
     if (!samples.empty()) {
         const int K_eff = std::min<int>(K, static_cast<int>(samples.size()));
 
-        std::array<glm::vec3, K> centers{};
-        for (int k = 0; k < K_eff; ++k) {
-            size_t idx = static_cast<size_t>((static_cast<long long>(k) * samples.size()) / K_eff);
-            if (idx >= samples.size()) idx = samples.size() - 1;
-            centers[k] = samples[idx];
-        }
-        for (int k = K_eff; k < K; ++k) {
-            centers[k] = centers[K_eff - 1];
-        }
-
-        std::vector<int> assignment(samples.size(), 0);
-        const int MAX_ITERS = 10;
-
-        for (int iter = 0; iter < MAX_ITERS; ++iter) {
-            bool changed = false;
-
-            for (size_t i = 0; i < samples.size(); ++i) {
-                float bestDist = std::numeric_limits<float>::max();
-                int bestK = 0;
-                for (int k = 0; k < K; ++k) {
-                    glm::vec3 d = samples[i] - centers[k];
-                    float dist = glm::dot(d, d);
-                    if (dist < bestDist) {
-                        bestDist = dist;
-                        bestK = k;
-                    }
-                }
-                if (assignment[i] != bestK) {
-                    assignment[i] = bestK;
-                    changed = true;
-                }
-            }
-
-            std::array<glm::vec3, K> sum{};
-            std::array<int, K> count{};
+        // A warm start keeps all K previous colors (even with few samples) and only refines them.
+        Centers centers{};
+        int activeCenters = K_eff;
+        if (options.warmStart) {
             for (int k = 0; k < K; ++k) {
-                sum[k] = glm::vec3(0.0f);
-                count[k] = 0;
+                centers[k] = ToOklab(options.warmStart->entries[k].rgb);
             }
+            activeCenters = K;
+        } else {
+            centers = SeedKMeansPlusPlus(samples, K_eff, rng);
+        }
+        for (int k = activeCenters; k < K; ++k) {
+            centers[k] = centers[activeCenters - 1];
+        }
 
-            for (size_t i = 0; i < samples.size(); ++i) {
-                int k = assignment[i];
-                sum[k] += samples[i];
-                ++count[k];
-            }
+        bool converged = false;
+        const int iterations = options.miniBatchSize > 0
+            ? RunMiniBatch(samples, centers, activeCenters, options, rng, converged)
+            : RunLloyd(samples, centers, activeCenters, options, converged);
 
-            for (int k = 0; k < K; ++k) {
-                if (count[k] > 0) {
-                    centers[k] = sum[k] / static_cast<float>(count[k]);
-                }
-            }
-
-            if (!changed) break;
-        }
+        Logger::Debugf("[Palette] k-means%s: %zu samples (of %llu seen), %d iteration(s), %s",
+                       options.miniBatchSize > 0 ? " (mini-batch)" : "", samples.size(),
+                       static_cast<unsigned long long>(reservoir.Seen()), iterations,
+                       converged ? "converged" : "hit iteration cap");
 
         for (int k = 0; k < K; ++k) {
             glm::vec3 linear = PaletteUtil::OklabToLinear1(centers[k]);
@@ -333,8 +516,9 @@ MonochromePalette::MonochromePalette(std::array<PaletteEntry, 16> customEntries)
 
 MonochromePalette::MonochromePalette(
     const std::vector<std::pair<float, std::shared_ptr<Texture>>>& textures,
-    const std::vector<WeightedTextureArray>& textureArrays)
-    : Palette(textures, textureArrays, true)
+    const std::vector<WeightedTextureArray>& textureArrays,
+    const PaletteBuildOptions& options)
+    : Palette(textures, textureArrays, true, options)
 {
     InferParamsFromEntries();
 }
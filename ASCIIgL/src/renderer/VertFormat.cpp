@@ -15,11 +15,12 @@ namespace ASCIIgL {
 // =========================================================================
 
 VertexElement::VertexElement(VertexElementSemantic semantic, VertexElementType type, 
-                             uint32_t offset, uint32_t semanticIndex)
+                             uint32_t offset, uint32_t semanticIndex, bool perInstance)
     : _semantic(semantic)
     , _type(type)
     , _offset(offset)
     , _semanticIndex(semanticIndex)
+    , _perInstance(perInstance)
 {
 }
 
@@ -31,7 +32,8 @@ bool VertexElement::operator==(const VertexElement& other) const {
     return _semantic == other._semantic &&
            _type == other._type &&
            _offset == other._offset &&
-           _semanticIndex == other._semanticIndex;
+           _semanticIndex == other._semanticIndex &&
+           _perInstance == other._perInstance;
 }
 
 // =========================================================================
@@ -82,10 +84,19 @@ VertFormat::Builder& VertFormat::Builder::AddUByte4Normalized(VertexElementSeman
     return Add(semantic, VertexElementType::UByte4Normalized, semanticIndex);
 }
 
+VertFormat::Builder& VertFormat::Builder::AddInstance(VertexElementSemantic semantic,
+                                                     VertexElementType type,
+                                                     uint32_t semanticIndex) {
+    _elements.emplace_back(semantic, type, _currentInstanceOffset, semanticIndex, true);
+    _currentInstanceOffset += GetVertexElementTypeSize(type);
+    return *this;
+}
+
 VertFormat VertFormat::Builder::Build() const {
     VertFormat format;
     format._elements = _elements;
     format._stride = _currentOffset;
+    format._instanceStride = _currentInstanceOffset;
     return format;
 }
 
@@ -94,7 +105,7 @@ VertFormat VertFormat::Builder::Build() const {
 // =========================================================================
 
 bool VertFormat::operator==(const VertFormat& other) const {
-    if (_stride != other._stride) return false;
+    if (_stride != other._stride || _instanceStride != other._instanceStride) return false;
     if (_elements.size() != other._elements.size()) return false;
     
     for (size_t i = 0; i < _elements.size(); ++i) {
@@ -106,6 +117,7 @@ bool VertFormat::operator==(const VertFormat& other) const {
 
 size_t VertFormat::GetHash() const {
     size_t hash = std::hash<uint32_t>{}(_stride);
+    hash ^= std::hash<uint32_t>{}(_instanceStride) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
     
     for (const auto& element : _elements) {
         // Combine hashes using XOR and bit shifting (standard hash combine pattern)
@@ -113,6 +125,7 @@ size_t VertFormat::GetHash() const {
         hash ^= std::hash<int>{}(static_cast<int>(element.GetType())) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
         hash ^= std::hash<uint32_t>{}(element.GetOffset()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
         hash ^= std::hash<uint32_t>{}(element.GetSemanticIndex()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<bool>{}(element.IsPerInstance()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
     }
     
     return hash;
@@ -236,6 +249,31 @@ const VertFormat& PosUVLayer() {
     return format;
 }
 
+const VertFormat& PosUVLayerLight() {
+    static VertFormat format = VertFormat::Builder()
+        .AddFloat3(VertexElementSemantic::Position)    // XYZ (12 bytes)
+        .AddFloat3(VertexElementSemantic::TexCoord, 0)   // UV + Layer -> TEXCOORD0 (12 bytes)
+        .AddFloat(VertexElementSemantic::TexCoord, 1)    // packed light -> TEXCOORD1 (4 bytes)
+        .Build();
+    static_assert(sizeof(VertStructs::PosUVLayerLight) == 28, "vertex struct must match the format");
+    return format;
+}
+
+const VertFormat& PosUVLayerInstanced() {
+    static VertFormat format = VertFormat::Builder()
+        .AddFloat3(VertexElementSemantic::Position)    // XYZ (12 bytes)
+        .AddFloat3(VertexElementSemantic::TexCoord, 0)   // UV + Layer -> TEXCOORD0 (12 bytes)
+        .AddInstance(VertexElementSemantic::TexCoord, VertexElementType::Float4, 4)  // model column 0 (16 bytes)
+        .AddInstance(VertexElementSemantic::TexCoord, VertexElementType::Float4, 5)  // model column 1
+        .AddInstance(VertexElementSemantic::TexCoord, VertexElementType::Float4, 6)  // model column 2
+        .AddInstance(VertexElementSemantic::TexCoord, VertexElementType::Float4, 7)  // model column 3
+        .AddInstance(VertexElementSemantic::Color, VertexElementType::Float4, 0)     // tint (16 bytes)
+        .AddInstance(VertexElementSemantic::TexCoord, VertexElementType::Float, 8)   // layer (4 bytes)
+        .Build();
+    static_assert(sizeof(VertStructs::InstanceTransformTintLayer) == 84, "instance struct must match the format");
+    return format;
+}
+
 } // namespace VertFormats
 
 } // namespace ASCIIgL
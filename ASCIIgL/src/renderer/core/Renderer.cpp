@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <numeric>
 #include <sstream>
@@ -557,6 +558,18 @@ int Renderer::GetMaxAnisotropy() const {
     return impl_->_maxAnisotropy;
 }
 
+void Renderer::SetRenderScale(float scale) {
+    scale = std::clamp(scale, 0.25f, 1.0f);
+    impl_->_renderScale = scale;
+    impl_->_viewportWidth = std::max(1, static_cast<int>(std::lround(impl_->_renderTargetWidth * scale)));
+    impl_->_viewportHeight = std::max(1, static_cast<int>(std::lround(impl_->_renderTargetHeight * scale)));
+    InvalidateBoundState();
+}
+
+float Renderer::GetRenderScale() const {
+    return impl_->_renderScale;
+}
+
 // =========================================================================
 // Custom Shader/Material System Implementation
 // =========================================================================
@@ -584,68 +597,107 @@ void Renderer::UnbindShaderProgram() {
     impl_->_boundMaterial = nullptr;
 }
 
-void Renderer::BindMaterial(Material* material) {
-    if (!impl_->_initialized || !material) return;
+bool Renderer::BindMaterial(const RecordedMaterial& material, const Texture* meshTexture) {
+    if (!impl_->_initialized || !material.material) return false;
     
-    impl_->_boundMaterial = material;
+    impl_->_boundMaterial = material.material;
 
-    material->UpdateConstantBufferData();
-    
     // Bind shader program
-    auto program = material->GetShaderProgram();
-    if (program) {
-        BindShaderProgram(program.get());
+    bool complete = true;
+    if (material.program) {
+        BindShaderProgram(material.program.get());
+        complete = material.program->IsValid();
     }
     
-    // Bind textures (material's per-slot sampler type is used).
+    // Bind textures (material's per-slot sampler type is used); a mesh texture replaces t0.
     // Unbind empty slots so a prior material cannot leave stale SRVs on the same register.
-    for (const auto& slot : material->_textureSlots) {
-        if (slot.texture) {
-            BindTexture(slot.texture, slot.slot, slot.samplerType);
+    for (const auto& slot : material.textureSlots) {
+        const Texture* texture = (meshTexture && slot.slot == 0) ? meshTexture : slot.texture;
+        if (texture) {
+            complete &= BindTexture(texture, slot.slot, slot.samplerType);
         } else if (slot.textureArray) {
-            BindTextureArray(slot.textureArray, slot.slot, slot.samplerType);
+            complete &= BindTextureArray(slot.textureArray, slot.slot, slot.samplerType);
         } else {
             UnbindTexture(static_cast<int>(slot.slot));
         }
     }
+    return complete;
 }
 
-void Renderer::UploadMaterialConstants(Material* material) {
-    if (!material || !impl_->_initialized) return;
+size_t Renderer::UploadMaterialConstants(const RecordedMaterial& recorded) {
+    Material* material = recorded.material;
+    if (!material || !impl_->_initialized) return 0;
     
-    auto program = material->GetShaderProgram();
-    if (!program) return;
+    const auto& program = recorded.program;
+    if (!program) return 0;
     
     const auto& layout = program->GetUniformLayout();
-    if (layout.GetSize() == 0) return;
+    const uint32_t size = layout.GetSize();
+    if (size == 0 || recorded.constants.size() < size) return 0;
     
-    // Create or update material's GPU constant buffer
-    if (!material->_impl->constantBufferInitialized) {
+    Material::Impl& gpu = *material->_impl;
+    size_t bytesCopied = 0;
+
+    if (!gpu.constantBufferInitialized || gpu.uploaded.size() != size) {
+        // DEFAULT + UpdateSubresource1 when the runtime can patch a sub-range; otherwise DYNAMIC,
+        // where WRITE_DISCARD forces rewriting the whole buffer.
         D3D11_BUFFER_DESC cbDesc = {};
-        cbDesc.ByteWidth = layout.GetSize();
-        cbDesc.Usage = D3D11_USAGE_DYNAMIC;
+        cbDesc.ByteWidth = size;
         cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-        cbDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-        
-        HRESULT hr = impl_->_device->CreateBuffer(&cbDesc, nullptr, &material->_impl->constantBuffer);
+        if (impl_->_cbPartialUpdate) {
+            cbDesc.Usage = D3D11_USAGE_DEFAULT;
+        } else {
+            cbDesc.Usage = D3D11_USAGE_DYNAMIC;
+            cbDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        }
+
+        D3D11_SUBRESOURCE_DATA initData = {};
+        initData.pSysMem = recorded.constants.data();
+
+        gpu.constantBuffer.Reset();
+        HRESULT hr = impl_->_device->CreateBuffer(&cbDesc, &initData, &gpu.constantBuffer);
         if (FAILED(hr)) {
             Logger::Error("Failed to create material constant buffer");
-            return;
+            return 0;
+        }
+        gpu.partialUpdates = impl_->_cbPartialUpdate;
+        gpu.uploaded.assign(recorded.constants.begin(), recorded.constants.begin() + size);
+        gpu.constantBufferInitialized = true;
+        bytesCopied = size;
+    } else {
+        // Dirty range: first..last 16-byte register that differs from what the buffer holds.
+        constexpr uint32_t kRegisterBytes = 16;
+        const std::byte* src = recorded.constants.data();
+        uint32_t first = size;
+        uint32_t last = 0;
+        for (uint32_t reg = 0; reg < size; reg += kRegisterBytes) {
+            if (std::memcmp(src + reg, gpu.uploaded.data() + reg, kRegisterBytes) != 0) {
+                if (first == size) first = reg;
+                last = reg + kRegisterBytes;
+            }
+        }
+
+        if (first < last) {
+            if (gpu.partialUpdates) {
+                const D3D11_BOX box = { first, 0, 0, last, 1, 1 };
+                impl_->_context1->UpdateSubresource1(gpu.constantBuffer.Get(), 0, &box, src + first, 0, 0, 0);
+                bytesCopied = last - first;
+            } else {
+                D3D11_MAPPED_SUBRESOURCE mapped;
+                HRESULT hr = impl_->_context->Map(gpu.constantBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
+                if (FAILED(hr)) return 0;
+                memcpy(mapped.pData, src, size);
+                impl_->_context->Unmap(gpu.constantBuffer.Get(), 0);
+                bytesCopied = size;
+            }
+            std::memcpy(gpu.uploaded.data() + first, src + first, last - first);
         }
-        material->_impl->constantBufferInitialized = true;
-    }
-    
-    // Map and upload data
-    D3D11_MAPPED_SUBRESOURCE mapped;
-    HRESULT hr = impl_->_context->Map(material->_impl->constantBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
-    if (SUCCEEDED(hr)) {
-        memcpy(mapped.pData, material->_constantBufferData.data(), layout.GetSize());
-        impl_->_context->Unmap(material->_impl->constantBuffer.Get(), 0);
     }
     
     // Bind to both vertex and pixel shader stages
-    impl_->_context->VSSetConstantBuffers(0, 1, material->_impl->constantBuffer.GetAddressOf());
-    impl_->_context->PSSetConstantBuffers(0, 1, material->_impl->constantBuffer.GetAddressOf());
+    impl_->_context->VSSetConstantBuffers(0, 1, gpu.constantBuffer.GetAddressOf());
+    impl_->_context->PSSetConstantBuffers(0, 1, gpu.constantBuffer.GetAddressOf());
+    return bytesCopied;
 }
 
 ShaderProgram* Renderer::GetBoundShaderProgram() const {
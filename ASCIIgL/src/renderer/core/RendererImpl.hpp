@@ -3,12 +3,15 @@
 // Internal definition of Renderer::Impl and Renderer::GPUMeshCache (not for public include).
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
-#include <d3d11.h>
+#include <d3d11_1.h>
 #include <wrl/client.h>
 
 #ifndef WIN32_LEAN_AND_MEAN
@@ -21,18 +24,109 @@
 
 #include <glm/glm.hpp>
 
+#include <ASCIIgL/renderer/Material.hpp>
 #include <ASCIIgL/renderer/Renderer.hpp>
+#include <ASCIIgL/util/RangeAllocator.hpp>
 
 namespace ASCIIgL {
 
 template <typename T>
 using ComPtr = Microsoft::WRL::ComPtr<T>;
 
-struct Renderer::GPUMeshCache {
+// Shared vertex/index buffers that pooled meshes (Mesh::SetPooled) suballocate from, one stride per
+// slab. Allocator units are vertices and indices, so a mesh's offsets are passed straight to
+// DrawIndexed as BaseVertexLocation / StartIndexLocation and consecutive draws keep the same binding.
+struct MeshSlab {
+    static constexpr uint32_t kVertices = 1u << 18;   // 6 MiB at the 24-byte chunk vertex
+    static constexpr uint32_t kIndices = 1u << 19;    // 2 MiB
+
     ComPtr<ID3D11Buffer> vertexBuffer;
     ComPtr<ID3D11Buffer> indexBuffer;
+    unsigned int stride = 0;
+    RangeAllocator vertices{kVertices};
+    RangeAllocator indices{kIndices};
+};
+
+// A pooled mesh's data waiting for the render thread: UpdateSubresource is a context call, while
+// caches are created during recording.
+struct PendingMeshUpload {
+    MeshSlab* slab = nullptr;
+    uint32_t baseVertex = 0;
+    uint32_t firstIndex = 0;
+    std::vector<std::byte> vertices;
+    std::vector<int> indices;
+};
+
+struct Renderer::GPUMeshCache {
+    ComPtr<ID3D11Buffer> vertexBuffer;            // pooled: the slab's buffers (shared)
+    ComPtr<ID3D11Buffer> indexBuffer;
     size_t vertexCount = 0;
     size_t indexCount = 0;
+    size_t gpuBytes = 0;
+    MeshSlab* slab = nullptr;                     // non-null when suballocated
+    uint32_t baseVertex = 0;
+    uint32_t firstIndex = 0;
+};
+
+// Material state captured when a packet is sealed, so execution never reads a Material the
+// simulation thread may be mutating. Per-draw overrides are written into \c constants in
+// execution order, matching the old in-place Material::ApplyUniformOverride behaviour.
+// Entries are reused across frames (see DrawPacket::materialCount) to keep their buffers.
+struct Renderer::RecordedMaterial {
+    Material* material = nullptr;                 // GPU constant buffer owner (Material::Impl)
+    std::shared_ptr<ShaderProgram> program;
+    std::vector<TextureSlot> textureSlots;
+    std::vector<std::byte> constants;
+    uint32_t programId = 0;                       // dense per-packet id for sort keys
+};
+
+// A submitted draw resolved to its GPU buffers at submit time; the Mesh itself is not touched again.
+// Overrides live in DrawPacket::overrideArena as [uint32 offset][uint32 size][size bytes] records.
+struct Renderer::QueuedDraw {
+    const GPUMeshCache* cache = nullptr;
+    const Texture* meshTexture = nullptr;
+    unsigned int stride = 0;
+    uint32_t materialIndex = 0;
+    uint32_t textureId = 0;                       // dense per-packet id of meshTexture (0 = none)
+    uint32_t overrideOffset = 0;                  // byte offset into overrideArena
+    uint32_t overrideBytes = 0;
+    uint32_t instanceOffset = 0;                  // byte offset into instanceArena (instanced draws only)
+    uint32_t instanceCount = 0;                   // 0 = plain draw
+    uint32_t instanceStride = 0;
+    int layer = 0;
+    float sortKey = 0.0f;
+    bool backfaceCulling = true;
+    bool depthTest = true;
+};
+
+// Radix-sorted execution order: 64-bit packed render-state key plus index into the draw list.
+struct DrawSortEntry {
+    uint64_t key = 0;
+    uint32_t index = 0;
+};
+
+struct Renderer::DrawPacket {
+    std::vector<QueuedDraw> opaque;
+    std::vector<QueuedDraw> transparent;
+    // Only the first materialCount entries are live; the rest keep their capacity for reuse.
+    std::vector<RecordedMaterial> materials;
+    size_t materialCount = 0;
+    uint32_t lastMaterialIndex = 0;               // submit-side lookup cache (consecutive draws repeat)
+    std::vector<const Texture*> textures;         // textureId - 1 -> texture
+    // Per-frame linear arena for uniform overrides; reset (not freed) when the packet is released.
+    std::vector<std::byte> overrideArena;
+    // Per-instance data of instanced draws, uploaded as one dynamic vertex buffer before execution.
+    std::vector<std::byte> instanceArena;
+    std::vector<DrawSortEntry> opaqueOrder;
+    std::vector<DrawSortEntry> transparentOrder;
+    std::vector<DrawSortEntry> sortScratch;
+    std::vector<const ShaderProgram*> programs;   // programId -> program, rebuilt at seal
+    size_t capacityBytes = 0;                     // heap held by the vectors above at last seal
+    DrawStats stats;
+    // Mesh caches released while this packet was recording; deleted after it has executed.
+    std::vector<GPUMeshCache*> retiredCaches;
+    // Pooled mesh data written into the slabs before this packet's draws execute.
+    std::vector<PendingMeshUpload> pendingUploads;
 };
 
 struct Renderer::Impl {
@@ -40,9 +134,15 @@ struct Renderer::Impl {
     bool _supersample2x = false;
     int _renderTargetWidth = 0;
     int _renderTargetHeight = 0;
+    // Dynamic resolution: scene draws into the top-left _viewportWidth x _viewportHeight of the RT.
+    float _renderScale = 1.0f;
+    int _viewportWidth = 0;
+    int _viewportHeight = 0;
 
     ComPtr<ID3D11Device> _device;
     ComPtr<ID3D11DeviceContext> _context;
+    ComPtr<ID3D11DeviceContext1> _context1;       // null on pre-11.1 runtimes
+    bool _cbPartialUpdate = false;                // D3D11_FEATURE_DATA_D3D11_OPTIONS::ConstantBufferPartialUpdate
     ComPtr<ID3D11Texture2D> _renderTarget;
     ComPtr<ID3D11RenderTargetView> _renderTargetView;
     ComPtr<ID3D11ShaderResourceView> _renderTargetSRV;
@@ -59,6 +159,23 @@ struct Renderer::Impl {
     ComPtr<ID3D11BlendState> _blendStateOpaque;
     ComPtr<ID3D11BlendState> _blendStateAlpha;
 
+    // GPU mesh caches and the slabs behind pooled meshes
+    std::atomic<size_t> _gpuMeshBytes{0};         // caches are created while recording, freed after execution
+    std::atomic<size_t> _gpuMeshCount{0};
+    std::vector<std::unique_ptr<MeshSlab>> _meshSlabs;
+    // Caches are created and retired on the recording (simulation) thread while a pipelined render
+    // thread executes the other packet: guards the slabs, every packet's retiredCaches and
+    // pendingUploads, and the _recordPacket/_executePacket swap. Also guards the texture SRV caches
+    // below, which the simulation thread invalidates while the render thread binds.
+    std::mutex _meshCacheMutex;
+    // Mesh buffers currently bound by DrawMesh; reset per FlushDraws since other passes rebind the IA.
+    ID3D11Buffer* _boundMeshVB = nullptr;
+    ID3D11Buffer* _boundMeshIB = nullptr;
+    // Instance stream for instanced draws (IA slot 1): rewritten with WRITE_DISCARD each frame,
+    // grown to the largest arena seen. Render thread only.
+    ComPtr<ID3D11Buffer> _instanceBuffer;
+    size_t _instanceBufferBytes = 0;
+
     ComPtr<IDXGISwapChain> _debugSwapChain;
     HWND _debugWindow = nullptr;
 
@@ -94,6 +211,9 @@ struct Renderer::Impl {
     ComPtr<ID3D11VertexShader> _quantizationVS;
     ComPtr<ID3D11PixelShader> _quantizationPS;
     ComPtr<ID3D11PixelShader> _downsamplePS;
+    ComPtr<ID3D11PixelShader> _rescalePS;
+    ComPtr<ID3D11Buffer> _rescaleCB;
+    ComPtr<ID3D11SamplerState> _rescaleSampler;
     ComPtr<ID3D11InputLayout> _quantizationInputLayout;
     ComPtr<ID3D11Buffer> _fullscreenQuadVB;
 
@@ -135,11 +255,16 @@ struct Renderer::Impl {
     static constexpr size_t _monochromeLUTSize = 1024;
     std::array<std::pair<float, ScreenPixel>, _monochromeLUTSize> _monochromeLUT{};
 
-    bool _ditheringEnabled = false;
-    bool _lutGpuResourcesDirty = true;
+    // Atomic: toggled from simulation input while a pipelined render thread may read them.
+    std::atomic<bool> _ditheringEnabled{false};
+    std::atomic<bool> _lutGpuResourcesDirty{true};
 
-    std::vector<DrawCall> _opaqueDraws;
-    std::vector<DrawCall> _transparentDraws;
+    // Draw packets: SubmitDraw fills _drawPackets[_recordPacket], FlushDraws executes _drawPackets[_executePacket].
+    std::array<DrawPacket, 2> _drawPackets;
+    size_t _recordPacket = 0;
+    size_t _executePacket = 1;
+    bool _pipelinedSubmission = false;
+    DrawStats _lastDrawStats;
 };
 
 }  // namespace ASCIIgL
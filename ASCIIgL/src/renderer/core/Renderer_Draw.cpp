@@ -1,6 +1,11 @@
 #include <ASCIIgL/renderer/Renderer.hpp>
 
-#include <algorithm>                // std::sort
+#include <algorithm>                // std::find, std::min, std::max, std::clamp
+#include <cstring>                  // memcpy, memcmp
+#include <mutex>                    // std::lock_guard
+#include <string>                   // std::to_string
+#include <utility>                  // std::swap
+#include <variant>
 
 #include <ASCIIgL/engine/Mesh.hpp>
 #include <ASCIIgL/engine/Model.hpp>
@@ -13,35 +18,244 @@
 
 namespace ASCIIgL {
 
+namespace {
+
 // =============================================================================
-// HIGH-LEVEL DRAWING API - MESHES AND MODELS (Internal + queued)
+// Sort keys
 // =============================================================================
+// Opaque:      | layer 8 | pass 1 | program 12 | material 16 | texture 12 | cull 1 | depthTest 1 | depth 13 |
+// Transparent: | layer 8 | pass 1 | inverted depth 32 | material 16 | cull 1 | depthTest 1 | texture 5 |
+// Ids are dense per packet; values past a field's width saturate, which only costs grouping.
+
+uint64_t KeyField(uint32_t value, unsigned bits, unsigned shift) {
+    const uint32_t maxValue = (1u << bits) - 1u;
+    return static_cast<uint64_t>(std::min(value, maxValue)) << shift;
+}
+
+uint64_t LayerBits(int layer) {
+    return static_cast<uint64_t>(std::clamp(layer + 128, 0, 255)) << 56;
+}
+
+// Maps a float to a uint32 whose unsigned order matches the float order.
+uint32_t OrderedFloatBits(float f) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
 
-// Internal immediate primitive used by the draw-call system.
-void Renderer::DrawMesh(const Mesh* mesh) {
-    if (!impl_->_initialized || !mesh) {
-        if (!mesh) {
-            Logger::Error("DrawMesh: mesh is nullptr!");
+uint64_t OpaqueSortKey(const Renderer::QueuedDraw& d, uint32_t programId) {
+    return LayerBits(d.layer)
+         | KeyField(programId, 12, 43)
+         | KeyField(d.materialIndex, 16, 27)
+         | KeyField(d.textureId, 12, 15)
+         | (static_cast<uint64_t>(d.backfaceCulling) << 14)
+         | (static_cast<uint64_t>(d.depthTest) << 13)
+         | (OrderedFloatBits(d.sortKey) >> 19);  // coarse front-to-back within equal state
+}
+
+uint64_t TransparentSortKey(const Renderer::QueuedDraw& d) {
+    // Higher sortKey (farther) first: back-to-front.
+    return LayerBits(d.layer)
+         | (uint64_t{1} << 55)
+         | (static_cast<uint64_t>(~OrderedFloatBits(d.sortKey)) << 23)
+         | KeyField(d.materialIndex, 16, 7)
+         | (static_cast<uint64_t>(d.backfaceCulling) << 6)
+         | (static_cast<uint64_t>(d.depthTest) << 5)
+         | KeyField(d.textureId, 5, 0);
+}
+
+// Stable LSD radix sort, 8 bits per pass; passes where every key shares the byte are skipped
+// (layer and pass bits are usually constant across a list).
+void RadixSortDrawKeys(std::vector<DrawSortEntry>& entries, std::vector<DrawSortEntry>& scratch) {
+    const size_t n = entries.size();
+    if (n < 2) return;
+
+    size_t counts[8][256] = {};
+    for (const DrawSortEntry& e : entries) {
+        for (unsigned b = 0; b < 8; ++b) {
+            ++counts[b][(e.key >> (b * 8)) & 0xFF];
         }
-        return;
     }
-    
-    // Get or create GPU buffer cache for this mesh
-    GPUMeshCache* cache = GetOrCreateMeshCache(mesh);
-    if (!cache || !cache->vertexBuffer) return;
-    
-    // Bind cached vertex buffer with mesh's format stride
-    UINT stride = mesh->GetVertFormat().GetStride();
-    UINT offset = 0;
-    impl_->_context->IASetVertexBuffers(0, 1, cache->vertexBuffer.GetAddressOf(), &stride, &offset);
+
+    scratch.resize(n);
+    std::vector<DrawSortEntry>* src = &entries;
+    std::vector<DrawSortEntry>* dst = &scratch;
+    for (unsigned b = 0; b < 8; ++b) {
+        const unsigned shift = b * 8;
+        const size_t* hist = counts[b];
+        if (hist[(src->front().key >> shift) & 0xFF] == n) continue;
+
+        size_t offsets[256];
+        size_t sum = 0;
+        for (unsigned i = 0; i < 256; ++i) {
+            offsets[i] = sum;
+            sum += hist[i];
+        }
+        for (const DrawSortEntry& e : *src) {
+            (*dst)[offsets[(e.key >> shift) & 0xFF]++] = e;
+        }
+        std::swap(src, dst);
+    }
+    if (src != &entries) {
+        entries.swap(scratch);
+    }
+}
+
+// =============================================================================
+// Override arena
+// =============================================================================
+
+void AppendOverride(std::vector<std::byte>& arena, const Renderer::UniformOverride& ov) {
+    std::visit([&arena, &ov](const auto& val) {
+        const uint32_t offset = ov.desc->offset;
+        const uint32_t size = std::min<uint32_t>(ov.desc->size, static_cast<uint32_t>(sizeof(val)));
+        const size_t at = arena.size();
+        arena.resize(at + 2 * sizeof(uint32_t) + size);
+        std::memcpy(arena.data() + at, &offset, sizeof(offset));
+        std::memcpy(arena.data() + at + sizeof(offset), &size, sizeof(size));
+        std::memcpy(arena.data() + at + 2 * sizeof(uint32_t), &val, size);
+    }, ov.value);
+}
+
+// Writes a draw's overrides into its material's constants. Returns true if any byte changed.
+bool WriteDrawOverrides(const std::vector<std::byte>& arena, const Renderer::QueuedDraw& qd,
+                        std::vector<std::byte>& constants) {
+    bool changed = false;
+    const std::byte* p = arena.data() + qd.overrideOffset;
+    const std::byte* end = p + qd.overrideBytes;
+    while (p < end) {
+        uint32_t offset = 0;
+        uint32_t size = 0;
+        std::memcpy(&offset, p, sizeof(offset));
+        std::memcpy(&size, p + sizeof(offset), sizeof(size));
+        p += 2 * sizeof(uint32_t);
+        if (static_cast<size_t>(offset) + size <= constants.size() &&
+            std::memcmp(constants.data() + offset, p, size) != 0) {
+            std::memcpy(constants.data() + offset, p, size);
+            changed = true;
+        }
+        p += size;
+    }
+    return changed;
+}
+
+size_t PacketCapacityBytes(const Renderer::DrawPacket& packet) {
+    size_t bytes = (packet.opaque.capacity() + packet.transparent.capacity()) * sizeof(Renderer::QueuedDraw)
+                 + packet.materials.capacity() * sizeof(Renderer::RecordedMaterial)
+                 + packet.textures.capacity() * sizeof(const Texture*)
+                 + packet.overrideArena.capacity()
+                 + packet.instanceArena.capacity()
+                 + (packet.opaqueOrder.capacity() + packet.transparentOrder.capacity() +
+                    packet.sortScratch.capacity()) * sizeof(DrawSortEntry)
+                 + packet.programs.capacity() * sizeof(const ShaderProgram*);
+    for (const Renderer::RecordedMaterial& rec : packet.materials) {
+        bytes += rec.constants.capacity() + rec.textureSlots.capacity() * sizeof(TextureSlot);
+    }
+    return bytes;
+}
+
+} // namespace
+
+// =============================================================================
+// HIGH-LEVEL DRAWING API - MESHES AND MODELS (Internal + queued)
+// =============================================================================
+
+// Internal immediate primitive used by the draw-call system. The cache was resolved at submit.
+uint32_t Renderer::DrawMesh(const GPUMeshCache* cache, unsigned int stride) {
+    if (!impl_->_initialized || !cache || !cache->vertexBuffer) return 0;
+
+    // Pooled meshes share their slab's buffers, so runs of them bind once and differ only in offsets.
+    uint32_t binds = 0;
+    if (cache->vertexBuffer.Get() != impl_->_boundMeshVB) {
+        UINT offset = 0;
+        impl_->_context->IASetVertexBuffers(0, 1, cache->vertexBuffer.GetAddressOf(), &stride, &offset);
+        impl_->_boundMeshVB = cache->vertexBuffer.Get();
+        ++binds;
+    }
     
     // Draw with or without indices
     if (cache->indexBuffer && cache->indexCount > 0) {
-        impl_->_context->IASetIndexBuffer(cache->indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
-        impl_->_context->DrawIndexed(static_cast<UINT>(cache->indexCount), 0, 0);
+        if (cache->indexBuffer.Get() != impl_->_boundMeshIB) {
+            impl_->_context->IASetIndexBuffer(cache->indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
+            impl_->_boundMeshIB = cache->indexBuffer.Get();
+            ++binds;
+        }
+        impl_->_context->DrawIndexed(static_cast<UINT>(cache->indexCount), cache->firstIndex,
+                                     static_cast<INT>(cache->baseVertex));
+    } else {
+        impl_->_context->Draw(static_cast<UINT>(cache->vertexCount), cache->baseVertex);
+    }
+    return binds;
+}
+
+uint32_t Renderer::DrawMeshInstanced(const GPUMeshCache* cache, unsigned int stride, const QueuedDraw& draw) {
+    if (!impl_->_initialized || !cache || !cache->vertexBuffer || !impl_->_instanceBuffer) return 0;
+    const size_t end = static_cast<size_t>(draw.instanceOffset) + size_t{draw.instanceCount} * draw.instanceStride;
+    if (end > impl_->_instanceBufferBytes) return 0;  // upload failed this frame
+
+    uint32_t binds = 0;
+    if (cache->vertexBuffer.Get() != impl_->_boundMeshVB) {
+        UINT offset = 0;
+        impl_->_context->IASetVertexBuffers(0, 1, cache->vertexBuffer.GetAddressOf(), &stride, &offset);
+        impl_->_boundMeshVB = cache->vertexBuffer.Get();
+        ++binds;
+    }
+    // Each instanced draw has its own slice (and possibly stride), so slot 1 is rebound per draw.
+    const UINT instanceStride = draw.instanceStride;
+    const UINT instanceOffset = draw.instanceOffset;
+    impl_->_context->IASetVertexBuffers(1, 1, impl_->_instanceBuffer.GetAddressOf(), &instanceStride, &instanceOffset);
+    ++binds;
+
+    if (cache->indexBuffer && cache->indexCount > 0) {
+        if (cache->indexBuffer.Get() != impl_->_boundMeshIB) {
+            impl_->_context->IASetIndexBuffer(cache->indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
+            impl_->_boundMeshIB = cache->indexBuffer.Get();
+            ++binds;
+        }
+        impl_->_context->DrawIndexedInstanced(static_cast<UINT>(cache->indexCount), draw.instanceCount,
+                                              cache->firstIndex, static_cast<INT>(cache->baseVertex), 0);
     } else {
-        impl_->_context->Draw(static_cast<UINT>(cache->vertexCount), 0);
+        impl_->_context->DrawInstanced(static_cast<UINT>(cache->vertexCount), draw.instanceCount,
+                                       cache->baseVertex, 0);
     }
+    return binds;
+}
+
+bool Renderer::UploadInstanceData(DrawPacket& packet) {
+    const size_t bytes = packet.instanceArena.size();
+    packet.stats.instanceBytes = bytes;
+    if (bytes == 0) return true;
+
+    if (!impl_->_instanceBuffer || impl_->_instanceBufferBytes < bytes) {
+        // Grow geometrically so a slowly rising instance count does not recreate the buffer every frame.
+        size_t capacity = std::max<size_t>(impl_->_instanceBufferBytes, 64 * 1024);
+        while (capacity < bytes) capacity *= 2;
+
+        impl_->_instanceBuffer.Reset();
+        impl_->_instanceBufferBytes = 0;
+
+        D3D11_BUFFER_DESC desc = {};
+        desc.ByteWidth = static_cast<UINT>(capacity);
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        HRESULT hr = impl_->_device->CreateBuffer(&desc, nullptr, &impl_->_instanceBuffer);
+        if (FAILED(hr)) {
+            Logger::Error("[Renderer] Failed to create instance buffer (" + std::to_string(capacity) + " bytes)");
+            return false;
+        }
+        impl_->_instanceBufferBytes = capacity;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mapped = {};
+    HRESULT hr = impl_->_context->Map(impl_->_instanceBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
+    if (FAILED(hr)) {
+        Logger::Error("[Renderer] Failed to map instance buffer");
+        return false;
+    }
+    std::memcpy(mapped.pData, packet.instanceArena.data(), bytes);
+    impl_->_context->Unmap(impl_->_instanceBuffer.Get(), 0);
+    return true;
 }
 
 // Public queued DrawModel: enqueue all meshes of a model as draw calls.
@@ -53,27 +267,25 @@ void Renderer::DrawModel(const Model& model,
                          float sortKey) {
     if (!material || !IsInitialized()) return;
 
-    // Resolve MVP uniform descriptor once per model draw.
-    const UniformDescriptor* mvpDesc = material->GetUniformDescriptor("mvp");
+    // Resolve MVP uniform descriptor once per model draw; the override is shared by every mesh
+    // and copied into the frame arena, so no per-mesh vector is allocated.
+    UniformOverride mvpOverride;
+    mvpOverride.desc = material->GetUniformDescriptor("mvp");
+    if (mvpOverride.desc) {
+        mvpOverride.value = UniformValue(mvp);
+    }
+    const size_t overrideCount = mvpOverride.desc ? 1 : 0;
+
+    DrawCall dc;
+    dc.material    = material;
+    dc.layer       = layer;
+    dc.transparent = transparent;
+    dc.sortKey     = sortKey;
 
     for (const auto& meshPtr : model.meshes) {
         if (!meshPtr) continue;
-
-        DrawCall dc;
-        dc.mesh        = meshPtr;
-        dc.material    = material;
-        dc.layer       = layer;
-        dc.transparent = transparent;
-        dc.sortKey     = sortKey;
-
-        if (mvpDesc) {
-            UniformOverride ov;
-            ov.desc  = mvpDesc;
-            ov.value = UniformValue(mvp);
-            dc.overrides.push_back(std::move(ov));
-        }
-
-        SubmitDraw(dc);
+        dc.mesh = meshPtr;
+        SubmitDraw(dc, &mvpOverride, overrideCount);
     }
 }
 
@@ -87,10 +299,6 @@ void Renderer::BeginGpuFrame() {
         return;
     }
 
-    // Clear draw queues
-    impl_->_opaqueDraws.clear();
-    impl_->_transparentDraws.clear();
-
     // Clear render target: background is sRGB 0-255; RTV is sRGB so clear expects linear 0-1
     glm::vec3 linearBg = PaletteUtil::sRGB255ToLinear1(GetBackgroundCol());
     float clear_color[4] = { linearBg.r, linearBg.g, linearBg.b, 1.0f };
@@ -102,10 +310,11 @@ void Renderer::BeginGpuFrame() {
     // Bind render targets
     impl_->_context->OMSetRenderTargets(1, impl_->_renderTargetView.GetAddressOf(), impl_->_depthStencilView.Get());
 
-    // Set viewport to render-target size (2x when SSAA is enabled)
+    // Set viewport to the active render size (render-target size scaled by SetRenderScale;
+    // the RT is 2x when SSAA is enabled)
     D3D11_VIEWPORT viewport = {};
-    viewport.Width = static_cast<float>(impl_->_renderTargetWidth);
-    viewport.Height = static_cast<float>(impl_->_renderTargetHeight);
+    viewport.Width = static_cast<float>(impl_->_viewportWidth);
+    viewport.Height = static_cast<float>(impl_->_viewportHeight);
     viewport.MinDepth = 0.0f;
     viewport.MaxDepth = 1.0f;
     impl_->_context->RSSetViewports(1, &viewport);
@@ -120,85 +329,302 @@ void Renderer::BeginGpuFrame() {
 }
 
 void Renderer::SubmitDraw(const DrawCall& call) {
-    if (!call.mesh || !call.material) return;
+    SubmitDraw(call, call.overrides.data(), call.overrides.size());
+}
+
+void Renderer::SubmitDraw(const DrawCall& call, const UniformOverride* overrides, size_t overrideCount) {
+    if (!impl_->_initialized || !call.mesh || !call.material) return;
+    if (call.instanceCount > 0 && (!call.instanceData || call.instanceStride == 0)) return;
+
+    // Resolve GPU buffers now (device calls only, safe off the render thread) so execution never
+    // dereferences the Mesh, which the simulation may destroy while the packet is in flight. The
+    // Mesh is only touched here, on the recording thread; the bookkeeping the render thread also
+    // reads (slabs, packet retire/upload lists) is under _meshCacheMutex.
+    const GPUMeshCache* cache = GetOrCreateMeshCache(call.mesh);
+    if (!cache || !cache->vertexBuffer) return;
+
+    Material* mat = call.material;
+    const Texture* meshTexture = call.mesh->GetTexture();
+
+    // Meshes may carry the atlas pointer; keep material slot 0 in sync (execution re-applies it per draw).
+    if (meshTexture && mat->GetTexture(0) != meshTexture) {
+        mat->SetTexture(0, meshTexture);
+    }
+
+    DrawPacket& packet = impl_->_drawPackets[impl_->_recordPacket];
+
+    // Few distinct materials per frame and long runs of the same one: a cached linear lookup
+    // beats hashing and reuses the RecordedMaterial buffers from earlier frames.
+    uint32_t materialIndex = packet.lastMaterialIndex;
+    if (materialIndex >= packet.materialCount || packet.materials[materialIndex].material != mat) {
+        materialIndex = static_cast<uint32_t>(packet.materialCount);
+        for (size_t i = 0; i < packet.materialCount; ++i) {
+            if (packet.materials[i].material == mat) {
+                materialIndex = static_cast<uint32_t>(i);
+                break;
+            }
+        }
+        if (materialIndex == packet.materialCount) {
+            if (packet.materialCount == packet.materials.size()) {
+                packet.materials.emplace_back();
+            }
+            packet.materials[packet.materialCount++].material = mat;
+        }
+        packet.lastMaterialIndex = materialIndex;
+    }
+
+    uint32_t textureId = 0;
+    if (meshTexture) {
+        auto found = std::find(packet.textures.begin(), packet.textures.end(), meshTexture);
+        if (found == packet.textures.end()) {
+            packet.textures.push_back(meshTexture);
+            found = packet.textures.end() - 1;
+        }
+        textureId = static_cast<uint32_t>(found - packet.textures.begin()) + 1;
+    }
+
+    QueuedDraw qd;
+    qd.cache = cache;
+    qd.meshTexture = meshTexture;
+    qd.stride = call.mesh->GetVertFormat().GetStride();
+    qd.materialIndex = materialIndex;
+    qd.textureId = textureId;
+    qd.layer = call.layer;
+    qd.sortKey = call.sortKey;
+    qd.backfaceCulling = call.backfaceCulling;
+    qd.depthTest = call.depthTest;
+
+    qd.overrideOffset = static_cast<uint32_t>(packet.overrideArena.size());
+    for (size_t i = 0; i < overrideCount; ++i) {
+        if (overrides[i].desc) {
+            AppendOverride(packet.overrideArena, overrides[i]);
+        }
+    }
+    qd.overrideBytes = static_cast<uint32_t>(packet.overrideArena.size()) - qd.overrideOffset;
+
+    if (call.instanceCount > 0) {
+        // 16-byte aligned slices keep every IA offset valid whatever the strides of earlier draws.
+        constexpr size_t kInstanceAlignment = 16;
+        const size_t at = (packet.instanceArena.size() + kInstanceAlignment - 1) & ~(kInstanceAlignment - 1);
+        const size_t bytes = size_t{call.instanceCount} * call.instanceStride;
+        packet.instanceArena.resize(at + bytes);
+        std::memcpy(packet.instanceArena.data() + at, call.instanceData, bytes);
+        qd.instanceOffset = static_cast<uint32_t>(at);
+        qd.instanceCount = call.instanceCount;
+        qd.instanceStride = call.instanceStride;
+    }
+
     if (call.transparent) {
-        impl_->_transparentDraws.push_back(call);
+        packet.transparent.push_back(qd);
     } else {
-        impl_->_opaqueDraws.push_back(call);
+        packet.opaque.push_back(qd);
     }
 }
 
-void Renderer::SortOpaqueDraws() {
-    std::sort(impl_->_opaqueDraws.begin(), impl_->_opaqueDraws.end(),
-              [](const DrawCall& a, const DrawCall& b) {
-                  if (a.layer != b.layer) return a.layer < b.layer;
-                  return a.material < b.material;
-              });
-}
+void Renderer::SortDrawPacket(DrawPacket& packet) {
+    packet.opaqueOrder.resize(packet.opaque.size());
+    for (size_t i = 0; i < packet.opaque.size(); ++i) {
+        const QueuedDraw& qd = packet.opaque[i];
+        packet.opaqueOrder[i] = { OpaqueSortKey(qd, packet.materials[qd.materialIndex].programId),
+                                  static_cast<uint32_t>(i) };
+    }
+    RadixSortDrawKeys(packet.opaqueOrder, packet.sortScratch);
 
-void Renderer::SortTransparentDraws() {
-    std::sort(impl_->_transparentDraws.begin(), impl_->_transparentDraws.end(),
-              [](const DrawCall& a, const DrawCall& b) {
-                  if (a.layer != b.layer) return a.layer < b.layer;
-                  // Higher sortKey drawn later (back-to-front)
-                  return a.sortKey > b.sortKey;
-              });
+    packet.transparentOrder.resize(packet.transparent.size());
+    for (size_t i = 0; i < packet.transparent.size(); ++i) {
+        packet.transparentOrder[i] = { TransparentSortKey(packet.transparent[i]), static_cast<uint32_t>(i) };
+    }
+    RadixSortDrawKeys(packet.transparentOrder, packet.sortScratch);
+
+    // Every per-frame buffer has reached its size for this frame; any growth is this frame's allocation.
+    const size_t capacity = PacketCapacityBytes(packet);
+    packet.stats.bytesAllocated = capacity > packet.capacityBytes ? capacity - packet.capacityBytes : 0;
+    packet.capacityBytes = capacity;
+    packet.stats.overrideBytes = packet.overrideArena.size();
 }
 
-void Renderer::ExecuteDrawList(const std::vector<DrawCall>& list, const Renderer::DrawGpuState& passState) {
-    for (const auto& dc : list) {
-        if (!dc.mesh || !dc.material) continue;
+void Renderer::ExecuteDrawList(DrawPacket& packet, bool transparent, const Renderer::DrawGpuState& passState) {
+    const std::vector<QueuedDraw>& list = transparent ? packet.transparent : packet.opaque;
+    const std::vector<DrawSortEntry>& order = transparent ? packet.transparentOrder : packet.opaqueOrder;
+    DrawStats& stats = packet.stats;
+
+    // Bindings carried between consecutive draws. Nothing else binds materials during the list,
+    // so a run with the same material and mesh texture keeps its SRVs, shaders and constant buffer.
+    // A bind that left a slot empty (failed upload, invalid program) is retried by the next draw.
+    constexpr uint32_t kNone = ~0u;
+    uint32_t boundMaterial = kNone;
+    const Texture* boundMeshTexture = nullptr;
+    bool bindComplete = false;
+
+    for (const DrawSortEntry& entry : order) {
+        const QueuedDraw& qd = list[entry.index];
+        ++stats.draws;
 
         Renderer::DrawGpuState drawState = passState;
-        drawState.backfaceCulling = dc.backfaceCulling;
-        drawState.depthTest = dc.depthTest;
-        ApplyDrawState(drawState);
+        drawState.backfaceCulling = qd.backfaceCulling;
+        drawState.depthTest = qd.depthTest;
+        const Renderer::DrawGpuState& bound = impl_->_boundState.state;
+        const bool stateChanged = !impl_->_boundState.valid ||
+                                  drawState.backfaceCulling != bound.backfaceCulling ||
+                                  drawState.depthTest != bound.depthTest ||
+                                  drawState.depthWrite != bound.depthWrite ||
+                                  drawState.blend != bound.blend;
+        if (stateChanged) {
+            ApplyDrawState(drawState);
+            ++stats.stateChanges;
+        }
 
-        Material* mat = dc.material;
+        RecordedMaterial& mat = packet.materials[qd.materialIndex];
+        const bool materialChanged = !bindComplete || qd.materialIndex != boundMaterial ||
+                                     qd.meshTexture != boundMeshTexture;
+        if (materialChanged) {
+            bindComplete = BindMaterial(mat, qd.meshTexture);
+            ++stats.materialBinds;
+            ++stats.stateChanges;
+        }
+        if (stateChanged || materialChanged) {
+            ++stats.batches;
+        }
 
-        // Meshes may carry the atlas pointer; keep material slot 0 in sync before bind.
-        if (const Texture* meshTexture = dc.mesh->GetTexture()) {
-            if (mat->GetTexture(0) != meshTexture) {
-                mat->SetTexture(0, meshTexture);
+        const bool constantsChanged = WriteDrawOverrides(packet.overrideArena, qd, mat.constants);
+        if (constantsChanged || qd.materialIndex != boundMaterial) {
+            const size_t bytes = UploadMaterialConstants(mat);
+            if (bytes > 0) {
+                ++stats.constantUploads;
+                stats.constantBytes += bytes;
             }
         }
+        boundMaterial = qd.materialIndex;
+        boundMeshTexture = qd.meshTexture;
 
-        // Always bind: skipping when lastMat matches left stale t0 SRVs after a failed upload
-        // or when switching between Texture2D / Texture2DArray on the same register.
-        BindMaterial(mat);
+        if (qd.instanceCount > 0) {
+            stats.meshBufferBinds += DrawMeshInstanced(qd.cache, qd.stride, qd);
+            ++stats.instancedDraws;
+            stats.instances += qd.instanceCount;
+        } else {
+            stats.meshBufferBinds += DrawMesh(qd.cache, qd.stride);
+        }
+    }
+}
 
-        for (const auto& ov : dc.overrides) {
-            if (!ov.desc) continue;
-            mat->ApplyUniformOverride(*ov.desc, ov.value);
+void Renderer::SealDrawPacket(DrawPacket& packet) {
+    packet.programs.clear();
+    for (size_t i = 0; i < packet.materialCount; ++i) {
+        RecordedMaterial& rec = packet.materials[i];
+        Material* mat = rec.material;
+        mat->UpdateConstantBufferData();
+        rec.program = mat->GetShaderProgram();
+        rec.textureSlots = mat->_textureSlots;
+        rec.constants = mat->_constantBufferData;
+
+        auto found = std::find(packet.programs.begin(), packet.programs.end(), rec.program.get());
+        if (found == packet.programs.end()) {
+            packet.programs.push_back(rec.program.get());
+            found = packet.programs.end() - 1;
         }
+        rec.programId = static_cast<uint32_t>(found - packet.programs.begin());
+    }
+}
 
-        UploadMaterialConstants(mat);
+void Renderer::ReleaseDrawPacket(DrawPacket& packet) {
+    std::vector<GPUMeshCache*> retired;
+    {
+        std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+        retired.swap(packet.retiredCaches);
+        for (GPUMeshCache* cache : retired) {
+            if (cache->slab) {
+                cache->slab->vertices.Free(cache->baseVertex, static_cast<uint32_t>(cache->vertexCount));
+                cache->slab->indices.Free(cache->firstIndex, static_cast<uint32_t>(cache->indexCount));
+            }
+        }
+    }
+    for (GPUMeshCache* cache : retired) {
+        impl_->_gpuMeshBytes.fetch_sub(cache->gpuBytes, std::memory_order_relaxed);
+        impl_->_gpuMeshCount.fetch_sub(1, std::memory_order_relaxed);
+        delete cache;  // ComPtr releases the buffers
+    }
+    packet.opaque.clear();
+    packet.transparent.clear();
+    // Keep material entries (and their buffers) for reuse; drop only the references.
+    for (size_t i = 0; i < packet.materialCount; ++i) {
+        packet.materials[i].material = nullptr;
+        packet.materials[i].program.reset();
+    }
+    packet.materialCount = 0;
+    packet.lastMaterialIndex = 0;
+    packet.textures.clear();
+    packet.overrideArena.clear();
+    packet.instanceArena.clear();
+    packet.opaqueOrder.clear();
+    packet.transparentOrder.clear();
+    packet.stats = DrawStats{};
+}
 
-        DrawMesh(dc.mesh);
+void Renderer::PublishRecordedDraws() {
+    // The execute packet has finished (caller guarantees the render thread is idle), so
+    // caches retired while it was recording can no longer be referenced by any draw.
+    DrawPacket& executed = impl_->_drawPackets[impl_->_executePacket];
+    if (executed.stats.draws > 0) {
+        impl_->_lastDrawStats = executed.stats;
     }
+    ReleaseDrawPacket(executed);
+    SealDrawPacket(impl_->_drawPackets[impl_->_recordPacket]);
+    std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+    std::swap(impl_->_recordPacket, impl_->_executePacket);
+}
+
+void Renderer::SetPipelinedSubmission(bool enabled) {
+    impl_->_pipelinedSubmission = enabled;
+}
+
+bool Renderer::GetPipelinedSubmission() const {
+    return impl_->_pipelinedSubmission;
+}
+
+Renderer::DrawStats Renderer::GetDrawStats() const {
+    return impl_->_lastDrawStats;
 }
 
 void Renderer::FlushDraws() {
     if (!impl_->_initialized) return;
 
+    if (!impl_->_pipelinedSubmission) {
+        PublishRecordedDraws();
+    }
+    DrawPacket& packet = impl_->_drawPackets[impl_->_executePacket];
+
     // Ensure we're drawing to the main RT (quantization reads from it after resolve)
     impl_->_context->OMSetRenderTargets(1, impl_->_renderTargetView.GetAddressOf(), impl_->_depthStencilView.Get());
 
+    UploadPendingMeshes(packet);
+    UploadInstanceData(packet);
+    impl_->_boundMeshVB = nullptr;   // fullscreen passes rebind the IA between frames
+    impl_->_boundMeshIB = nullptr;
+
+    SortDrawPacket(packet);
+
     Renderer::DrawGpuState opaquePass;
     opaquePass.depthTest = true;
     opaquePass.depthWrite = true;
     opaquePass.blend = false;
 
-    SortOpaqueDraws();
-    ExecuteDrawList(impl_->_opaqueDraws, opaquePass);
+    ExecuteDrawList(packet, false, opaquePass);
 
     Renderer::DrawGpuState transparentPass;
     transparentPass.depthTest = true;
     transparentPass.depthWrite = false;
     transparentPass.blend = true;
 
-    SortTransparentDraws();
-    ExecuteDrawList(impl_->_transparentDraws, transparentPass);
+    ExecuteDrawList(packet, true, transparentPass);
+
+    PROFILE_PLOT("Renderer.Draws", static_cast<int64_t>(packet.stats.draws));
+    PROFILE_PLOT("Renderer.StateChanges", static_cast<int64_t>(packet.stats.stateChanges));
+    PROFILE_PLOT("Renderer.Instances", static_cast<int64_t>(packet.stats.instances));
+    PROFILE_PLOT("Renderer.QueueBytesAllocated", static_cast<int64_t>(packet.stats.bytesAllocated));
+
+    if (!impl_->_pipelinedSubmission) {
+        impl_->_lastDrawStats = packet.stats;
+    }
 }
 
 void Renderer::EndGpuFrame() {
@@ -206,7 +632,9 @@ void Renderer::EndGpuFrame() {
 
     {
         PROFILE_SCOPE("Renderer.EndGpuFrame.CopyResolved");
-        if (impl_->_supersample2x) {
+        if (impl_->_renderScale < 1.0f) {
+            RunRescalePass();
+        } else if (impl_->_supersample2x) {
             RunDownsamplePass();
         } else {
             impl_->_context->CopyResource(impl_->_resolvedTexture.Get(), impl_->_renderTarget.Get());
@@ -33,8 +33,8 @@ void Renderer::ApplyDrawState(const Renderer::DrawGpuState& desired) {
         // using scene geometry behind the HUD. Viewport MinDepth=MaxDepth=0 forces
         // written depth to 0 regardless of the mesh's clip-space Z.
         D3D11_VIEWPORT viewport = {};
-        viewport.Width = static_cast<float>(impl_->_renderTargetWidth);
-        viewport.Height = static_cast<float>(impl_->_renderTargetHeight);
+        viewport.Width = static_cast<float>(impl_->_viewportWidth);
+        viewport.Height = static_cast<float>(impl_->_viewportHeight);
         if (desired.depthTest) {
             viewport.MinDepth = 0.0f;
             viewport.MaxDepth = 1.0f;
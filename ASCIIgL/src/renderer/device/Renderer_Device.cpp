@@ -1,7 +1,8 @@
 #include <ASCIIgL/renderer/Renderer.hpp>
 
 #include <algorithm>              // std::clamp
-#include <cstring>                // strlen
+#include <cstring>                // strlen, memcpy
+#include <mutex>                  // std::lock_guard
 #include <sstream>                // std::ostringstream
 #include <stdexcept>
 #include <string>                 // std::wstring
@@ -51,6 +52,7 @@ void Renderer::Initialize(bool supersample2x, const wchar_t* charRamp, int charR
     const int scale = supersample2x ? 2 : 1;
     impl_->_renderTargetWidth = screenW * scale;
     impl_->_renderTargetHeight = screenH * scale;
+    SetRenderScale(impl_->_renderScale);  // recompute the active viewport for this RT size
 
     if (!LoadCharCoverageFromJson(charRamp, charRampCount)) {
         Logger::Error("[Renderer] Failed to load char coverage; coverage_cleartype.json is required.");
@@ -118,6 +120,11 @@ void Renderer::Initialize(bool supersample2x, const wchar_t* charRamp, int charR
         }
     }
 
+    if (!InitializeRescaleShader()) {
+        Logger::Error("[Renderer] Failed to initialize rescale shader");
+        return;
+    }
+
     if (!InitializeDebugSwapChain()) {
         Logger::Error("[Renderer] Failed to initialize debug swap chain (non-fatal)");
         // Non-fatal - continue without swap chain
@@ -197,6 +204,14 @@ bool Renderer::InitializeDevice() {
     std::string featureLevelStr = (featureLevel == D3D_FEATURE_LEVEL_11_1) ? "11.1" : "11.0";
     Logger::Info("[Renderer] Device created with feature level: " + featureLevelStr);
 
+    // 11.1 runtimes can patch a sub-range of a constant buffer, so material uploads copy only dirty registers.
+    D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+    if (SUCCEEDED(impl_->_context.As(&impl_->_context1)) &&
+        SUCCEEDED(impl_->_device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options)))) {
+        impl_->_cbPartialUpdate = options.ConstantBufferPartialUpdate == TRUE;
+    }
+    Logger::Info(std::string("[Renderer] Partial constant buffer updates: ") + (impl_->_cbPartialUpdate ? "yes" : "no"));
+
     return true;
 }
 
@@ -215,9 +230,8 @@ bool Renderer::InitializeRenderTarget() {
     texDesc.SampleDesc.Count = 1;
     texDesc.SampleDesc.Quality = 0;
     texDesc.Usage = D3D11_USAGE_DEFAULT;
-    texDesc.BindFlags = impl_->_supersample2x
-        ? (D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE)
-        : D3D11_BIND_RENDER_TARGET;
+    // Always sampleable: the SSAA resolve and the dynamic-resolution rescale both read it.
+    texDesc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
     texDesc.CPUAccessFlags = 0;
 
     impl_->_renderTarget.Reset();
@@ -240,24 +254,20 @@ bool Renderer::InitializeRenderTarget() {
         return false;
     }
 
-    if (impl_->_supersample2x) {
-        D3D11_SHADER_RESOURCE_VIEW_DESC rtSrvDesc = {};
-        rtSrvDesc.Format = texDesc.Format;
-        rtSrvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-        rtSrvDesc.Texture2D.MipLevels = 1;
-        rtSrvDesc.Texture2D.MostDetailedMip = 0;
-        hr = impl_->_device->CreateShaderResourceView(impl_->_renderTarget.Get(), &rtSrvDesc, &impl_->_renderTargetSRV);
-        if (FAILED(hr)) {
-            Logger::Error("[Renderer] Failed to create render target SRV");
-            return false;
-        }
+    D3D11_SHADER_RESOURCE_VIEW_DESC rtSrvDesc = {};
+    rtSrvDesc.Format = texDesc.Format;
+    rtSrvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+    rtSrvDesc.Texture2D.MipLevels = 1;
+    rtSrvDesc.Texture2D.MostDetailedMip = 0;
+    hr = impl_->_device->CreateShaderResourceView(impl_->_renderTarget.Get(), &rtSrvDesc, &impl_->_renderTargetSRV);
+    if (FAILED(hr)) {
+        Logger::Error("[Renderer] Failed to create render target SRV");
+        return false;
     }
 
     texDesc.Width = screenW;
     texDesc.Height = screenH;
-    texDesc.BindFlags = impl_->_supersample2x
-        ? (D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET)
-        : D3D11_BIND_SHADER_RESOURCE;
+    texDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
 
     impl_->_resolvedTexture.Reset();
     impl_->_resolvedTextureSRV.Reset();
@@ -270,12 +280,10 @@ bool Renderer::InitializeRenderTarget() {
         return false;
     }
 
-    if (impl_->_supersample2x) {
-        hr = impl_->_device->CreateRenderTargetView(impl_->_resolvedTexture.Get(), nullptr, &impl_->_resolvedTextureRTV);
-        if (FAILED(hr)) {
-            Logger::Error("[Renderer] Failed to create resolved texture RTV");
-            return false;
-        }
+    hr = impl_->_device->CreateRenderTargetView(impl_->_resolvedTexture.Get(), nullptr, &impl_->_resolvedTextureRTV);
+    if (FAILED(hr)) {
+        Logger::Error("[Renderer] Failed to create resolved texture RTV");
+        return false;
     }
 
     D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
@@ -762,6 +770,23 @@ float4 main(float4 pos : SV_Position) : SV_Target {
 }
 )";
 
+// Dynamic resolution: bilinear resample of the active top-left sub-rect of the render target
+// onto the screen-sized resolved texture. uvMax clamps taps to the last active texel centre so
+// the cleared border outside the sub-rect never bleeds into the right/bottom edge.
+const char* RESCALE_PS_SRC = R"(
+Texture2D<float4> g_source : register(t0);
+SamplerState      g_sam    : register(s0);
+
+cbuffer RescaleConstants : register(b0) {
+    float2 uvScale;
+    float2 uvMax;
+};
+
+float4 main(float4 pos : SV_Position, float2 uv : TEXCOORD0) : SV_Target {
+    return g_source.SampleLevel(g_sam, min(uv * uvScale, uvMax), 0);
+}
+)";
+
 } // namespace
 
 bool Renderer::InitializeQuantizationShaders() {
@@ -902,6 +927,61 @@ bool Renderer::InitializeDownsampleShader() {
     return true;
 }
 
+bool Renderer::InitializeRescaleShader() {
+    ID3DBlob* psBlob = nullptr;
+    ID3DBlob* errBlob = nullptr;
+    UINT flags = D3DCOMPILE_ENABLE_STRICTNESS;
+#ifdef _DEBUG
+    flags |= D3DCOMPILE_DEBUG;
+#endif
+    HRESULT hr = D3DCompile(RESCALE_PS_SRC, strlen(RESCALE_PS_SRC), nullptr, nullptr, nullptr,
+                           "main", "ps_5_0", flags, 0, &psBlob, &errBlob);
+    if (FAILED(hr)) {
+        if (errBlob) {
+            Logger::Error("[Renderer] Rescale PS compile: " + std::string(static_cast<const char*>(errBlob->GetBufferPointer())));
+            errBlob->Release();
+        }
+        return false;
+    }
+    if (errBlob) errBlob->Release();
+
+    hr = impl_->_device->CreatePixelShader(psBlob->GetBufferPointer(), psBlob->GetBufferSize(), nullptr, &impl_->_rescalePS);
+    psBlob->Release();
+    if (FAILED(hr)) {
+        Logger::Error("[Renderer] Failed to create rescale PS");
+        return false;
+    }
+
+    D3D11_BUFFER_DESC cbd = {};
+    cbd.ByteWidth = 4 * sizeof(float);
+    cbd.Usage = D3D11_USAGE_DYNAMIC;
+    cbd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    cbd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    hr = impl_->_device->CreateBuffer(&cbd, nullptr, &impl_->_rescaleCB);
+    if (FAILED(hr)) {
+        Logger::Error("[Renderer] Failed to create rescale constants buffer");
+        return false;
+    }
+
+    // _samplerLinear is point-filtered for pixel art; the rescale needs true bilinear taps.
+    D3D11_SAMPLER_DESC sampDesc = {};
+    sampDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+    sampDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+    sampDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+    sampDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+    sampDesc.MaxAnisotropy = 1;
+    sampDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
+    sampDesc.MinLOD = 0;
+    sampDesc.MaxLOD = D3D11_FLOAT32_MAX;
+    hr = impl_->_device->CreateSamplerState(&sampDesc, &impl_->_rescaleSampler);
+    if (FAILED(hr)) {
+        Logger::Error("[Renderer] Failed to create rescale sampler");
+        return false;
+    }
+
+    return true;
+}
+
 bool Renderer::EnsureQuantizationResources() {
     if (impl_->_colorLUTState == ColorLUTState::NotComputed) return false;
     if (impl_->_lutGpuResourcesDirty || !impl_->_lutConstantsCB ||
@@ -1053,6 +1133,65 @@ void Renderer::RunDownsamplePass() {
     InvalidateBoundState();
 }
 
+void Renderer::RunRescalePass() {
+    if (!impl_->_renderTargetSRV || !impl_->_resolvedTextureRTV || !impl_->_rescalePS ||
+        !impl_->_rescaleCB || !impl_->_rescaleSampler) {
+        Logger::Warning("[Renderer] RunRescalePass skipped: rescale resources missing.");
+        return;
+    }
+
+    InvalidateBoundState();
+
+    const int w = Screen::GetInst().GetWidth();
+    const int h = Screen::GetInst().GetHeight();
+    const float rtW = static_cast<float>(impl_->_renderTargetWidth);
+    const float rtH = static_cast<float>(impl_->_renderTargetHeight);
+
+    const float constants[4] = {
+        static_cast<float>(impl_->_viewportWidth) / rtW,
+        static_cast<float>(impl_->_viewportHeight) / rtH,
+        (static_cast<float>(impl_->_viewportWidth) - 0.5f) / rtW,
+        (static_cast<float>(impl_->_viewportHeight) - 0.5f) / rtH,
+    };
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    if (SUCCEEDED(impl_->_context->Map(impl_->_rescaleCB.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped))) {
+        memcpy(mapped.pData, constants, sizeof(constants));
+        impl_->_context->Unmap(impl_->_rescaleCB.Get(), 0);
+    }
+
+    impl_->_context->OMSetRenderTargets(1, impl_->_resolvedTextureRTV.GetAddressOf(), nullptr);
+    impl_->_context->OMSetDepthStencilState(impl_->_depthStencilStateNoTest.Get(), 0);
+    impl_->_context->RSSetState(impl_->_rasterizerStates[0].Get());
+    const float blendFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    impl_->_context->OMSetBlendState(impl_->_blendStateOpaque.Get(), blendFactor, 0xFFFFFFFF);
+
+    D3D11_VIEWPORT vp = {};
+    vp.Width = static_cast<float>(w);
+    vp.Height = static_cast<float>(h);
+    vp.MinDepth = 0.f;
+    vp.MaxDepth = 1.f;
+    impl_->_context->RSSetViewports(1, &vp);
+
+    impl_->_context->PSSetShaderResources(0, 1, impl_->_renderTargetSRV.GetAddressOf());
+    impl_->_context->PSSetSamplers(0, 1, impl_->_rescaleSampler.GetAddressOf());
+    impl_->_context->PSSetConstantBuffers(0, 1, impl_->_rescaleCB.GetAddressOf());
+    impl_->_context->VSSetShader(impl_->_quantizationVS.Get(), nullptr, 0);
+    impl_->_context->PSSetShader(impl_->_rescalePS.Get(), nullptr, 0);
+    impl_->_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    impl_->_context->IASetInputLayout(impl_->_quantizationInputLayout.Get());
+    UINT stride = 2 * sizeof(float);
+    UINT offset = 0;
+    impl_->_context->IASetVertexBuffers(0, 1, impl_->_fullscreenQuadVB.GetAddressOf(), &stride, &offset);
+
+    impl_->_context->Draw(6, 0);
+
+    ID3D11ShaderResourceView* nullSRV = nullptr;
+    impl_->_context->PSSetShaderResources(0, 1, &nullSRV);
+
+    impl_->_context->OMSetRenderTargets(1, impl_->_renderTargetView.GetAddressOf(), impl_->_depthStencilView.Get());
+    InvalidateBoundState();
+}
+
 void Renderer::RunQuantizationPass() {
     InvalidateBoundState();
 
@@ -1402,12 +1541,30 @@ void Renderer::Shutdown()
 {
     if (!impl_->_initialized) return;
 
+    // Neither packet executes again: free what they retired. Caches still owned by live meshes are
+    // freed by ReleaseMeshCache once _initialized is false.
+    for (auto& packet : impl_->_drawPackets) {
+        ReleaseDrawPacket(packet);
+        packet.pendingUploads.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+        impl_->_meshSlabs.clear();
+        impl_->_textureCache.clear();
+        impl_->_textureArrayCache.clear();
+        impl_->_initialized = false;
+    }
+    impl_->_instanceBuffer.Reset();
+    impl_->_instanceBufferBytes = 0;
+
     // Release all COM objects (ComPtr handles this automatically)
-    impl_->_textureCache.clear();
     impl_->_currentTextureSRV.Reset();
     impl_->_fullscreenQuadVB.Reset();
     impl_->_quantizationInputLayout.Reset();
     impl_->_downsamplePS.Reset();
+    impl_->_rescalePS.Reset();
+    impl_->_rescaleCB.Reset();
+    impl_->_rescaleSampler.Reset();
     impl_->_quantizationPS.Reset();
     impl_->_quantizationVS.Reset();
     impl_->_lutConstantsCB.Reset();
@@ -1461,10 +1618,10 @@ void Renderer::Shutdown()
     impl_->_renderTargetSRV.Reset();
     impl_->_resolvedTexture.Reset();
     impl_->_renderTarget.Reset();
+    impl_->_context1.Reset();
     impl_->_context.Reset();
     impl_->_device.Reset();
 
-    impl_->_initialized = false;
     Logger::Debug("[Renderer] Shutdown complete");
 }
 
@@ -114,7 +114,29 @@ void Material::SetUniform(const std::string& name, const UniformValue& value) {
 
 void Material::SetUniformInternal(const std::string& name, const UniformValue& value) {
     _uniformValues[name] = value;
-    _uniformsDirty = true;
+
+    const UniformDescriptor* desc = GetUniformDescriptor(name);
+    if (!desc) {
+        Logger::Warning("Uniform '" + name + "' not found in shader layout");
+        return;
+    }
+    std::visit([this, desc](const auto& val) {
+        WriteStaging(UniformHandle(desc), &val, sizeof(val));
+    }, value);
+}
+
+UniformHandle Material::GetUniformHandle(const std::string& name) const {
+    return UniformHandle(GetUniformDescriptor(name));
+}
+
+void Material::WriteStaging(UniformHandle handle, const void* data, std::size_t size) {
+    if (!handle.valid) return;
+
+    // Layout sizes are padded (a mat3 occupies three float4 registers), so copy only the value's bytes.
+    const std::size_t copySize = std::min<std::size_t>(handle.size, size);
+    if (handle.offset + copySize > _constantBufferData.size()) return;
+
+    std::memcpy(_constantBufferData.data() + handle.offset, data, copySize);
 }
 
 bool Material::HasUniform(const std::string& name) const {
@@ -135,13 +157,17 @@ const UniformDescriptor* Material::GetUniformDescriptor(const std::string& name)
 }
 
 void Material::ApplyUniformOverride(const UniformDescriptor& desc, const UniformValue& value) {
-    if (_constantBufferData.empty()) {
+    WriteUniformOverride(_constantBufferData, desc, value);
+}
+
+void Material::WriteUniformOverride(std::vector<std::byte>& buffer, const UniformDescriptor& desc, const UniformValue& value) {
+    if (buffer.empty()) {
         return;
     }
 
-    std::visit([this, &desc](const auto& val) {
-        if (desc.offset + desc.size <= _constantBufferData.size()) {
-            std::memcpy(_constantBufferData.data() + desc.offset, &val, desc.size);
+    std::visit([&buffer, &desc](const auto& val) {
+        if (desc.offset + desc.size <= buffer.size()) {
+            std::memcpy(buffer.data() + desc.offset, &val, desc.size);
         }
     }, value);
 }
@@ -150,6 +176,8 @@ void Material::ApplyUniformOverride(const UniformDescriptor& desc, const Uniform
 // Constant Buffer Data Packing
 // =========================================================================
 
+// Setters write through to the staging block, so this only has work to do after the layout
+// changed (SetShaderProgram / ResetConstantBufferData / Clone): repack the name-set values.
 void Material::UpdateConstantBufferData() {
     if (!_program || !_uniformsDirty) return;
     
@@ -158,17 +186,11 @@ void Material::UpdateConstantBufferData() {
     for (const auto& [name, value] : _uniformValues) {
         const UniformDescriptor* desc = layout.GetUniform(name);
         if (!desc) {
-            Logger::Warning("Uniform '" + name + "' not found in shader layout");
             continue;
         }
         
-        // Copy value to constant buffer data at the correct offset
-        std::visit([this, desc](auto&& val) {
-            using T = std::decay_t<decltype(val)>;
-            const std::size_t copySize = std::min<std::size_t>(desc->size, sizeof(T));
-            if (desc->offset + copySize <= _constantBufferData.size()) {
-                std::memcpy(_constantBufferData.data() + desc->offset, &val, copySize);
-            }
+        std::visit([this, desc](const auto& val) {
+            WriteStaging(UniformHandle(desc), &val, sizeof(val));
         }, value);
     }
     
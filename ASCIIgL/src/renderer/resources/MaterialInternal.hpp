@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include <d3d11.h>
 #include <wrl/client.h>
 
@@ -11,6 +14,8 @@ class Material::Impl {
 public:
     Microsoft::WRL::ComPtr<ID3D11Buffer> constantBuffer;
     bool constantBufferInitialized = false;
+    bool partialUpdates = false;         // DEFAULT usage, patched with UpdateSubresource1 (else DYNAMIC)
+    std::vector<std::byte> uploaded;     // render-thread copy of what constantBuffer currently holds
 };
 
 } // namespace ASCIIgL
@@ -1,8 +1,11 @@
 #include <ASCIIgL/renderer/Renderer.hpp>
 
+#include <algorithm>
+#include <mutex>
 #include <vector>
 #include <cstring>     // std::memcpy
 #include <sstream>     // std::ostringstream
+#include <string>
 
 #include <ASCIIgL/engine/Mesh.hpp>
 #include <ASCIIgL/engine/Texture.hpp>
@@ -24,6 +27,20 @@ Renderer::GPUMeshCache* Renderer::GetOrCreateMeshCache(const Mesh* mesh) {
     if (mesh->gpuBufferCache) {
         return static_cast<GPUMeshCache*>(mesh->gpuBufferCache);
     }
+
+    // Discarded after an earlier upload and its GPU cache released since (Mesh::ReleaseGpuCache):
+    // ask the owner to regenerate it (or skip this draw).
+    if (!mesh->HasCpuData() && !mesh->RebuildCpuData()) {
+        return nullptr;
+    }
+
+    if (mesh->IsPooled() && mesh->GetVertexCount() > 0 &&
+        mesh->GetVertexCount() <= MeshSlab::kVertices && mesh->GetIndexCount() <= MeshSlab::kIndices) {
+        if (GPUMeshCache* pooled = CreatePooledMeshCache(mesh)) {
+            return pooled;
+        }
+        // No slab could be created: fall back to dedicated buffers below.
+    }
     
     // Create new cache
     GPUMeshCache* cache = new GPUMeshCache();
@@ -47,12 +64,13 @@ Renderer::GPUMeshCache* Renderer::GetOrCreateMeshCache(const Mesh* mesh) {
             return nullptr;
         }
         cache->vertexCount = mesh->GetVertexCount();
+        cache->gpuBytes += vbDesc.ByteWidth;
     }
     
     // Create index buffer if mesh is indexed
-    if (!mesh->GetIndices().empty()) {
+    if (mesh->IsIndexed()) {
         D3D11_BUFFER_DESC ibDesc = {};
-        ibDesc.ByteWidth = sizeof(int) * mesh->GetIndices().size();
+        ibDesc.ByteWidth = static_cast<UINT>(sizeof(int) * mesh->GetIndexCount());
         ibDesc.Usage = D3D11_USAGE_IMMUTABLE;
         ibDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
         
@@ -67,25 +85,189 @@ Renderer::GPUMeshCache* Renderer::GetOrCreateMeshCache(const Mesh* mesh) {
             delete cache;
             return nullptr;
         }
-        cache->indexCount = mesh->GetIndices().size();
+        cache->indexCount = mesh->GetIndexCount();
+        cache->gpuBytes += ibDesc.ByteWidth;
     }
     
     // Store cache in mesh
     mesh->gpuBufferCache = cache;
+    impl_->_gpuMeshBytes.fetch_add(cache->gpuBytes, std::memory_order_relaxed);
+    impl_->_gpuMeshCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (mesh->GetResidency() == MeshResidency::DiscardAfterUpload) {
+        mesh->DiscardCpuData();
+    }
     
     return cache;
 }
 
+Renderer::GPUMeshCache* Renderer::CreatePooledMeshCache(const Mesh* mesh) {
+    const unsigned int stride = mesh->GetVertFormat().GetStride();
+    const uint32_t vertexCount = static_cast<uint32_t>(mesh->GetVertexCount());
+    const uint32_t indexCount = static_cast<uint32_t>(mesh->GetIndexCount());
+
+    MeshSlab* slab = nullptr;
+    uint32_t baseVertex = 0;
+    uint32_t firstIndex = 0;
+    {
+        std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+
+        const auto tryAllocate = [&](MeshSlab& candidate) {
+            const uint32_t v = candidate.vertices.Allocate(vertexCount);
+            if (v == RangeAllocator::kInvalidOffset) return false;
+            uint32_t i = 0;
+            if (indexCount > 0) {
+                i = candidate.indices.Allocate(indexCount);
+                if (i == RangeAllocator::kInvalidOffset) {
+                    candidate.vertices.Free(v, vertexCount);
+                    return false;
+                }
+            }
+            slab = &candidate;
+            baseVertex = v;
+            firstIndex = i;
+            return true;
+        };
+
+        for (auto& candidate : impl_->_meshSlabs) {
+            if (candidate->stride == stride && tryAllocate(*candidate)) break;
+        }
+
+        if (!slab) {
+            // Every slab of this stride is full (or too fragmented): add one. DEFAULT usage, written
+            // with UpdateSubresource on the render thread (see UploadPendingMeshes).
+            auto created = std::make_unique<MeshSlab>();
+            created->stride = stride;
+
+            D3D11_BUFFER_DESC vbDesc = {};
+            vbDesc.ByteWidth = stride * MeshSlab::kVertices;
+            vbDesc.Usage = D3D11_USAGE_DEFAULT;
+            vbDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+
+            D3D11_BUFFER_DESC ibDesc = {};
+            ibDesc.ByteWidth = sizeof(int) * MeshSlab::kIndices;
+            ibDesc.Usage = D3D11_USAGE_DEFAULT;
+            ibDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+
+            if (FAILED(impl_->_device->CreateBuffer(&vbDesc, nullptr, &created->vertexBuffer)) ||
+                FAILED(impl_->_device->CreateBuffer(&ibDesc, nullptr, &created->indexBuffer))) {
+                Logger::Error("[Renderer] Failed to create mesh slab buffers");
+                return nullptr;
+            }
+
+            impl_->_meshSlabs.push_back(std::move(created));
+            Logger::Info("[Renderer] Mesh slab " + std::to_string(impl_->_meshSlabs.size()) + " created (stride " +
+                         std::to_string(stride) + ", " +
+                         std::to_string((vbDesc.ByteWidth + ibDesc.ByteWidth) / (1024 * 1024)) + " MiB)");
+            tryAllocate(*impl_->_meshSlabs.back());
+        }
+    }
+
+    GPUMeshCache* cache = new GPUMeshCache();
+    cache->slab = slab;
+    cache->vertexBuffer = slab->vertexBuffer;
+    cache->indexBuffer = indexCount > 0 ? slab->indexBuffer : nullptr;
+    cache->vertexCount = vertexCount;
+    cache->indexCount = indexCount;
+    cache->baseVertex = baseVertex;
+    cache->firstIndex = firstIndex;
+    cache->gpuBytes = static_cast<size_t>(vertexCount) * stride + static_cast<size_t>(indexCount) * sizeof(int);
+
+    // The data reaches the slab when this packet executes; discarded meshes hand over their vectors.
+    PendingMeshUpload upload;
+    upload.slab = slab;
+    upload.baseVertex = baseVertex;
+    upload.firstIndex = firstIndex;
+    if (mesh->GetResidency() == MeshResidency::DiscardAfterUpload) {
+        mesh->TakeCpuData(upload.vertices, upload.indices);
+    } else {
+        upload.vertices = mesh->GetVertices();
+        upload.indices = mesh->GetIndices();
+    }
+    {
+        std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+        impl_->_drawPackets[impl_->_recordPacket].pendingUploads.push_back(std::move(upload));
+    }
+
+    mesh->gpuBufferCache = cache;
+    impl_->_gpuMeshBytes.fetch_add(cache->gpuBytes, std::memory_order_relaxed);
+    impl_->_gpuMeshCount.fetch_add(1, std::memory_order_relaxed);
+    return cache;
+}
+
+void Renderer::UploadPendingMeshes(DrawPacket& packet) {
+    std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+    for (PendingMeshUpload& upload : packet.pendingUploads) {
+        const UINT stride = upload.slab->stride;
+        const D3D11_BOX vbBox = {
+            upload.baseVertex * stride, 0, 0,
+            upload.baseVertex * stride + static_cast<UINT>(upload.vertices.size()), 1, 1
+        };
+        impl_->_context->UpdateSubresource(upload.slab->vertexBuffer.Get(), 0, &vbBox, upload.vertices.data(), 0, 0);
+
+        if (!upload.indices.empty()) {
+            const D3D11_BOX ibBox = {
+                upload.firstIndex * static_cast<UINT>(sizeof(int)), 0, 0,
+                static_cast<UINT>((upload.firstIndex + upload.indices.size()) * sizeof(int)), 1, 1
+            };
+            impl_->_context->UpdateSubresource(upload.slab->indexBuffer.Get(), 0, &ibBox, upload.indices.data(), 0, 0);
+        }
+    }
+    packet.pendingUploads.clear();
+}
+
 void Renderer::ReleaseMeshCache(void* cachePtr) {
     if (!cachePtr) return;
     
+    // Queued draws hold the cache, not the Mesh: defer the delete until the packet being
+    // recorded (and the one executing before it) has run. See PublishRecordedDraws.
     GPUMeshCache* cache = static_cast<GPUMeshCache*>(cachePtr);
-    delete cache;  // ComPtr automatically releases buffers
+    {
+        std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+        if (impl_->_initialized) {
+            impl_->_drawPackets[impl_->_recordPacket].retiredCaches.push_back(cache);
+            return;
+        }
+    }
+
+    // After Shutdown no packet runs again (and the slabs are gone): free it now.
+    impl_->_gpuMeshBytes.fetch_sub(cache->gpuBytes, std::memory_order_relaxed);
+    impl_->_gpuMeshCount.fetch_sub(1, std::memory_order_relaxed);
+    delete cache;
+}
+
+Renderer::MeshArenaStats Renderer::GetMeshArenaStats() const {
+    MeshArenaStats stats;
+    std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+    for (const auto& slab : impl_->_meshSlabs) {
+        const RangeAllocator::Stats v = slab->vertices.GetStats();
+        const RangeAllocator::Stats i = slab->indices.GetStats();
+        ++stats.slabs;
+        stats.meshes += v.allocations;
+        stats.vertexBytesUsed += static_cast<size_t>(v.used) * slab->stride;
+        stats.vertexBytesCapacity += static_cast<size_t>(v.capacity) * slab->stride;
+        stats.indexBytesUsed += static_cast<size_t>(i.used) * sizeof(int);
+        stats.indexBytesCapacity += static_cast<size_t>(i.capacity) * sizeof(int);
+        stats.freeBlocks += v.freeBlocks + i.freeBlocks;
+        stats.vertexFragmentation = std::max(stats.vertexFragmentation, v.Fragmentation());
+        stats.indexFragmentation = std::max(stats.indexFragmentation, i.Fragmentation());
+    }
+    return stats;
+}
+
+Renderer::MeshMemoryStats Renderer::GetMeshMemoryStats() const {
+    MeshMemoryStats stats;
+    stats.cpuBytes = Mesh::GetTotalCpuBytes();
+    stats.gpuBytes = impl_->_gpuMeshBytes.load(std::memory_order_relaxed);
+    stats.gpuMeshes = impl_->_gpuMeshCount.load(std::memory_order_relaxed);
+    return stats;
 }
 
 void Renderer::InvalidateCachedTexture(const Texture* tex) {
     if (!tex) return;
-    
+
+    // Called from the simulation thread while the render thread may be in BindTexture.
+    std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
     auto it = impl_->_textureCache.find(tex);
     if (it != impl_->_textureCache.end()) {
         impl_->_textureCache.erase(it);
@@ -199,40 +381,44 @@ bool Renderer::CreateTextureFromASCIIgLTexture(const Texture* tex, ID3D11ShaderR
     return true;
 }
 
-void Renderer::BindTexture(const Texture* tex, int slot, SamplerType type) {
+bool Renderer::BindTexture(const Texture* tex, int slot, SamplerType type) {
     if (!impl_->_initialized) {
         UnbindTexture(slot);
-        return;
+        return false;
     }
 
     if (!tex) {
         UnbindTexture(slot);
-        return;
+        return false;
     }
 
-    // Check cache
-    ID3D11ShaderResourceView* srv = nullptr;
-    auto it = impl_->_textureCache.find(tex);
-    if (it != impl_->_textureCache.end()) {
-        srv = it->second.Get();
-    } else {
-        ComPtr<ID3D11ShaderResourceView> newSRV;
-        if (!CreateTextureFromASCIIgLTexture(tex, &newSRV)) {
+    // Check cache. The lock covers only the lookup/insert (InvalidateCachedTexture may run on the
+    // simulation thread); the upload itself only ever happens on the executing thread.
+    ComPtr<ID3D11ShaderResourceView> srv;
+    {
+        std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+        auto it = impl_->_textureCache.find(tex);
+        if (it != impl_->_textureCache.end()) srv = it->second;
+    }
+    if (!srv) {
+        if (!CreateTextureFromASCIIgLTexture(tex, &srv)) {
             Logger::Warning("[Renderer] Failed to upload texture to GPU (slot " + std::to_string(slot) + ")");
             UnbindTexture(slot);
-            return;
+            return false;
         }
-        srv = newSRV.Get();
-        impl_->_textureCache[tex] = newSRV;
+        std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+        impl_->_textureCache[tex] = srv;
     }
 
-    impl_->_context->PSSetShaderResources(slot, 1, &srv);
+    ID3D11ShaderResourceView* rawSRV = srv.Get();
+    impl_->_context->PSSetShaderResources(slot, 1, &rawSRV);
     impl_->_currentTextureSRV = srv;
 
     // Resolve Default: single texture → Point
     SamplerType resolved = (type == SamplerType::Default) ? SamplerType::Point : type;
     ID3D11SamplerState* sampler = (resolved == SamplerType::Anisotropic) ? impl_->_samplerAnisotropic.Get() : impl_->_samplerLinear.Get();
     impl_->_context->PSSetSamplers(slot, 1, &sampler);
+    return true;
 }
 
 void Renderer::UnbindTexture(int slot) {
@@ -244,6 +430,11 @@ void Renderer::UnbindTexture(int slot) {
 
 bool Renderer::CreateTextureArraySRV(const TextureArray* texArray, ID3D11ShaderResourceView** srv) {
     if (!texArray || !texArray->IsValid()) return false;
+    if (!texArray->HasCpuData()) {
+        // TextureLibrary::UpdateResidency reloads released pixels once it sees the SRV is gone.
+        Logger::Warning("[Renderer] Texture array pixels are released; waiting for a reload to recreate its SRV");
+        return false;
+    }
 
     const int layerCount = texArray->GetLayerCount();
     const int tileSize   = texArray->GetTileSize();
@@ -338,35 +529,47 @@ bool Renderer::CreateTextureArraySRV(const TextureArray* texArray, ID3D11ShaderR
     return true;
 }
 
-void Renderer::BindTextureArray(const TextureArray* texArray, int slot, SamplerType type) {
+bool Renderer::HasTextureArraySRV(const TextureArray* texArray) const {
+    std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+    return impl_->_textureArrayCache.find(texArray) != impl_->_textureArrayCache.end();
+}
+
+bool Renderer::BindTextureArray(const TextureArray* texArray, int slot, SamplerType type) {
     if (!impl_->_initialized || !texArray || !texArray->IsValid()) {
         UnbindTextureArray(slot);
-        return;
+        return false;
     }
 
     ComPtr<ID3D11ShaderResourceView> srv;
-
-    auto it = impl_->_textureArrayCache.find(texArray);
-    if (it != impl_->_textureArrayCache.end()) {
-        srv = it->second;
-    } else {
+    {
+        std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
+        auto it = impl_->_textureArrayCache.find(texArray);
+        if (it != impl_->_textureArrayCache.end()) srv = it->second;
+    }
+    if (!srv) {
         ID3D11ShaderResourceView* rawSRV = nullptr;
         if (CreateTextureArraySRV(texArray, &rawSRV)) {
             srv.Attach(rawSRV);
+            std::lock_guard<std::mutex> lock(impl_->_meshCacheMutex);
             impl_->_textureArrayCache[texArray] = srv;
         }
     }
 
-    if (srv) {
-        impl_->_currentTextureSRV = srv;
-        ID3D11ShaderResourceView* srvs[] = { srv.Get() };
-        impl_->_context->PSSetShaderResources(slot, 1, srvs);
-
-        // Resolve Default: texture array → Point
-        SamplerType resolved = (type == SamplerType::Default) ? SamplerType::Point : type;
-        ID3D11SamplerState* sampler = (resolved == SamplerType::Anisotropic) ? impl_->_samplerAnisotropic.Get() : impl_->_samplerLinear.Get();
-        impl_->_context->PSSetSamplers(slot, 1, &sampler);
+    // A failed upload must not leave the previous SRV on the register.
+    if (!srv) {
+        UnbindTextureArray(slot);
+        return false;
     }
+
+    impl_->_currentTextureSRV = srv;
+    ID3D11ShaderResourceView* srvs[] = { srv.Get() };
+    impl_->_context->PSSetShaderResources(slot, 1, srvs);
+
+    // Resolve Default: texture array → Point
+    SamplerType resolved = (type == SamplerType::Default) ? SamplerType::Point : type;
+    ID3D11SamplerState* sampler = (resolved == SamplerType::Anisotropic) ? impl_->_samplerAnisotropic.Get() : impl_->_samplerLinear.Get();
+    impl_->_context->PSSetSamplers(slot, 1, &sampler);
+    return true;
 }
 
 void Renderer::UnbindTextureArray(int slot) {
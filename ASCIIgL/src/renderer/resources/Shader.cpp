@@ -370,10 +370,17 @@ bool ShaderProgram::CreateInputLayout(const VertFormat& format) {
         desc.SemanticName = GetSemanticName(element.GetSemantic());
         desc.SemanticIndex = element.GetSemanticIndex();
         desc.Format = GetDXGIFormat(element.GetType());
-        desc.InputSlot = 0;
         desc.AlignedByteOffset = element.GetOffset();
-        desc.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
-        desc.InstanceDataStepRate = 0;
+        if (element.IsPerInstance()) {
+            // Second stream, bound by the renderer for instanced draws.
+            desc.InputSlot = 1;
+            desc.InputSlotClass = D3D11_INPUT_PER_INSTANCE_DATA;
+            desc.InstanceDataStepRate = 1;
+        } else {
+            desc.InputSlot = 0;
+            desc.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
+            desc.InstanceDataStepRate = 0;
+        }
         
         inputDesc.push_back(desc);
     }
@@ -18,6 +18,7 @@
 
 // ASCIIgL includes
 #include <ASCIIgL/util/Logger.hpp>
+#include <ASCIIgL/util/Profiler.hpp>
 
 #include <ASCIIgL/renderer/screen/ScreenImpl.hpp>
 #include <ASCIIgL/renderer/screen/ScreenTerminalImpl.hpp>
@@ -84,6 +85,8 @@ int Screen::Initialize(
 
     Logger::Debug(L"Deleting old buffers and creating new ones.");
     // Note: Pixel buffer is created in impl-specific Initialize (ScreenTerminalImpl or ScreenWindowImpl)
+    // Tile tracking uses the (possibly clamped) dimensions the backend settled on.
+    _dirtyTiles.Resize(_screen_width, _screen_height);
 
     Logger::Debug(L"Clearing buffers for first draw.");
     ClearPixelBuffer();
@@ -107,7 +110,24 @@ void Screen::ClearPixelBuffer() {
 }
 
 void Screen::OutputBuffer() {
-    _impl->OutputBuffer();
+    // Window mode presents from the GPU; the CPU pixel buffer is unused there, so skip hashing.
+    if (_renderToTerminal) {
+        PROFILE_SCOPE("Screen.OutputBuffer.DirtyTiles");
+        if (_impl->ConsumeOutputInvalidated()) {
+            InvalidateOutput();
+        }
+        _dirtyTiles.Update(_impl->GetPixelBufferData());
+    }
+    PROFILE_PLOT("Screen.ChangedCellRatio", _dirtyTiles.GetChangedCellRatio());
+    _impl->OutputBuffer(_dirtyTiles);
+}
+
+void Screen::InvalidateOutput() {
+    _dirtyTiles.InvalidateAll();
+}
+
+float Screen::GetChangedCellRatio() const {
+    return _dirtyTiles.GetChangedCellRatio();
 }
 
 void Screen::PlotPixel(const glm::vec2& p, wchar_t character, unsigned short Colour) {
@@ -0,0 +1,133 @@
+#include <ASCIIgL/renderer/screen/ScreenDirtyTiles.hpp>
+
+#include <algorithm>
+
+namespace ASCIIgL {
+
+namespace {
+
+constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ull;
+constexpr uint64_t HASH_MUL = 0x9E3779B97F4A7C15ull;
+
+inline uint64_t MixCell(uint64_t h, const ScreenPixel& p) {
+    const uint64_t v = static_cast<uint64_t>(static_cast<uint32_t>(p.glyph))
+                     | (static_cast<uint64_t>(p.attributes) << 32);
+    h = (h ^ v) * HASH_MUL;
+    return h ^ (h >> 29);
+}
+
+} // namespace
+
+void ScreenDirtyTiles::Resize(unsigned int width, unsigned int height) {
+    _width = width;
+    _height = height;
+    _tilesX = static_cast<int>((width + TILE_SIZE - 1) / TILE_SIZE);
+    _tilesY = static_cast<int>((height + TILE_SIZE - 1) / TILE_SIZE);
+
+    const size_t tileCount = static_cast<size_t>(_tilesX) * static_cast<size_t>(_tilesY);
+    _tileHashes.assign(tileCount, 0);
+    _dirtyFlags.assign(tileCount, 1);
+    _dirtyTileCount = tileCount;
+    _changedCellRatio = 1.0f;
+    _forceFull = true;
+}
+
+void ScreenDirtyTiles::InvalidateAll() {
+    _forceFull = true;
+}
+
+size_t ScreenDirtyTiles::TileCellCount(int tx, int ty) const {
+    const int x0 = tx * TILE_SIZE;
+    const int y0 = ty * TILE_SIZE;
+    const int w = std::min(TILE_SIZE, static_cast<int>(_width) - x0);
+    const int h = std::min(TILE_SIZE, static_cast<int>(_height) - y0);
+    return static_cast<size_t>(w) * static_cast<size_t>(h);
+}
+
+uint64_t ScreenDirtyTiles::HashTile(const ScreenPixel* pixels, int tx, int ty) const {
+    const int x0 = tx * TILE_SIZE;
+    const int y0 = ty * TILE_SIZE;
+    const int x1 = std::min(x0 + TILE_SIZE, static_cast<int>(_width));
+    const int y1 = std::min(y0 + TILE_SIZE, static_cast<int>(_height));
+
+    uint64_t h = HASH_SEED;
+    for (int y = y0; y < y1; ++y) {
+        const ScreenPixel* row = pixels + static_cast<size_t>(y) * _width;
+        for (int x = x0; x < x1; ++x) {
+            h = MixCell(h, row[x]);
+        }
+    }
+    return h;
+}
+
+void ScreenDirtyTiles::Update(const ScreenPixel* pixels) {
+    if (!pixels || _tileHashes.empty()) {
+        _dirtyTileCount = 0;
+        _changedCellRatio = 0.0f;
+        return;
+    }
+
+    size_t dirtyTiles = 0;
+    size_t dirtyCells = 0;
+    for (int ty = 0; ty < _tilesY; ++ty) {
+        for (int tx = 0; tx < _tilesX; ++tx) {
+            const size_t idx = static_cast<size_t>(ty) * _tilesX + tx;
+            const uint64_t h = HashTile(pixels, tx, ty);
+            const bool dirty = _forceFull || h != _tileHashes[idx];
+            _tileHashes[idx] = h;
+            _dirtyFlags[idx] = dirty ? 1 : 0;
+            if (dirty) {
+                ++dirtyTiles;
+                dirtyCells += TileCellCount(tx, ty);
+            }
+        }
+    }
+
+    _forceFull = false;
+    _dirtyTileCount = dirtyTiles;
+    const size_t totalCells = static_cast<size_t>(_width) * static_cast<size_t>(_height);
+    _changedCellRatio = totalCells > 0 ? static_cast<float>(dirtyCells) / static_cast<float>(totalCells) : 0.0f;
+}
+
+void ScreenDirtyTiles::BuildDirtyRects(const std::vector<uint8_t>& flags, std::vector<ScreenRect>& outRects) const {
+    outRects.clear();
+    if (flags.size() != _dirtyFlags.size()) return;
+
+    // Indices of rects whose bottom edge is the previous tile row; a run with the same
+    // horizontal span on the current row extends one of them instead of starting a new rect.
+    std::vector<size_t> open;
+    std::vector<size_t> nextOpen;
+    for (int ty = 0; ty < _tilesY; ++ty) {
+        nextOpen.clear();
+        const int top = ty * TILE_SIZE;
+        const int bottom = std::min(top + TILE_SIZE, static_cast<int>(_height)) - 1;
+        const uint8_t* rowFlags = flags.data() + static_cast<size_t>(ty) * _tilesX;
+
+        size_t openCursor = 0;
+        int tx = 0;
+        while (tx < _tilesX) {
+            if (!rowFlags[tx]) { ++tx; continue; }
+            const int runStart = tx;
+            while (tx < _tilesX && rowFlags[tx]) ++tx;
+
+            const int left = runStart * TILE_SIZE;
+            const int right = std::min(tx * TILE_SIZE, static_cast<int>(_width)) - 1;
+
+            // Open rects are ordered left to right, as are the runs on this row.
+            while (openCursor < open.size() && outRects[open[openCursor]].left < left) ++openCursor;
+            if (openCursor < open.size() && outRects[open[openCursor]].left == left
+                && outRects[open[openCursor]].right == right) {
+                outRects[open[openCursor]].bottom = bottom;
+                nextOpen.push_back(open[openCursor]);
+                ++openCursor;
+            } else {
+                nextOpen.push_back(outRects.size());
+                outRects.push_back(ScreenRect{ left, top, right, bottom });
+            }
+        }
+
+        std::swap(open, nextOpen);
+    }
+}
+
+} // namespace ASCIIgL
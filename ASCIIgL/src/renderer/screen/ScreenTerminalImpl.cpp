@@ -156,6 +156,13 @@ int ScreenTerminalImpl::Initialize(const unsigned int width, const unsigned int
     Logger::Debug(L"Setting active console screen buffer.");
     SetConsoleActiveScreenBuffer(_hOutput);
 
+    CONSOLE_SCREEN_BUFFER_INFO settled;
+    if (GetConsoleScreenBufferInfo(_hOutput, &settled)) {
+        _lastConsoleSize = settled.dwSize;
+        _lastConsoleWindow = settled.srWindow;
+    }
+    _lastResizePoll = std::chrono::steady_clock::now();
+
     Logger::Debug(L"Creating pixel buffer.");
 	_pixelBuffer.resize(adjustedWidth * adjustedHeight);
     _presentBuffer.resize(_pixelBuffer.size());
@@ -172,18 +179,54 @@ void ScreenTerminalImpl::ClearPixelBuffer() {
     std::fill(_pixelBuffer.begin(), _pixelBuffer.end(), CHAR_INFO{L' ', 0x00});
 }
 
-void ScreenTerminalImpl::OutputBuffer() {
+void ScreenTerminalImpl::OutputBuffer(const ScreenDirtyTiles& dirtyTiles) {
+    // Nothing changed since the last frame: skip the copy and the console RPC entirely.
+    if (!dirtyTiles.AnyDirty()) {
+        return;
+    }
+
     // Hand the completed frame to the presenter thread and return immediately.
     // If the presenter is still writing the previous frame, the pending (not yet
     // picked up) frame is overwritten: the game never blocks on the console.
     {
         std::lock_guard<std::mutex> lock(_presentMutex);
         std::memcpy(_presentBuffer.data(), _pixelBuffer.data(), _pixelBuffer.size() * sizeof(CHAR_INFO));
+
+        const std::vector<uint8_t>& flags = dirtyTiles.GetDirtyFlags();
+        if (_pendingDirtyTiles.size() != flags.size()) {
+            _pendingDirtyTiles.assign(flags.size(), 1);
+        } else {
+            for (size_t i = 0; i < flags.size(); ++i) {
+                _pendingDirtyTiles[i] |= flags[i];
+            }
+        }
+        _dirtyTileLayout = &dirtyTiles;
         _framePending = true;
     }
     _presentCV.notify_one();
 }
 
+bool ScreenTerminalImpl::ConsumeOutputInvalidated() {
+    const auto now = std::chrono::steady_clock::now();
+    if (now - _lastResizePoll < RESIZE_POLL_INTERVAL) {
+        return false;
+    }
+    _lastResizePoll = now;
+
+    // Resizing the terminal window reflows or clears the console buffer, so cells the dirty
+    // tiles consider unchanged may no longer be on screen.
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    if (!GetConsoleScreenBufferInfo(_hOutput, &csbi)) {
+        return false;
+    }
+    const bool resized = csbi.dwSize.X != _lastConsoleSize.X || csbi.dwSize.Y != _lastConsoleSize.Y ||
+                         csbi.srWindow.Left != _lastConsoleWindow.Left || csbi.srWindow.Top != _lastConsoleWindow.Top ||
+                         csbi.srWindow.Right != _lastConsoleWindow.Right || csbi.srWindow.Bottom != _lastConsoleWindow.Bottom;
+    _lastConsoleSize = csbi.dwSize;
+    _lastConsoleWindow = csbi.srWindow;
+    return resized;
+}
+
 void ScreenTerminalImpl::PresenterLoop() {
     for (;;) {
         {
@@ -193,13 +236,34 @@ void ScreenTerminalImpl::PresenterLoop() {
                 return;
             }
             std::swap(_writeBuffer, _presentBuffer);
+            _writeDirtyTiles.assign(_pendingDirtyTiles.begin(), _pendingDirtyTiles.end());
+            std::fill(_pendingDirtyTiles.begin(), _pendingDirtyTiles.end(), uint8_t{0});
+            if (_dirtyTileLayout) {
+                // Tile grid dimensions are fixed after Screen::Initialize, so reading the
+                // layout outside the lock is safe; only the flags copied above are per-frame.
+                _dirtyTileLayout->BuildDirtyRects(_writeDirtyTiles, _writeRects);
+            } else {
+                _writeRects.clear();
+            }
             _framePending = false;
         }
 
-        // WriteConsoleOutputW may clip the write region in-place; pass a copy so the
-        // shared rcRegion stays intact.
-        SMALL_RECT region = rcRegion;
-        WriteConsoleOutputW(_hOutput, _writeBuffer.data(), dwBufferSize, dwBufferCoord, &region);
+        if (_writeRects.empty()) {
+            // No tile layout yet: fall back to a full-buffer write.
+            // WriteConsoleOutputW may clip the write region in-place; pass a copy so the
+            // shared rcRegion stays intact.
+            SMALL_RECT region = rcRegion;
+            WriteConsoleOutputW(_hOutput, _writeBuffer.data(), dwBufferSize, dwBufferCoord, &region);
+            continue;
+        }
+
+        // Sub-rect writes: the source buffer stays full-size and dwBufferCoord selects the
+        // rect's origin inside it, so only changed cells cross into the console host.
+        for (const ScreenRect& r : _writeRects) {
+            SMALL_RECT region = { SHORT(r.left), SHORT(r.top), SHORT(r.right), SHORT(r.bottom) };
+            const COORD srcCoord = { SHORT(r.left), SHORT(r.top) };
+            WriteConsoleOutputW(_hOutput, _writeBuffer.data(), dwBufferSize, srcCoord, &region);
+        }
     }
 }
 
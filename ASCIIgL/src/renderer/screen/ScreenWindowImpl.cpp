@@ -152,7 +152,8 @@ void ScreenWindowImpl::ClearPixelBuffer() {
     if (!warned) { Logger::Warning(L"ScreenWindowImpl: pixel buffer not used in window mode."); warned = true; }
 }
 
-void ScreenWindowImpl::OutputBuffer() {
+void ScreenWindowImpl::OutputBuffer(const ScreenDirtyTiles& dirtyTiles) {
+    (void)dirtyTiles;
     // Stub: no presentation to window yet (GPU ASCII pass or GDI blit can be added later)
 }
 
@@ -0,0 +1,99 @@
+#include <ASCIIgL/util/CpuFeatures.hpp>
+
+#include <atomic>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace ASCIIgL {
+
+namespace {
+
+std::atomic<int> g_simdLimit{static_cast<int>(SimdLevel::AVX2)};
+
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+void Cpuid(int leaf, int subleaf, int regs[4]) {
+#if defined(_MSC_VER)
+    __cpuidex(regs, leaf, subleaf);
+#else
+    unsigned int a = 0, b = 0, c = 0, d = 0;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    regs[0] = static_cast<int>(a);
+    regs[1] = static_cast<int>(b);
+    regs[2] = static_cast<int>(c);
+    regs[3] = static_cast<int>(d);
+#endif
+}
+
+unsigned long long ReadXcr0() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned int lo = 0, hi = 0;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (static_cast<unsigned long long>(hi) << 32) | lo;
+#endif
+}
+
+CpuFeatures Detect() {
+    CpuFeatures features;
+    int regs[4] = {};
+    Cpuid(0, 0, regs);
+    const int maxLeaf = regs[0];
+    if (maxLeaf < 1) return features;
+
+    Cpuid(1, 0, regs);
+    features.sse2 = (regs[3] & (1 << 26)) != 0;
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    const bool avx = (regs[2] & (1 << 28)) != 0;
+    // The OS must save YMM state on context switch (XCR0 bits 1 and 2) before AVX code is safe.
+    const bool ymmEnabled = osxsave && (ReadXcr0() & 0x6) == 0x6;
+
+    if (maxLeaf >= 7 && avx && ymmEnabled) {
+        Cpuid(7, 0, regs);
+        features.avx2 = (regs[1] & (1 << 5)) != 0;
+    }
+    return features;
+}
+#else
+CpuFeatures Detect() { return CpuFeatures{}; }
+#endif
+
+} // namespace
+
+const CpuFeatures& CpuFeatures::Get() {
+    static const CpuFeatures features = Detect();
+    return features;
+}
+
+SimdLevel GetSimdLevel() {
+    const CpuFeatures& cpu = CpuFeatures::Get();
+    const int limit = g_simdLimit.load(std::memory_order_relaxed);
+
+#if defined(__AVX2__)
+    if (limit >= static_cast<int>(SimdLevel::AVX2) && cpu.avx2) return SimdLevel::AVX2;
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    if (limit >= static_cast<int>(SimdLevel::SSE2) && cpu.sse2) return SimdLevel::SSE2;
+#endif
+    (void)cpu;
+    (void)limit;
+    return SimdLevel::Scalar;
+}
+
+void SetSimdLevelLimit(SimdLevel limit) {
+    g_simdLimit.store(static_cast<int>(limit), std::memory_order_relaxed);
+}
+
+const char* ToString(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SSE2: return "SSE2";
+        default:              return "scalar";
+    }
+}
+
+} // namespace ASCIIgL
@@ -1 +1,80 @@
 #include <ASCIIgL/util/EventBus.hpp>
+
+namespace ASCIIgL {
+
+namespace detail {
+
+std::size_t NextEventTypeId() {
+    static std::atomic<std::size_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+void EventBus::clear() {
+    for (IBuffer* buf : m_touched) {
+        buf->clearCurrent();
+        buf->touched = false;
+    }
+    for (IBuffer* buf : m_stale) {
+        buf->clearPrevious();
+    }
+    m_touched.clear();
+    m_stale.clear();
+}
+
+void EventBus::endFrame() {
+    if (m_buffering == Buffering::Single) {
+        for (IBuffer* buf : m_touched) {
+            buf->clearCurrent();
+            buf->touched = false;
+        }
+        m_touched.clear();
+    } else {
+        // Last frame's events expire, this frame's become "previous"; no element is copied.
+        for (IBuffer* buf : m_stale) {
+            buf->clearPrevious();
+        }
+        for (IBuffer* buf : m_touched) {
+            buf->rotate();
+            buf->touched = false;
+        }
+        m_stale.swap(m_touched);
+        m_touched.clear();
+    }
+
+    flushConcurrent();
+}
+
+void EventBus::flushConcurrent() {
+    if (!m_hasStaged.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_stagedMutex);
+    for (const std::size_t id : m_stagedTouched) {
+        IBuffer& src = *m_staged[id];
+        IBuffer& dst = getOrCreateBufferFor(id, src);
+        if (!dst.touched) {
+            dst.touched = true;
+            m_touched.push_back(&dst);
+        }
+        src.drainInto(dst);
+        src.touched = false;
+    }
+    m_stagedTouched.clear();
+    m_hasStaged.store(false, std::memory_order_release);
+}
+
+EventBus::IBuffer& EventBus::getOrCreateBufferFor(std::size_t id, const IBuffer& prototype) {
+    if (id >= m_buffers.size()) {
+        m_buffers.resize(id + 1);
+    }
+    auto& slot = m_buffers[id];
+    if (!slot) {
+        slot = prototype.makeEmpty();
+    }
+    return *slot;
+}
+
+} // namespace ASCIIgL
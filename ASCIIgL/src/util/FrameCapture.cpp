@@ -0,0 +1,158 @@
+#include <ASCIIgL/util/FrameCapture.hpp>
+
+#include <ASCIIgL/util/Logger.hpp>
+
+namespace ASCIIgL {
+
+namespace {
+
+template <typename T>
+void WritePod(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadPod(std::ifstream& in, T& value) {
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return static_cast<bool>(in);
+}
+
+void WriteVec3(std::ofstream& out, const glm::vec3& v) {
+    WritePod(out, v.x);
+    WritePod(out, v.y);
+    WritePod(out, v.z);
+}
+
+bool ReadVec3(std::ifstream& in, glm::vec3& v) {
+    return ReadPod(in, v.x) && ReadPod(in, v.y) && ReadPod(in, v.z);
+}
+
+} // namespace
+
+// =============================================================================
+// Writer
+// =============================================================================
+
+bool FrameCaptureWriter::Open(const std::string& path, unsigned int width, unsigned int height) {
+    Close();
+    _file.open(path, std::ios::binary | std::ios::trunc);
+    if (!_file.is_open()) {
+        Logger::Error("FrameCapture: failed to open '" + path + "' for writing.");
+        return false;
+    }
+
+    _width = width;
+    _height = height;
+    _frameCount = 0;
+
+    WritePod(_file, FrameCapture::MAGIC);
+    WritePod(_file, FrameCapture::VERSION);
+    WritePod(_file, static_cast<uint32_t>(width));
+    WritePod(_file, static_cast<uint32_t>(height));
+
+    Logger::Info("FrameCapture: recording " + std::to_string(width) + "x" + std::to_string(height) + " frames to '" + path + "'.");
+    return static_cast<bool>(_file);
+}
+
+bool FrameCaptureWriter::WriteFrame(const CapturedFrame& frame) {
+    if (!_file.is_open()) return false;
+
+    const size_t cellCount = static_cast<size_t>(_width) * static_cast<size_t>(_height);
+    if (frame.pixels.size() != cellCount) {
+        ASCIIGL_LOG_WARNING_ONCE("FrameCapture: frame pixel count does not match capture dimensions; frame skipped.");
+        return false;
+    }
+
+    WritePod(_file, frame.deltaTime);
+    WriteVec3(_file, frame.playerPos);
+    WriteVec3(_file, frame.cameraPos);
+    WritePod(_file, frame.cameraYaw);
+    WritePod(_file, frame.cameraPitch);
+    WritePod(_file, frame.cameraFov);
+    WritePod(_file, static_cast<uint32_t>(cellCount));
+
+    _scratch.resize(cellCount * 2);
+    for (size_t i = 0; i < cellCount; ++i) {
+        _scratch[i * 2 + 0] = static_cast<uint16_t>(frame.pixels[i].glyph);
+        _scratch[i * 2 + 1] = frame.pixels[i].attributes;
+    }
+    _file.write(reinterpret_cast<const char*>(_scratch.data()), static_cast<std::streamsize>(_scratch.size() * sizeof(uint16_t)));
+
+    ++_frameCount;
+    return static_cast<bool>(_file);
+}
+
+void FrameCaptureWriter::Close() {
+    if (_file.is_open()) {
+        _file.close();
+        Logger::Info("FrameCapture: wrote " + std::to_string(_frameCount) + " frames.");
+    }
+}
+
+// =============================================================================
+// Reader
+// =============================================================================
+
+bool FrameCaptureReader::Open(const std::string& path) {
+    Close();
+    _file.open(path, std::ios::binary);
+    if (!_file.is_open()) {
+        Logger::Error("FrameCapture: failed to open '" + path + "' for reading.");
+        return false;
+    }
+
+    uint32_t magic = 0, version = 0, width = 0, height = 0;
+    if (!ReadPod(_file, magic) || !ReadPod(_file, version) || !ReadPod(_file, width) || !ReadPod(_file, height)) {
+        Logger::Error("FrameCapture: '" + path + "' is truncated.");
+        Close();
+        return false;
+    }
+    if (magic != FrameCapture::MAGIC || version != FrameCapture::VERSION) {
+        Logger::Error("FrameCapture: '" + path + "' is not a version " + std::to_string(FrameCapture::VERSION) + " capture.");
+        Close();
+        return false;
+    }
+
+    _width = width;
+    _height = height;
+    return true;
+}
+
+bool FrameCaptureReader::ReadFrame(CapturedFrame& out) {
+    if (!_file.is_open()) return false;
+
+    uint32_t cellCount = 0;
+    if (!ReadPod(_file, out.deltaTime) ||
+        !ReadVec3(_file, out.playerPos) ||
+        !ReadVec3(_file, out.cameraPos) ||
+        !ReadPod(_file, out.cameraYaw) ||
+        !ReadPod(_file, out.cameraPitch) ||
+        !ReadPod(_file, out.cameraFov) ||
+        !ReadPod(_file, cellCount)) {
+        return false;
+    }
+    if (cellCount != static_cast<size_t>(_width) * static_cast<size_t>(_height)) {
+        Logger::Error("FrameCapture: frame cell count does not match capture header.");
+        return false;
+    }
+
+    _scratch.resize(static_cast<size_t>(cellCount) * 2);
+    _file.read(reinterpret_cast<char*>(_scratch.data()), static_cast<std::streamsize>(_scratch.size() * sizeof(uint16_t)));
+    if (!_file) return false;
+
+    out.pixels.resize(cellCount);
+    for (size_t i = 0; i < cellCount; ++i) {
+        out.pixels[i].glyph = static_cast<wchar_t>(_scratch[i * 2 + 0]);
+        out.pixels[i].attributes = _scratch[i * 2 + 1];
+    }
+    return true;
+}
+
+void FrameCaptureReader::Close() {
+    if (_file.is_open()) {
+        _file.close();
+    }
+    _file.clear();
+}
+
+} // namespace ASCIIgL
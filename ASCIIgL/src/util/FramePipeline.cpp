@@ -0,0 +1,111 @@
+#include <ASCIIgL/util/FramePipeline.hpp>
+
+#include <exception>
+#include <string>
+#include <utility>
+
+#include <ASCIIgL/util/Logger.hpp>
+
+namespace ASCIIgL {
+
+FramePipeline::~FramePipeline() {
+    Stop();
+}
+
+void FramePipeline::Start(Stage stage) {
+    Stop();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stage = std::move(stage);
+    _stop = false;
+    _pending = false;
+    _busy = false;
+    _running = true;
+    _thread = std::thread(&FramePipeline::ThreadLoop, this);
+}
+
+void FramePipeline::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_running) return;
+        _stop = true;
+    }
+    _workCv.notify_one();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _running = false;
+    _pending = false;
+    _busy = false;
+    _idleCv.notify_all();
+}
+
+bool FramePipeline::IsRunning() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _running;
+}
+
+double FramePipeline::WaitIdle() {
+    const Clock::time_point start = Clock::now();
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idleCv.wait(lock, [this] { return !_busy || !_running; });
+    const std::chrono::duration<double, std::milli> waited = Clock::now() - start;
+    return waited.count();
+}
+
+void FramePipeline::Submit(uint64_t frameIndex, Clock::time_point simulationStart) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_running || _stop) return;
+        _frameIndex = frameIndex;
+        _simulationStart = simulationStart;
+        _pending = true;
+        _busy = true;
+    }
+    _workCv.notify_one();
+}
+
+double FramePipeline::GetLastExecuteMs() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _lastExecuteMs;
+}
+
+double FramePipeline::GetLastLatencyMs() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _lastLatencyMs;
+}
+
+void FramePipeline::ThreadLoop() {
+    for (;;) {
+        uint64_t frameIndex = 0;
+        Clock::time_point simulationStart;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _workCv.wait(lock, [this] { return _pending || _stop; });
+            if (!_pending) return;  // stop requested with nothing queued
+            frameIndex = _frameIndex;
+            simulationStart = _simulationStart;
+            _pending = false;
+        }
+
+        const Clock::time_point start = Clock::now();
+        try {
+            _stage(frameIndex);
+        } catch (const std::exception& e) {
+            Logger::Error("FramePipeline: frame " + std::to_string(frameIndex) + " threw: " + e.what());
+        }
+        const Clock::time_point end = Clock::now();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _lastExecuteMs = std::chrono::duration<double, std::milli>(end - start).count();
+            _lastLatencyMs = std::chrono::duration<double, std::milli>(end - simulationStart).count();
+            _busy = false;
+        }
+        _idleCv.notify_all();
+    }
+}
+
+} // namespace ASCIIgL
@@ -0,0 +1,78 @@
+#include <ASCIIgL/util/RangeAllocator.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace ASCIIgL {
+
+void RangeAllocator::Reset(uint32_t capacity) {
+    _free.clear();
+    _capacity = capacity;
+    _used = 0;
+    _allocations = 0;
+    if (capacity > 0) {
+        _free.emplace(0u, capacity);
+    }
+}
+
+uint32_t RangeAllocator::Allocate(uint32_t count) {
+    if (count == 0) return kInvalidOffset;
+
+    for (auto it = _free.begin(); it != _free.end(); ++it) {
+        if (it->second < count) continue;
+
+        const uint32_t offset = it->first;
+        const uint32_t remaining = it->second - count;
+        _free.erase(it);
+        if (remaining > 0) {
+            _free.emplace(offset + count, remaining);
+        }
+        _used += count;
+        ++_allocations;
+        return offset;
+    }
+    return kInvalidOffset;
+}
+
+void RangeAllocator::Free(uint32_t offset, uint32_t count) {
+    if (count == 0 || offset == kInvalidOffset) return;
+    assert(offset + count <= _capacity && "RangeAllocator::Free out of range");
+
+    uint32_t start = offset;
+    uint32_t length = count;
+
+    // Merge with the following block.
+    auto next = _free.lower_bound(offset);
+    if (next != _free.end() && next->first == offset + count) {
+        length += next->second;
+        next = _free.erase(next);
+    }
+    // Merge with the preceding block.
+    if (next != _free.begin()) {
+        auto prev = std::prev(next);
+        assert(prev->first + prev->second <= offset && "RangeAllocator::Free overlaps a free block");
+        if (prev->first + prev->second == offset) {
+            start = prev->first;
+            length += prev->second;
+            _free.erase(prev);
+        }
+    }
+    _free.emplace(start, length);
+
+    _used -= count;
+    --_allocations;
+}
+
+RangeAllocator::Stats RangeAllocator::GetStats() const {
+    Stats stats;
+    stats.capacity = _capacity;
+    stats.used = _used;
+    stats.allocations = _allocations;
+    stats.freeBlocks = static_cast<uint32_t>(_free.size());
+    for (const auto& [offset, count] : _free) {
+        stats.largestFree = std::max(stats.largestFree, count);
+    }
+    return stats;
+}
+
+} // namespace ASCIIgL
@@ -0,0 +1,71 @@
+#include <ASCIIgL/util/StageTimings.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+
+namespace ASCIIgL {
+
+namespace {
+
+double Percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    const size_t idx = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(idx, sorted.size() - 1)];
+}
+
+} // namespace
+
+void StageTimings::Record(const char* name, double ms) {
+    if (!_enabled || !name) return;
+    auto it = _samples.find(name);
+    if (it == _samples.end()) {
+        _order.emplace_back(name);
+        it = _samples.emplace(name, std::vector<double>{}).first;
+    }
+    it->second.push_back(ms);
+}
+
+void StageTimings::Reset() {
+    _order.clear();
+    _samples.clear();
+}
+
+std::vector<StageTimings::Summary> StageTimings::Summarize() const {
+    std::vector<Summary> out;
+    out.reserve(_order.size());
+    for (const std::string& name : _order) {
+        auto it = _samples.find(name);
+        if (it == _samples.end() || it->second.empty()) continue;
+
+        std::vector<double> sorted = it->second;
+        std::sort(sorted.begin(), sorted.end());
+
+        Summary s;
+        s.name = name;
+        s.count = sorted.size();
+        s.totalMs = std::accumulate(sorted.begin(), sorted.end(), 0.0);
+        s.meanMs = s.totalMs / static_cast<double>(s.count);
+        s.p50Ms = Percentile(sorted, 0.50);
+        s.p95Ms = Percentile(sorted, 0.95);
+        s.maxMs = sorted.back();
+        out.push_back(std::move(s));
+    }
+    return out;
+}
+
+std::string StageTimings::FormatReport() const {
+    std::string report;
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-40s %8s %10s %10s %10s %10s\n",
+                  "stage", "frames", "mean ms", "p50 ms", "p95 ms", "max ms");
+    report += line;
+    for (const Summary& s : Summarize()) {
+        std::snprintf(line, sizeof(line), "%-40s %8zu %10.3f %10.3f %10.3f %10.3f\n",
+                      s.name.c_str(), s.count, s.meanMs, s.p50Ms, s.p95Ms, s.maxMs);
+        report += line;
+    }
+    return report;
+}
+
+} // namespace ASCIIgL
@@ -0,0 +1,109 @@
+#include <ASCIIgL/util/StartupTimeline.hpp>
+
+#include <algorithm>
+#include <cstdio>
+
+#include <oneapi/tbb/task_arena.h>
+
+namespace ASCIIgL {
+
+namespace {
+
+double MsBetween(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+} // namespace
+
+void StartupTimeline::Begin() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _spans.clear();
+    _origin = std::chrono::steady_clock::now();
+    _ended = false;
+}
+
+void StartupTimeline::End() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _end = std::chrono::steady_clock::now();
+    _ended = true;
+}
+
+void StartupTimeline::Record(const char* name, std::chrono::steady_clock::time_point start,
+                             std::chrono::steady_clock::time_point end) {
+    if (!name) return;
+    const int slot = oneapi::tbb::this_task_arena::current_thread_index();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    Span span;
+    span.name = name;
+    span.startMs = MsBetween(_origin, start);
+    span.endMs = MsBetween(_origin, end);
+    span.thread = slot < 0 ? 0 : slot;
+    _spans.push_back(std::move(span));
+}
+
+std::vector<StartupTimeline::Span> StartupTimeline::GetSpans() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _spans;
+}
+
+double StartupTimeline::GetTotalMs() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return MsBetween(_origin, _ended ? _end : std::chrono::steady_clock::now());
+}
+
+std::string StartupTimeline::FormatReport() const {
+    std::vector<Span> spans = GetSpans();
+    const double totalMs = GetTotalMs();
+    std::stable_sort(spans.begin(), spans.end(),
+                     [](const Span& a, const Span& b) { return a.startMs < b.startMs; });
+
+    constexpr int kBarWidth = 40;
+    const double msPerCell = totalMs > 0.0 ? totalMs / kBarWidth : 1.0;
+
+    std::string report;
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-32s %4s %9s %9s %9s  %s\n",
+                  "task", "thr", "start ms", "end ms", "dur ms", "timeline");
+    report += line;
+
+    // A span enclosed by an earlier span on the same thread is a sub-step: indent it and leave it out
+    // of the summed task time so the overlap ratio only counts top-level work.
+    const auto isNested = [&](size_t idx) {
+        for (size_t j = 0; j < spans.size(); ++j) {
+            if (j == idx || spans[j].thread != spans[idx].thread) continue;
+            const bool encloses = spans[j].startMs <= spans[idx].startMs && spans[j].endMs >= spans[idx].endMs;
+            const bool larger = (spans[j].endMs - spans[j].startMs) > (spans[idx].endMs - spans[idx].startMs) || j < idx;
+            if (encloses && larger) return true;
+        }
+        return false;
+    };
+
+    double taskMs = 0.0;
+    for (size_t idx = 0; idx < spans.size(); ++idx) {
+        const Span& s = spans[idx];
+        const double durMs = s.endMs - s.startMs;
+        const bool nested = isNested(idx);
+        if (!nested) taskMs += durMs;
+
+        const int first = std::clamp(static_cast<int>(s.startMs / msPerCell), 0, kBarWidth - 1);
+        const int last = std::clamp(static_cast<int>(s.endMs / msPerCell), first, kBarWidth - 1);
+        char bar[kBarWidth + 1];
+        for (int c = 0; c < kBarWidth; ++c) {
+            bar[c] = (c >= first && c <= last) ? '#' : '.';
+        }
+        bar[kBarWidth] = '\0';
+
+        const std::string label = nested ? "  " + s.name : s.name;
+        std::snprintf(line, sizeof(line), "%-32s %4d %9.1f %9.1f %9.1f  |%s|\n",
+                      label.c_str(), s.thread, s.startMs, s.endMs, durMs, bar);
+        report += line;
+    }
+
+    std::snprintf(line, sizeof(line), "wall %.1f ms, summed task time %.1f ms (%.2fx overlap)\n",
+                  totalMs, taskMs, totalMs > 0.0 ? taskMs / totalMs : 0.0);
+    report += line;
+    return report;
+}
+
+} // namespace ASCIIgL